@@ -0,0 +1,191 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonConfig.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonConfigVersion.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonTargets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/arbor/CMakeLists.txt"
+  "/root/repo/arbor/include/CMakeLists.txt"
+  "/root/repo/arbor/include/arbor/assert_macro.hpp.disabled"
+  "/root/repo/arborenv/CMakeLists.txt"
+  "/root/repo/arborio/CMakeLists.txt"
+  "/root/repo/cmake/CheckCompilerXLC.cmake"
+  "/root/repo/cmake/CompilerOptions.cmake"
+  "/root/repo/cmake/ErrorTarget.cmake"
+  "/root/repo/cmake/FindPythonModule.cmake"
+  "/root/repo/cmake/FindSphinx.cmake"
+  "/root/repo/cmake/FindThreadsCudaFix.cmake"
+  "/root/repo/cmake/GitSubmodule.cmake"
+  "/root/repo/cmake/arbor-config.cmake.in"
+  "/root/repo/cmake/dummy.cpp"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/example/CMakeLists.txt"
+  "/root/repo/example/bench/CMakeLists.txt"
+  "/root/repo/example/brunel/CMakeLists.txt"
+  "/root/repo/example/dryrun/CMakeLists.txt"
+  "/root/repo/example/gap_junctions/CMakeLists.txt"
+  "/root/repo/example/generators/CMakeLists.txt"
+  "/root/repo/example/lfp/CMakeLists.txt"
+  "/root/repo/example/probe-demo/CMakeLists.txt"
+  "/root/repo/example/ring/CMakeLists.txt"
+  "/root/repo/example/single/CMakeLists.txt"
+  "/root/repo/ext/CMakeLists.txt"
+  "/root/repo/mechanisms/BuildModules.cmake"
+  "/root/repo/mechanisms/CMakeLists.txt"
+  "/root/repo/modcc/CMakeLists.txt"
+  "/root/repo/sup/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/ubench/CMakeLists.txt"
+  "/root/repo/test/unit-distributed/CMakeLists.txt"
+  "/root/repo/test/unit-modcc/CMakeLists.txt"
+  "/root/repo/test/unit/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMPI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "arbor-config-version.cmake"
+  "arbor-config.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arbor/include/arbor/assert_macro.hpp"
+  "arbor/include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "sup/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modcc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arbor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "mechanisms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arborenv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arborio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit-distributed/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit-modcc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/ubench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/dryrun/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/generators/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/brunel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/ring/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/gap_junctions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/single/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/probe-demo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/lfp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "ext/CMakeFiles/gbench-build.dir/DependInfo.cmake"
+  "ext/CMakeFiles/check-sphinx_rtd_theme.dir/DependInfo.cmake"
+  "arbor/include/CMakeFiles/generate_version_hpp.dir/DependInfo.cmake"
+  "sup/CMakeFiles/arbor-sup.dir/DependInfo.cmake"
+  "modcc/CMakeFiles/libmodcc.dir/DependInfo.cmake"
+  "modcc/CMakeFiles/modcc.dir/DependInfo.cmake"
+  "arbor/CMakeFiles/arbor.dir/DependInfo.cmake"
+  "mechanisms/CMakeFiles/build_all_mods.dir/DependInfo.cmake"
+  "mechanisms/CMakeFiles/build_catalogue_bbp_mods.dir/DependInfo.cmake"
+  "mechanisms/CMakeFiles/bbp_catalogue_cpp_target.dir/DependInfo.cmake"
+  "mechanisms/CMakeFiles/build_catalogue_allen_mods.dir/DependInfo.cmake"
+  "mechanisms/CMakeFiles/allen_catalogue_cpp_target.dir/DependInfo.cmake"
+  "mechanisms/CMakeFiles/build_catalogue_default_mods.dir/DependInfo.cmake"
+  "mechanisms/CMakeFiles/default_catalogue_cpp_target.dir/DependInfo.cmake"
+  "arborenv/CMakeFiles/arborenv.dir/DependInfo.cmake"
+  "arborio/CMakeFiles/arborio.dir/DependInfo.cmake"
+  "test/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "test/CMakeFiles/tests.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/build_test_mods.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/build_test_scalar_mods.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/build_test_simd_mods.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/unit.dir/DependInfo.cmake"
+  "test/unit-distributed/CMakeFiles/unit-local.dir/DependInfo.cmake"
+  "test/unit-distributed/CMakeFiles/unit-mpi.dir/DependInfo.cmake"
+  "test/unit-modcc/CMakeFiles/unit-modcc.dir/DependInfo.cmake"
+  "test/unit-modcc/CMakeFiles/modcc-simd-avx.dir/DependInfo.cmake"
+  "test/unit-modcc/CMakeFiles/modcc-simd-avx2.dir/DependInfo.cmake"
+  "test/unit-modcc/CMakeFiles/modcc-simd-avx512.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/accumulate_functor_values.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/default_construct.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/event_setup.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/event_binning.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/event_delivery.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/fvm_layout_cache.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/huge_pages.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/label_parse.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/matrix_solve.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/mech_kernels.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/merge_events.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/morphology_construction.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/spike_exchange.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/step_kernels.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/task_system.dir/DependInfo.cmake"
+  "test/ubench/CMakeFiles/ubenches.dir/DependInfo.cmake"
+  "example/CMakeFiles/examples.dir/DependInfo.cmake"
+  "example/dryrun/CMakeFiles/dryrun.dir/DependInfo.cmake"
+  "example/generators/CMakeFiles/generators.dir/DependInfo.cmake"
+  "example/brunel/CMakeFiles/brunel.dir/DependInfo.cmake"
+  "example/bench/CMakeFiles/bench.dir/DependInfo.cmake"
+  "example/ring/CMakeFiles/ring.dir/DependInfo.cmake"
+  "example/gap_junctions/CMakeFiles/gap_junctions.dir/DependInfo.cmake"
+  "example/single/CMakeFiles/single-cell.dir/DependInfo.cmake"
+  "example/probe-demo/CMakeFiles/probe-demo.dir/DependInfo.cmake"
+  "example/lfp/CMakeFiles/lfp.dir/DependInfo.cmake"
+  "doc/CMakeFiles/check-sphinx.dir/DependInfo.cmake"
+  "doc/CMakeFiles/ext-svgwrite.dir/DependInfo.cmake"
+  "doc/CMakeFiles/html.dir/DependInfo.cmake"
+  )
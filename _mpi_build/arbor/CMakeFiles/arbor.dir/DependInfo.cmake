@@ -0,0 +1,128 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_mpi_build/mechanisms/allen_catalogue.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/allen_catalogue.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/allen_catalogue.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/bbp_catalogue.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/bbp_catalogue.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/bbp_catalogue.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/default_catalogue.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/default_catalogue.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/default_catalogue.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/CaDynamics_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/CaDynamics_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/CaDynamics_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_HVA_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ca_HVA_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ca_HVA_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_LVA_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ca_LVA_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ca_LVA_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ih_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ih_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ih_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Im_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Im_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Im_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Im_v2_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Im_v2_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Im_v2_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/K_P_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/K_P_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/K_P_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/K_T_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/K_T_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/K_T_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kd_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kd_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kd_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kv2like_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kv2like_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kv2like_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kv3_1_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kv3_1_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kv3_1_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaTa_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaTa_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaTa_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaTs_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaTs_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaTs_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaV_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaV_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaV_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Nap_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Nap_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Nap_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/SK_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/SK_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/allen/SK_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/CaDynamics_E2_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/CaDynamics_E2_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/CaDynamics_E2_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_HVA_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ca_HVA_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ca_HVA_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_LVAst_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ca_LVAst_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ca_LVAst_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ih_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ih_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ih_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Im_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Im_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Im_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Pst_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/K_Pst_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/K_Pst_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Tst_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/K_Tst_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/K_Tst_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTa_t_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/NaTa_t_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/NaTa_t_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTs2_t_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/NaTs2_t_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/NaTs2_t_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Nap_Et2_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Nap_Et2_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Nap_Et2_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/SK_E2_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/SK_E2_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/SK_E2_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/SKv3_1_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/SKv3_1_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/SKv3_1_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/default/exp2syn_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/exp2syn_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/exp2syn_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/default/expsyn_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/expsyn_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/expsyn_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/default/hh_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/hh_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/hh_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/default/kamt_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/kamt_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/kamt_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/default/kdrmt_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/kdrmt_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/kdrmt_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/default/nax_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/nax_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/nax_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/default/nernst_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/nernst_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/nernst_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/mechanisms/generated/default/pas_cpu.cpp" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/pas_cpu.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/__/mechanisms/generated/default/pas_cpu.cpp.o.d"
+  "/root/repo/arbor/arbexcept.cpp" "arbor/CMakeFiles/arbor.dir/arbexcept.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/arbexcept.cpp.o.d"
+  "/root/repo/arbor/assert.cpp" "arbor/CMakeFiles/arbor.dir/assert.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/assert.cpp.o.d"
+  "/root/repo/arbor/backends/multicore/fvm.cpp" "arbor/CMakeFiles/arbor.dir/backends/multicore/fvm.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/backends/multicore/fvm.cpp.o.d"
+  "/root/repo/arbor/backends/multicore/mechanism.cpp" "arbor/CMakeFiles/arbor.dir/backends/multicore/mechanism.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/backends/multicore/mechanism.cpp.o.d"
+  "/root/repo/arbor/backends/multicore/shared_state.cpp" "arbor/CMakeFiles/arbor.dir/backends/multicore/shared_state.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/backends/multicore/shared_state.cpp.o.d"
+  "/root/repo/arbor/backends/multicore/single_cv_integrator.cpp" "arbor/CMakeFiles/arbor.dir/backends/multicore/single_cv_integrator.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/backends/multicore/single_cv_integrator.cpp.o.d"
+  "/root/repo/arbor/backends/multicore/stimulus.cpp" "arbor/CMakeFiles/arbor.dir/backends/multicore/stimulus.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/backends/multicore/stimulus.cpp.o.d"
+  "/root/repo/arbor/benchmark_cell_group.cpp" "arbor/CMakeFiles/arbor.dir/benchmark_cell_group.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/benchmark_cell_group.cpp.o.d"
+  "/root/repo/arbor/builtin_mechanisms.cpp" "arbor/CMakeFiles/arbor.dir/builtin_mechanisms.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/builtin_mechanisms.cpp.o.d"
+  "/root/repo/arbor/cable_cell.cpp" "arbor/CMakeFiles/arbor.dir/cable_cell.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/cable_cell.cpp.o.d"
+  "/root/repo/arbor/cable_cell_param.cpp" "arbor/CMakeFiles/arbor.dir/cable_cell_param.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/cable_cell_param.cpp.o.d"
+  "/root/repo/arbor/cell_group_factory.cpp" "arbor/CMakeFiles/arbor.dir/cell_group_factory.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/cell_group_factory.cpp.o.d"
+  "/root/repo/arbor/common_types_io.cpp" "arbor/CMakeFiles/arbor.dir/common_types_io.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/common_types_io.cpp.o.d"
+  "/root/repo/arbor/communication/communicator.cpp" "arbor/CMakeFiles/arbor.dir/communication/communicator.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/communication/communicator.cpp.o.d"
+  "/root/repo/arbor/communication/dry_run_context.cpp" "arbor/CMakeFiles/arbor.dir/communication/dry_run_context.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/communication/dry_run_context.cpp.o.d"
+  "/root/repo/arbor/communication/mpi.cpp" "arbor/CMakeFiles/arbor.dir/communication/mpi.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/communication/mpi.cpp.o.d"
+  "/root/repo/arbor/communication/mpi_context.cpp" "arbor/CMakeFiles/arbor.dir/communication/mpi_context.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/communication/mpi_context.cpp.o.d"
+  "/root/repo/arbor/communication/mpi_error.cpp" "arbor/CMakeFiles/arbor.dir/communication/mpi_error.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/communication/mpi_error.cpp.o.d"
+  "/root/repo/arbor/communication/spike_codec.cpp" "arbor/CMakeFiles/arbor.dir/communication/spike_codec.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/communication/spike_codec.cpp.o.d"
+  "/root/repo/arbor/cv_policy.cpp" "arbor/CMakeFiles/arbor.dir/cv_policy.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/cv_policy.cpp.o.d"
+  "/root/repo/arbor/event_binner.cpp" "arbor/CMakeFiles/arbor.dir/event_binner.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/event_binner.cpp.o.d"
+  "/root/repo/arbor/execution_context.cpp" "arbor/CMakeFiles/arbor.dir/execution_context.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/execution_context.cpp.o.d"
+  "/root/repo/arbor/extracellular.cpp" "arbor/CMakeFiles/arbor.dir/extracellular.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/extracellular.cpp.o.d"
+  "/root/repo/arbor/fvm_layout.cpp" "arbor/CMakeFiles/arbor.dir/fvm_layout.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/fvm_layout.cpp.o.d"
+  "/root/repo/arbor/fvm_layout_cache.cpp" "arbor/CMakeFiles/arbor.dir/fvm_layout_cache.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/fvm_layout_cache.cpp.o.d"
+  "/root/repo/arbor/fvm_lowered_cell_impl.cpp" "arbor/CMakeFiles/arbor.dir/fvm_lowered_cell_impl.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/fvm_lowered_cell_impl.cpp.o.d"
+  "/root/repo/arbor/gpu_context.cpp" "arbor/CMakeFiles/arbor.dir/gpu_context.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/gpu_context.cpp.o.d"
+  "/root/repo/arbor/group_size_tuning.cpp" "arbor/CMakeFiles/arbor.dir/group_size_tuning.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/group_size_tuning.cpp.o.d"
+  "/root/repo/arbor/hardware/memory.cpp" "arbor/CMakeFiles/arbor.dir/hardware/memory.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/hardware/memory.cpp.o.d"
+  "/root/repo/arbor/hardware/power.cpp" "arbor/CMakeFiles/arbor.dir/hardware/power.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/hardware/power.cpp.o.d"
+  "/root/repo/arbor/io/locked_ostream.cpp" "arbor/CMakeFiles/arbor.dir/io/locked_ostream.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/io/locked_ostream.cpp.o.d"
+  "/root/repo/arbor/io/serialize_hex.cpp" "arbor/CMakeFiles/arbor.dir/io/serialize_hex.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/io/serialize_hex.cpp.o.d"
+  "/root/repo/arbor/lif_cell_group.cpp" "arbor/CMakeFiles/arbor.dir/lif_cell_group.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/lif_cell_group.cpp.o.d"
+  "/root/repo/arbor/mc_cell_group.cpp" "arbor/CMakeFiles/arbor.dir/mc_cell_group.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/mc_cell_group.cpp.o.d"
+  "/root/repo/arbor/mechcat.cpp" "arbor/CMakeFiles/arbor.dir/mechcat.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/mechcat.cpp.o.d"
+  "/root/repo/arbor/memory/gpu_wrappers.cpp" "arbor/CMakeFiles/arbor.dir/memory/gpu_wrappers.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/memory/gpu_wrappers.cpp.o.d"
+  "/root/repo/arbor/memory/huge_pages.cpp" "arbor/CMakeFiles/arbor.dir/memory/huge_pages.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/memory/huge_pages.cpp.o.d"
+  "/root/repo/arbor/memory/util.cpp" "arbor/CMakeFiles/arbor.dir/memory/util.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/memory/util.cpp.o.d"
+  "/root/repo/arbor/merge_events.cpp" "arbor/CMakeFiles/arbor.dir/merge_events.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/merge_events.cpp.o.d"
+  "/root/repo/arbor/morph/embed_pwlin.cpp" "arbor/CMakeFiles/arbor.dir/morph/embed_pwlin.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/embed_pwlin.cpp.o.d"
+  "/root/repo/arbor/morph/label_dict.cpp" "arbor/CMakeFiles/arbor.dir/morph/label_dict.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/label_dict.cpp.o.d"
+  "/root/repo/arbor/morph/label_parse.cpp" "arbor/CMakeFiles/arbor.dir/morph/label_parse.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/label_parse.cpp.o.d"
+  "/root/repo/arbor/morph/locset.cpp" "arbor/CMakeFiles/arbor.dir/morph/locset.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/locset.cpp.o.d"
+  "/root/repo/arbor/morph/morphexcept.cpp" "arbor/CMakeFiles/arbor.dir/morph/morphexcept.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/morphexcept.cpp.o.d"
+  "/root/repo/arbor/morph/morphology.cpp" "arbor/CMakeFiles/arbor.dir/morph/morphology.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/morphology.cpp.o.d"
+  "/root/repo/arbor/morph/mprovider.cpp" "arbor/CMakeFiles/arbor.dir/morph/mprovider.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/mprovider.cpp.o.d"
+  "/root/repo/arbor/morph/place_pwlin.cpp" "arbor/CMakeFiles/arbor.dir/morph/place_pwlin.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/place_pwlin.cpp.o.d"
+  "/root/repo/arbor/morph/primitives.cpp" "arbor/CMakeFiles/arbor.dir/morph/primitives.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/primitives.cpp.o.d"
+  "/root/repo/arbor/morph/region.cpp" "arbor/CMakeFiles/arbor.dir/morph/region.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/region.cpp.o.d"
+  "/root/repo/arbor/morph/segment_tree.cpp" "arbor/CMakeFiles/arbor.dir/morph/segment_tree.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/segment_tree.cpp.o.d"
+  "/root/repo/arbor/morph/spatial_index.cpp" "arbor/CMakeFiles/arbor.dir/morph/spatial_index.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/spatial_index.cpp.o.d"
+  "/root/repo/arbor/morph/stitch.cpp" "arbor/CMakeFiles/arbor.dir/morph/stitch.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/morph/stitch.cpp.o.d"
+  "/root/repo/arbor/partition_load_balance.cpp" "arbor/CMakeFiles/arbor.dir/partition_load_balance.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/partition_load_balance.cpp.o.d"
+  "/root/repo/arbor/profile/clock.cpp" "arbor/CMakeFiles/arbor.dir/profile/clock.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/profile/clock.cpp.o.d"
+  "/root/repo/arbor/profile/memory_meter.cpp" "arbor/CMakeFiles/arbor.dir/profile/memory_meter.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/profile/memory_meter.cpp.o.d"
+  "/root/repo/arbor/profile/meter_manager.cpp" "arbor/CMakeFiles/arbor.dir/profile/meter_manager.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/profile/meter_manager.cpp.o.d"
+  "/root/repo/arbor/profile/power_meter.cpp" "arbor/CMakeFiles/arbor.dir/profile/power_meter.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/profile/power_meter.cpp.o.d"
+  "/root/repo/arbor/profile/profiler.cpp" "arbor/CMakeFiles/arbor.dir/profile/profiler.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/profile/profiler.cpp.o.d"
+  "/root/repo/arbor/s_expr.cpp" "arbor/CMakeFiles/arbor.dir/s_expr.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/s_expr.cpp.o.d"
+  "/root/repo/arbor/schedule.cpp" "arbor/CMakeFiles/arbor.dir/schedule.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/schedule.cpp.o.d"
+  "/root/repo/arbor/simulation.cpp" "arbor/CMakeFiles/arbor.dir/simulation.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/simulation.cpp.o.d"
+  "/root/repo/arbor/spike_event_io.cpp" "arbor/CMakeFiles/arbor.dir/spike_event_io.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/spike_event_io.cpp.o.d"
+  "/root/repo/arbor/spike_source_cell_group.cpp" "arbor/CMakeFiles/arbor.dir/spike_source_cell_group.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/spike_source_cell_group.cpp.o.d"
+  "/root/repo/arbor/spike_trains.cpp" "arbor/CMakeFiles/arbor.dir/spike_trains.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/spike_trains.cpp.o.d"
+  "/root/repo/arbor/symmetric_recipe.cpp" "arbor/CMakeFiles/arbor.dir/symmetric_recipe.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/symmetric_recipe.cpp.o.d"
+  "/root/repo/arbor/thread_private_spike_store.cpp" "arbor/CMakeFiles/arbor.dir/thread_private_spike_store.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/thread_private_spike_store.cpp.o.d"
+  "/root/repo/arbor/threading/threading.cpp" "arbor/CMakeFiles/arbor.dir/threading/threading.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/threading/threading.cpp.o.d"
+  "/root/repo/arbor/tree.cpp" "arbor/CMakeFiles/arbor.dir/tree.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/tree.cpp.o.d"
+  "/root/repo/arbor/util/hostname.cpp" "arbor/CMakeFiles/arbor.dir/util/hostname.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/util/hostname.cpp.o.d"
+  "/root/repo/arbor/util/unwind.cpp" "arbor/CMakeFiles/arbor.dir/util/unwind.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/util/unwind.cpp.o.d"
+  "/root/repo/arbor/version.cpp" "arbor/CMakeFiles/arbor.dir/version.cpp.o" "gcc" "arbor/CMakeFiles/arbor.dir/version.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
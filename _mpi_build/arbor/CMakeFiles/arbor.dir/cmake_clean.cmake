@@ -0,0 +1,229 @@
+file(REMOVE_RECURSE
+  "../lib/libarbor.a"
+  "../lib/libarbor.pdb"
+  "CMakeFiles/arbor.dir/__/mechanisms/allen_catalogue.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/allen_catalogue.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/bbp_catalogue.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/bbp_catalogue.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/default_catalogue.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/default_catalogue.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/CaDynamics_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/CaDynamics_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ca_HVA_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ca_HVA_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ca_LVA_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ca_LVA_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ih_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Ih_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Im_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Im_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Im_v2_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Im_v2_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/K_P_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/K_P_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/K_T_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/K_T_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kd_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kd_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kv2like_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kv2like_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kv3_1_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Kv3_1_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaTa_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaTa_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaTs_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaTs_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaV_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/NaV_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Nap_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/Nap_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/SK_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/allen/SK_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/CaDynamics_E2_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/CaDynamics_E2_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ca_HVA_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ca_HVA_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ca_LVAst_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ca_LVAst_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ih_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Ih_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Im_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Im_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/K_Pst_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/K_Pst_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/K_Tst_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/K_Tst_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/NaTa_t_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/NaTa_t_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/NaTs2_t_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/NaTs2_t_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Nap_Et2_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/Nap_Et2_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/SK_E2_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/SK_E2_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/SKv3_1_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/bbp/SKv3_1_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/exp2syn_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/exp2syn_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/expsyn_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/expsyn_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/hh_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/hh_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/kamt_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/kamt_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/kdrmt_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/kdrmt_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/nax_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/nax_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/nernst_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/nernst_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/pas_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/default/pas_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/arbexcept.cpp.o"
+  "CMakeFiles/arbor.dir/arbexcept.cpp.o.d"
+  "CMakeFiles/arbor.dir/assert.cpp.o"
+  "CMakeFiles/arbor.dir/assert.cpp.o.d"
+  "CMakeFiles/arbor.dir/backends/multicore/fvm.cpp.o"
+  "CMakeFiles/arbor.dir/backends/multicore/fvm.cpp.o.d"
+  "CMakeFiles/arbor.dir/backends/multicore/mechanism.cpp.o"
+  "CMakeFiles/arbor.dir/backends/multicore/mechanism.cpp.o.d"
+  "CMakeFiles/arbor.dir/backends/multicore/shared_state.cpp.o"
+  "CMakeFiles/arbor.dir/backends/multicore/shared_state.cpp.o.d"
+  "CMakeFiles/arbor.dir/backends/multicore/single_cv_integrator.cpp.o"
+  "CMakeFiles/arbor.dir/backends/multicore/single_cv_integrator.cpp.o.d"
+  "CMakeFiles/arbor.dir/backends/multicore/stimulus.cpp.o"
+  "CMakeFiles/arbor.dir/backends/multicore/stimulus.cpp.o.d"
+  "CMakeFiles/arbor.dir/benchmark_cell_group.cpp.o"
+  "CMakeFiles/arbor.dir/benchmark_cell_group.cpp.o.d"
+  "CMakeFiles/arbor.dir/builtin_mechanisms.cpp.o"
+  "CMakeFiles/arbor.dir/builtin_mechanisms.cpp.o.d"
+  "CMakeFiles/arbor.dir/cable_cell.cpp.o"
+  "CMakeFiles/arbor.dir/cable_cell.cpp.o.d"
+  "CMakeFiles/arbor.dir/cable_cell_param.cpp.o"
+  "CMakeFiles/arbor.dir/cable_cell_param.cpp.o.d"
+  "CMakeFiles/arbor.dir/cell_group_factory.cpp.o"
+  "CMakeFiles/arbor.dir/cell_group_factory.cpp.o.d"
+  "CMakeFiles/arbor.dir/common_types_io.cpp.o"
+  "CMakeFiles/arbor.dir/common_types_io.cpp.o.d"
+  "CMakeFiles/arbor.dir/communication/communicator.cpp.o"
+  "CMakeFiles/arbor.dir/communication/communicator.cpp.o.d"
+  "CMakeFiles/arbor.dir/communication/dry_run_context.cpp.o"
+  "CMakeFiles/arbor.dir/communication/dry_run_context.cpp.o.d"
+  "CMakeFiles/arbor.dir/communication/mpi.cpp.o"
+  "CMakeFiles/arbor.dir/communication/mpi.cpp.o.d"
+  "CMakeFiles/arbor.dir/communication/mpi_context.cpp.o"
+  "CMakeFiles/arbor.dir/communication/mpi_context.cpp.o.d"
+  "CMakeFiles/arbor.dir/communication/mpi_error.cpp.o"
+  "CMakeFiles/arbor.dir/communication/mpi_error.cpp.o.d"
+  "CMakeFiles/arbor.dir/communication/spike_codec.cpp.o"
+  "CMakeFiles/arbor.dir/communication/spike_codec.cpp.o.d"
+  "CMakeFiles/arbor.dir/cv_policy.cpp.o"
+  "CMakeFiles/arbor.dir/cv_policy.cpp.o.d"
+  "CMakeFiles/arbor.dir/event_binner.cpp.o"
+  "CMakeFiles/arbor.dir/event_binner.cpp.o.d"
+  "CMakeFiles/arbor.dir/execution_context.cpp.o"
+  "CMakeFiles/arbor.dir/execution_context.cpp.o.d"
+  "CMakeFiles/arbor.dir/extracellular.cpp.o"
+  "CMakeFiles/arbor.dir/extracellular.cpp.o.d"
+  "CMakeFiles/arbor.dir/fvm_layout.cpp.o"
+  "CMakeFiles/arbor.dir/fvm_layout.cpp.o.d"
+  "CMakeFiles/arbor.dir/fvm_layout_cache.cpp.o"
+  "CMakeFiles/arbor.dir/fvm_layout_cache.cpp.o.d"
+  "CMakeFiles/arbor.dir/fvm_lowered_cell_impl.cpp.o"
+  "CMakeFiles/arbor.dir/fvm_lowered_cell_impl.cpp.o.d"
+  "CMakeFiles/arbor.dir/gpu_context.cpp.o"
+  "CMakeFiles/arbor.dir/gpu_context.cpp.o.d"
+  "CMakeFiles/arbor.dir/group_size_tuning.cpp.o"
+  "CMakeFiles/arbor.dir/group_size_tuning.cpp.o.d"
+  "CMakeFiles/arbor.dir/hardware/memory.cpp.o"
+  "CMakeFiles/arbor.dir/hardware/memory.cpp.o.d"
+  "CMakeFiles/arbor.dir/hardware/power.cpp.o"
+  "CMakeFiles/arbor.dir/hardware/power.cpp.o.d"
+  "CMakeFiles/arbor.dir/io/locked_ostream.cpp.o"
+  "CMakeFiles/arbor.dir/io/locked_ostream.cpp.o.d"
+  "CMakeFiles/arbor.dir/io/serialize_hex.cpp.o"
+  "CMakeFiles/arbor.dir/io/serialize_hex.cpp.o.d"
+  "CMakeFiles/arbor.dir/lif_cell_group.cpp.o"
+  "CMakeFiles/arbor.dir/lif_cell_group.cpp.o.d"
+  "CMakeFiles/arbor.dir/mc_cell_group.cpp.o"
+  "CMakeFiles/arbor.dir/mc_cell_group.cpp.o.d"
+  "CMakeFiles/arbor.dir/mechcat.cpp.o"
+  "CMakeFiles/arbor.dir/mechcat.cpp.o.d"
+  "CMakeFiles/arbor.dir/memory/gpu_wrappers.cpp.o"
+  "CMakeFiles/arbor.dir/memory/gpu_wrappers.cpp.o.d"
+  "CMakeFiles/arbor.dir/memory/huge_pages.cpp.o"
+  "CMakeFiles/arbor.dir/memory/huge_pages.cpp.o.d"
+  "CMakeFiles/arbor.dir/memory/util.cpp.o"
+  "CMakeFiles/arbor.dir/memory/util.cpp.o.d"
+  "CMakeFiles/arbor.dir/merge_events.cpp.o"
+  "CMakeFiles/arbor.dir/merge_events.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/embed_pwlin.cpp.o"
+  "CMakeFiles/arbor.dir/morph/embed_pwlin.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/label_dict.cpp.o"
+  "CMakeFiles/arbor.dir/morph/label_dict.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/label_parse.cpp.o"
+  "CMakeFiles/arbor.dir/morph/label_parse.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/locset.cpp.o"
+  "CMakeFiles/arbor.dir/morph/locset.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/morphexcept.cpp.o"
+  "CMakeFiles/arbor.dir/morph/morphexcept.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/morphology.cpp.o"
+  "CMakeFiles/arbor.dir/morph/morphology.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/mprovider.cpp.o"
+  "CMakeFiles/arbor.dir/morph/mprovider.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/place_pwlin.cpp.o"
+  "CMakeFiles/arbor.dir/morph/place_pwlin.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/primitives.cpp.o"
+  "CMakeFiles/arbor.dir/morph/primitives.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/region.cpp.o"
+  "CMakeFiles/arbor.dir/morph/region.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/segment_tree.cpp.o"
+  "CMakeFiles/arbor.dir/morph/segment_tree.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/spatial_index.cpp.o"
+  "CMakeFiles/arbor.dir/morph/spatial_index.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/stitch.cpp.o"
+  "CMakeFiles/arbor.dir/morph/stitch.cpp.o.d"
+  "CMakeFiles/arbor.dir/partition_load_balance.cpp.o"
+  "CMakeFiles/arbor.dir/partition_load_balance.cpp.o.d"
+  "CMakeFiles/arbor.dir/profile/clock.cpp.o"
+  "CMakeFiles/arbor.dir/profile/clock.cpp.o.d"
+  "CMakeFiles/arbor.dir/profile/memory_meter.cpp.o"
+  "CMakeFiles/arbor.dir/profile/memory_meter.cpp.o.d"
+  "CMakeFiles/arbor.dir/profile/meter_manager.cpp.o"
+  "CMakeFiles/arbor.dir/profile/meter_manager.cpp.o.d"
+  "CMakeFiles/arbor.dir/profile/power_meter.cpp.o"
+  "CMakeFiles/arbor.dir/profile/power_meter.cpp.o.d"
+  "CMakeFiles/arbor.dir/profile/profiler.cpp.o"
+  "CMakeFiles/arbor.dir/profile/profiler.cpp.o.d"
+  "CMakeFiles/arbor.dir/s_expr.cpp.o"
+  "CMakeFiles/arbor.dir/s_expr.cpp.o.d"
+  "CMakeFiles/arbor.dir/schedule.cpp.o"
+  "CMakeFiles/arbor.dir/schedule.cpp.o.d"
+  "CMakeFiles/arbor.dir/simulation.cpp.o"
+  "CMakeFiles/arbor.dir/simulation.cpp.o.d"
+  "CMakeFiles/arbor.dir/spike_event_io.cpp.o"
+  "CMakeFiles/arbor.dir/spike_event_io.cpp.o.d"
+  "CMakeFiles/arbor.dir/spike_source_cell_group.cpp.o"
+  "CMakeFiles/arbor.dir/spike_source_cell_group.cpp.o.d"
+  "CMakeFiles/arbor.dir/spike_trains.cpp.o"
+  "CMakeFiles/arbor.dir/spike_trains.cpp.o.d"
+  "CMakeFiles/arbor.dir/symmetric_recipe.cpp.o"
+  "CMakeFiles/arbor.dir/symmetric_recipe.cpp.o.d"
+  "CMakeFiles/arbor.dir/thread_private_spike_store.cpp.o"
+  "CMakeFiles/arbor.dir/thread_private_spike_store.cpp.o.d"
+  "CMakeFiles/arbor.dir/threading/threading.cpp.o"
+  "CMakeFiles/arbor.dir/threading/threading.cpp.o.d"
+  "CMakeFiles/arbor.dir/tree.cpp.o"
+  "CMakeFiles/arbor.dir/tree.cpp.o.d"
+  "CMakeFiles/arbor.dir/util/hostname.cpp.o"
+  "CMakeFiles/arbor.dir/util/hostname.cpp.o.d"
+  "CMakeFiles/arbor.dir/util/unwind.cpp.o"
+  "CMakeFiles/arbor.dir/util/unwind.cpp.o.d"
+  "CMakeFiles/arbor.dir/version.cpp.o"
+  "CMakeFiles/arbor.dir/version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arbor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,4 @@
+#pragma once
+
+#define arb_assert(condition) \
+(void)(false && (condition))
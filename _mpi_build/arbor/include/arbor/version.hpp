@@ -0,0 +1,12 @@
+#pragma once
+
+#define ARB_VERSION "0.5.1-dev"
+#define ARB_SOURCE_ID "2026-10-18 08:00:13 +0000 6ac4a3b877f87f638f733b4e5b0643b08fcd5ed6 modified"
+#define ARB_ARCH "native"
+
+namespace arb {
+extern const char version[];
+extern const char source_id[];
+extern const char arch[];
+}
+#define ARB_MPI_ENABLED
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../lib/libarborenv.a"
+  "../lib/libarborenv.pdb"
+  "CMakeFiles/arborenv.dir/affinity.cpp.o"
+  "CMakeFiles/arborenv.dir/affinity.cpp.o.d"
+  "CMakeFiles/arborenv.dir/concurrency.cpp.o"
+  "CMakeFiles/arborenv.dir/concurrency.cpp.o.d"
+  "CMakeFiles/arborenv.dir/default_gpu.cpp.o"
+  "CMakeFiles/arborenv.dir/default_gpu.cpp.o.d"
+  "CMakeFiles/arborenv.dir/private_gpu.cpp.o"
+  "CMakeFiles/arborenv.dir/private_gpu.cpp.o.d"
+  "CMakeFiles/arborenv.dir/topology.cpp.o"
+  "CMakeFiles/arborenv.dir/topology.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arborenv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
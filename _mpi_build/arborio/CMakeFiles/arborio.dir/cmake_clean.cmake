@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../lib/libarborio.a"
+  "../lib/libarborio.pdb"
+  "CMakeFiles/arborio.dir/gdfio.cpp.o"
+  "CMakeFiles/arborio.dir/gdfio.cpp.o.d"
+  "CMakeFiles/arborio.dir/swcio.cpp.o"
+  "CMakeFiles/arborio.dir/swcio.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arborio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "_doctrees"
+  "html"
+  "CMakeFiles/check-sphinx"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/check-sphinx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
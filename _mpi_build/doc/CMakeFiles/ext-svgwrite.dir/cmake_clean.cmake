@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "_doctrees"
+  "html"
+  "CMakeFiles/ext-svgwrite"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ext-svgwrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/brunel"
+  "../../bin/brunel.pdb"
+  "CMakeFiles/brunel.dir/brunel.cpp.o"
+  "CMakeFiles/brunel.dir/brunel.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/brunel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
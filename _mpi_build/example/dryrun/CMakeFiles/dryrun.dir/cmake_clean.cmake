@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/dryrun"
+  "../../bin/dryrun.pdb"
+  "CMakeFiles/dryrun.dir/dryrun.cpp.o"
+  "CMakeFiles/dryrun.dir/dryrun.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dryrun.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
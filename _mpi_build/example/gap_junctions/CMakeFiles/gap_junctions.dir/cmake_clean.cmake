@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/gap_junctions"
+  "../../bin/gap_junctions.pdb"
+  "CMakeFiles/gap_junctions.dir/gap_junctions.cpp.o"
+  "CMakeFiles/gap_junctions.dir/gap_junctions.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gap_junctions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
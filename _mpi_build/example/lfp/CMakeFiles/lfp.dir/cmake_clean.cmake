@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/lfp"
+  "../../bin/lfp.pdb"
+  "CMakeFiles/lfp.dir/lfp.cpp.o"
+  "CMakeFiles/lfp.dir/lfp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lfp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
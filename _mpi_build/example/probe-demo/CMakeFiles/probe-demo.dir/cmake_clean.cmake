@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/probe-demo"
+  "../../bin/probe-demo.pdb"
+  "CMakeFiles/probe-demo.dir/probe-demo.cpp.o"
+  "CMakeFiles/probe-demo.dir/probe-demo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/probe-demo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ring"
+  "../../bin/ring.pdb"
+  "CMakeFiles/ring.dir/ring.cpp.o"
+  "CMakeFiles/ring.dir/ring.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ring.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/check-sphinx_rtd_theme"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/check-sphinx_rtd_theme.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
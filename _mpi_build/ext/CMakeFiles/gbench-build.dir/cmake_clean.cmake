@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gbench-build"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/gbench-build.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
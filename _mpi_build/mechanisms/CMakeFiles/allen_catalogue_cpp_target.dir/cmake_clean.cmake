@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/allen_catalogue_cpp_target"
+  "allen_catalogue.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/allen_catalogue_cpp_target.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
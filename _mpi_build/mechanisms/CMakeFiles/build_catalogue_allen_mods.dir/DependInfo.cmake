@@ -0,0 +1,71 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_mpi_build/mechanisms/generated/allen/CaDynamics_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/CaDynamics.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/CaDynamics_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/CaDynamics.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/CaDynamics_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/CaDynamics.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_HVA_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_HVA.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_HVA_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_HVA.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_HVA_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_HVA.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_LVA_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_LVA.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_LVA_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_LVA.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_LVA_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_LVA.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ih_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Ih.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ih_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Ih.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Ih_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/Ih.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Im_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Im.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Im_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Im.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Im_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/Im.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Im_v2_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Im_v2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Im_v2_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Im_v2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Im_v2_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/Im_v2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/K_P_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/K_P.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/K_P_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/K_P.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/K_P_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/K_P.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/K_T_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/K_T.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/K_T_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/K_T.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/K_T_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/K_T.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kd_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Kd.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kd_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Kd.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kd_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/Kd.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kv2like_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Kv2like.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kv2like_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Kv2like.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kv2like_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/Kv2like.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kv3_1_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Kv3_1.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kv3_1_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Kv3_1.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Kv3_1_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/Kv3_1.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaTa_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/NaTa.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaTa_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/NaTa.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaTa_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/NaTa.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaTs_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/NaTs.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaTs_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/NaTs.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaTs_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/NaTs.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaV_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/NaV.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaV_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/NaV.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/NaV_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/NaV.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Nap_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Nap.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Nap_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/Nap.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/Nap_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/Nap.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/SK_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/SK.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/SK_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/allen/SK.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/allen/SK_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/allen/SK.hpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,72 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_catalogue_allen_mods"
+  "generated/allen/CaDynamics.hpp"
+  "generated/allen/CaDynamics_cpu.cpp"
+  "generated/allen/CaDynamics_gpu.cpp"
+  "generated/allen/CaDynamics_gpu.cu"
+  "generated/allen/Ca_HVA.hpp"
+  "generated/allen/Ca_HVA_cpu.cpp"
+  "generated/allen/Ca_HVA_gpu.cpp"
+  "generated/allen/Ca_HVA_gpu.cu"
+  "generated/allen/Ca_LVA.hpp"
+  "generated/allen/Ca_LVA_cpu.cpp"
+  "generated/allen/Ca_LVA_gpu.cpp"
+  "generated/allen/Ca_LVA_gpu.cu"
+  "generated/allen/Ih.hpp"
+  "generated/allen/Ih_cpu.cpp"
+  "generated/allen/Ih_gpu.cpp"
+  "generated/allen/Ih_gpu.cu"
+  "generated/allen/Im.hpp"
+  "generated/allen/Im_cpu.cpp"
+  "generated/allen/Im_gpu.cpp"
+  "generated/allen/Im_gpu.cu"
+  "generated/allen/Im_v2.hpp"
+  "generated/allen/Im_v2_cpu.cpp"
+  "generated/allen/Im_v2_gpu.cpp"
+  "generated/allen/Im_v2_gpu.cu"
+  "generated/allen/K_P.hpp"
+  "generated/allen/K_P_cpu.cpp"
+  "generated/allen/K_P_gpu.cpp"
+  "generated/allen/K_P_gpu.cu"
+  "generated/allen/K_T.hpp"
+  "generated/allen/K_T_cpu.cpp"
+  "generated/allen/K_T_gpu.cpp"
+  "generated/allen/K_T_gpu.cu"
+  "generated/allen/Kd.hpp"
+  "generated/allen/Kd_cpu.cpp"
+  "generated/allen/Kd_gpu.cpp"
+  "generated/allen/Kd_gpu.cu"
+  "generated/allen/Kv2like.hpp"
+  "generated/allen/Kv2like_cpu.cpp"
+  "generated/allen/Kv2like_gpu.cpp"
+  "generated/allen/Kv2like_gpu.cu"
+  "generated/allen/Kv3_1.hpp"
+  "generated/allen/Kv3_1_cpu.cpp"
+  "generated/allen/Kv3_1_gpu.cpp"
+  "generated/allen/Kv3_1_gpu.cu"
+  "generated/allen/NaTa.hpp"
+  "generated/allen/NaTa_cpu.cpp"
+  "generated/allen/NaTa_gpu.cpp"
+  "generated/allen/NaTa_gpu.cu"
+  "generated/allen/NaTs.hpp"
+  "generated/allen/NaTs_cpu.cpp"
+  "generated/allen/NaTs_gpu.cpp"
+  "generated/allen/NaTs_gpu.cu"
+  "generated/allen/NaV.hpp"
+  "generated/allen/NaV_cpu.cpp"
+  "generated/allen/NaV_gpu.cpp"
+  "generated/allen/NaV_gpu.cu"
+  "generated/allen/Nap.hpp"
+  "generated/allen/Nap_cpu.cpp"
+  "generated/allen/Nap_gpu.cpp"
+  "generated/allen/Nap_gpu.cu"
+  "generated/allen/SK.hpp"
+  "generated/allen/SK_cpu.cpp"
+  "generated/allen/SK_gpu.cpp"
+  "generated/allen/SK_gpu.cu"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/build_catalogue_allen_mods.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
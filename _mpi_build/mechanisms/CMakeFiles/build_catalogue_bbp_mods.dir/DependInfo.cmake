@@ -0,0 +1,59 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/CaDynamics_E2_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/CaDynamics_E2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/CaDynamics_E2_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/CaDynamics_E2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/CaDynamics_E2_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/CaDynamics_E2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_HVA_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_HVA.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_HVA_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_HVA.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_HVA_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_HVA.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_LVAst_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_LVAst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_LVAst_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_LVAst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_LVAst_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_LVAst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ih_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/Ih.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ih_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/Ih.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Ih_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/Ih.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Im_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/Im.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Im_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/Im.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Im_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/Im.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Pst_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Pst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Pst_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Pst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Pst_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Pst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Tst_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Tst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Tst_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Tst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Tst_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Tst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTa_t_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTa_t.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTa_t_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTa_t.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTa_t_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTa_t.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTs2_t_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTs2_t.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTs2_t_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTs2_t.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTs2_t_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTs2_t.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Nap_Et2_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/Nap_Et2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Nap_Et2_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/Nap_Et2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/Nap_Et2_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/Nap_Et2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/SK_E2_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/SK_E2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/SK_E2_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/SK_E2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/SK_E2_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/SK_E2.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/SKv3_1_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/SKv3_1.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/SKv3_1_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/bbp/SKv3_1.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/bbp/SKv3_1_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/bbp/SKv3_1.hpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,56 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_catalogue_bbp_mods"
+  "generated/bbp/CaDynamics_E2.hpp"
+  "generated/bbp/CaDynamics_E2_cpu.cpp"
+  "generated/bbp/CaDynamics_E2_gpu.cpp"
+  "generated/bbp/CaDynamics_E2_gpu.cu"
+  "generated/bbp/Ca_HVA.hpp"
+  "generated/bbp/Ca_HVA_cpu.cpp"
+  "generated/bbp/Ca_HVA_gpu.cpp"
+  "generated/bbp/Ca_HVA_gpu.cu"
+  "generated/bbp/Ca_LVAst.hpp"
+  "generated/bbp/Ca_LVAst_cpu.cpp"
+  "generated/bbp/Ca_LVAst_gpu.cpp"
+  "generated/bbp/Ca_LVAst_gpu.cu"
+  "generated/bbp/Ih.hpp"
+  "generated/bbp/Ih_cpu.cpp"
+  "generated/bbp/Ih_gpu.cpp"
+  "generated/bbp/Ih_gpu.cu"
+  "generated/bbp/Im.hpp"
+  "generated/bbp/Im_cpu.cpp"
+  "generated/bbp/Im_gpu.cpp"
+  "generated/bbp/Im_gpu.cu"
+  "generated/bbp/K_Pst.hpp"
+  "generated/bbp/K_Pst_cpu.cpp"
+  "generated/bbp/K_Pst_gpu.cpp"
+  "generated/bbp/K_Pst_gpu.cu"
+  "generated/bbp/K_Tst.hpp"
+  "generated/bbp/K_Tst_cpu.cpp"
+  "generated/bbp/K_Tst_gpu.cpp"
+  "generated/bbp/K_Tst_gpu.cu"
+  "generated/bbp/NaTa_t.hpp"
+  "generated/bbp/NaTa_t_cpu.cpp"
+  "generated/bbp/NaTa_t_gpu.cpp"
+  "generated/bbp/NaTa_t_gpu.cu"
+  "generated/bbp/NaTs2_t.hpp"
+  "generated/bbp/NaTs2_t_cpu.cpp"
+  "generated/bbp/NaTs2_t_gpu.cpp"
+  "generated/bbp/NaTs2_t_gpu.cu"
+  "generated/bbp/Nap_Et2.hpp"
+  "generated/bbp/Nap_Et2_cpu.cpp"
+  "generated/bbp/Nap_Et2_gpu.cpp"
+  "generated/bbp/Nap_Et2_gpu.cu"
+  "generated/bbp/SK_E2.hpp"
+  "generated/bbp/SK_E2_cpu.cpp"
+  "generated/bbp/SK_E2_gpu.cpp"
+  "generated/bbp/SK_E2_gpu.cu"
+  "generated/bbp/SKv3_1.hpp"
+  "generated/bbp/SKv3_1_cpu.cpp"
+  "generated/bbp/SKv3_1_gpu.cpp"
+  "generated/bbp/SKv3_1_gpu.cu"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/build_catalogue_bbp_mods.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
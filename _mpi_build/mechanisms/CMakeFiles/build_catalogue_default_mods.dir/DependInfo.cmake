@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_mpi_build/mechanisms/generated/default/exp2syn_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/exp2syn.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/exp2syn_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/exp2syn.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/exp2syn_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/default/exp2syn.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/expsyn_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/expsyn.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/expsyn_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/expsyn.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/expsyn_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/default/expsyn.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/hh_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/hh.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/hh_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/hh.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/hh_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/default/hh.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/kamt_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/kamt.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/kamt_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/kamt.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/kamt_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/default/kamt.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/kdrmt_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/kdrmt.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/kdrmt_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/kdrmt.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/kdrmt_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/default/kdrmt.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/nax_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/nax.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/nax_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/nax.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/nax_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/default/nax.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/nernst_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/nernst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/nernst_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/nernst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/nernst_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/default/nernst.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/pas_cpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/pas.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/pas_gpu.cpp" "/root/repo/_mpi_build/mechanisms/generated/default/pas.hpp"
+  "/root/repo/_mpi_build/mechanisms/generated/default/pas_gpu.cu" "/root/repo/_mpi_build/mechanisms/generated/default/pas.hpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,40 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_catalogue_default_mods"
+  "generated/default/exp2syn.hpp"
+  "generated/default/exp2syn_cpu.cpp"
+  "generated/default/exp2syn_gpu.cpp"
+  "generated/default/exp2syn_gpu.cu"
+  "generated/default/expsyn.hpp"
+  "generated/default/expsyn_cpu.cpp"
+  "generated/default/expsyn_gpu.cpp"
+  "generated/default/expsyn_gpu.cu"
+  "generated/default/hh.hpp"
+  "generated/default/hh_cpu.cpp"
+  "generated/default/hh_gpu.cpp"
+  "generated/default/hh_gpu.cu"
+  "generated/default/kamt.hpp"
+  "generated/default/kamt_cpu.cpp"
+  "generated/default/kamt_gpu.cpp"
+  "generated/default/kamt_gpu.cu"
+  "generated/default/kdrmt.hpp"
+  "generated/default/kdrmt_cpu.cpp"
+  "generated/default/kdrmt_gpu.cpp"
+  "generated/default/kdrmt_gpu.cu"
+  "generated/default/nax.hpp"
+  "generated/default/nax_cpu.cpp"
+  "generated/default/nax_gpu.cpp"
+  "generated/default/nax_gpu.cu"
+  "generated/default/nernst.hpp"
+  "generated/default/nernst_cpu.cpp"
+  "generated/default/nernst_gpu.cpp"
+  "generated/default/nernst_gpu.cu"
+  "generated/default/pas.hpp"
+  "generated/default/pas_cpu.cpp"
+  "generated/default/pas_gpu.cpp"
+  "generated/default/pas_gpu.cu"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/build_catalogue_default_mods.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,69 @@
+// Automatically generated by:
+// /root/repo/mechanisms/generate_catalogue -A arbor -I /root/repo/_mpi_build/mechanisms/generated/allen -o /root/repo/_mpi_build/mechanisms/allen_catalogue.cpp -B multicore -C allen -N arb::allen_catalogue CaDynamics Ca_HVA Ca_LVA Ih Im Im_v2 K_P K_T Kd Kv2like Kv3_1 NaTa NaTs NaV Nap SK
+
+#include <arbor/mechcat.hpp>
+#include "backends/multicore/fvm.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/CaDynamics.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_HVA.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/Ca_LVA.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/Ih.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/Im.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/Im_v2.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/K_P.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/K_T.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/Kd.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/Kv2like.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/Kv3_1.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/NaTa.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/NaTs.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/NaV.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/Nap.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/allen/SK.hpp"
+using namespace arb::allen_catalogue;
+
+namespace arb {
+
+mechanism_catalogue build_allen_catalogue() {
+    mechanism_catalogue cat;
+
+    cat.add("CaDynamics", mechanism_CaDynamics_info());
+    cat.add("Ca_HVA", mechanism_Ca_HVA_info());
+    cat.add("Ca_LVA", mechanism_Ca_LVA_info());
+    cat.add("Ih", mechanism_Ih_info());
+    cat.add("Im", mechanism_Im_info());
+    cat.add("Im_v2", mechanism_Im_v2_info());
+    cat.add("K_P", mechanism_K_P_info());
+    cat.add("K_T", mechanism_K_T_info());
+    cat.add("Kd", mechanism_Kd_info());
+    cat.add("Kv2like", mechanism_Kv2like_info());
+    cat.add("Kv3_1", mechanism_Kv3_1_info());
+    cat.add("NaTa", mechanism_NaTa_info());
+    cat.add("NaTs", mechanism_NaTs_info());
+    cat.add("NaV", mechanism_NaV_info());
+    cat.add("Nap", mechanism_Nap_info());
+    cat.add("SK", mechanism_SK_info());
+    cat.register_implementation("CaDynamics", make_mechanism_CaDynamics<multicore::backend>());
+    cat.register_implementation("Ca_HVA", make_mechanism_Ca_HVA<multicore::backend>());
+    cat.register_implementation("Ca_LVA", make_mechanism_Ca_LVA<multicore::backend>());
+    cat.register_implementation("Ih", make_mechanism_Ih<multicore::backend>());
+    cat.register_implementation("Im", make_mechanism_Im<multicore::backend>());
+    cat.register_implementation("Im_v2", make_mechanism_Im_v2<multicore::backend>());
+    cat.register_implementation("K_P", make_mechanism_K_P<multicore::backend>());
+    cat.register_implementation("K_T", make_mechanism_K_T<multicore::backend>());
+    cat.register_implementation("Kd", make_mechanism_Kd<multicore::backend>());
+    cat.register_implementation("Kv2like", make_mechanism_Kv2like<multicore::backend>());
+    cat.register_implementation("Kv3_1", make_mechanism_Kv3_1<multicore::backend>());
+    cat.register_implementation("NaTa", make_mechanism_NaTa<multicore::backend>());
+    cat.register_implementation("NaTs", make_mechanism_NaTs<multicore::backend>());
+    cat.register_implementation("NaV", make_mechanism_NaV<multicore::backend>());
+    cat.register_implementation("Nap", make_mechanism_Nap<multicore::backend>());
+    cat.register_implementation("SK", make_mechanism_SK<multicore::backend>());
+    return cat;
+}
+
+const mechanism_catalogue& global_allen_catalogue() {
+    static mechanism_catalogue cat = build_allen_catalogue();
+    return cat;
+}
+
+} // namespace arb
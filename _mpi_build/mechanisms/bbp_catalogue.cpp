@@ -0,0 +1,57 @@
+// Automatically generated by:
+// /root/repo/mechanisms/generate_catalogue -A arbor -I /root/repo/_mpi_build/mechanisms/generated/bbp -o /root/repo/_mpi_build/mechanisms/bbp_catalogue.cpp -B multicore -C bbp -N arb::bbp_catalogue CaDynamics_E2 Ca_HVA Ca_LVAst Ih Im K_Pst K_Tst Nap_Et2 NaTa_t NaTs2_t SK_E2 SKv3_1
+
+#include <arbor/mechcat.hpp>
+#include "backends/multicore/fvm.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/CaDynamics_E2.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_HVA.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/Ca_LVAst.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/Ih.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/Im.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Pst.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/K_Tst.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/Nap_Et2.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTa_t.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/NaTs2_t.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/SK_E2.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/bbp/SKv3_1.hpp"
+using namespace arb::bbp_catalogue;
+
+namespace arb {
+
+mechanism_catalogue build_bbp_catalogue() {
+    mechanism_catalogue cat;
+
+    cat.add("CaDynamics_E2", mechanism_CaDynamics_E2_info());
+    cat.add("Ca_HVA", mechanism_Ca_HVA_info());
+    cat.add("Ca_LVAst", mechanism_Ca_LVAst_info());
+    cat.add("Ih", mechanism_Ih_info());
+    cat.add("Im", mechanism_Im_info());
+    cat.add("K_Pst", mechanism_K_Pst_info());
+    cat.add("K_Tst", mechanism_K_Tst_info());
+    cat.add("Nap_Et2", mechanism_Nap_Et2_info());
+    cat.add("NaTa_t", mechanism_NaTa_t_info());
+    cat.add("NaTs2_t", mechanism_NaTs2_t_info());
+    cat.add("SK_E2", mechanism_SK_E2_info());
+    cat.add("SKv3_1", mechanism_SKv3_1_info());
+    cat.register_implementation("CaDynamics_E2", make_mechanism_CaDynamics_E2<multicore::backend>());
+    cat.register_implementation("Ca_HVA", make_mechanism_Ca_HVA<multicore::backend>());
+    cat.register_implementation("Ca_LVAst", make_mechanism_Ca_LVAst<multicore::backend>());
+    cat.register_implementation("Ih", make_mechanism_Ih<multicore::backend>());
+    cat.register_implementation("Im", make_mechanism_Im<multicore::backend>());
+    cat.register_implementation("K_Pst", make_mechanism_K_Pst<multicore::backend>());
+    cat.register_implementation("K_Tst", make_mechanism_K_Tst<multicore::backend>());
+    cat.register_implementation("Nap_Et2", make_mechanism_Nap_Et2<multicore::backend>());
+    cat.register_implementation("NaTa_t", make_mechanism_NaTa_t<multicore::backend>());
+    cat.register_implementation("NaTs2_t", make_mechanism_NaTs2_t<multicore::backend>());
+    cat.register_implementation("SK_E2", make_mechanism_SK_E2<multicore::backend>());
+    cat.register_implementation("SKv3_1", make_mechanism_SKv3_1<multicore::backend>());
+    return cat;
+}
+
+const mechanism_catalogue& global_bbp_catalogue() {
+    static mechanism_catalogue cat = build_bbp_catalogue();
+    return cat;
+}
+
+} // namespace arb
@@ -0,0 +1,45 @@
+// Automatically generated by:
+// /root/repo/mechanisms/generate_catalogue -A arbor -I /root/repo/_mpi_build/mechanisms/generated/default -o /root/repo/_mpi_build/mechanisms/default_catalogue.cpp -B multicore -C default -N arb::default_catalogue exp2syn expsyn hh kamt kdrmt nax nernst pas
+
+#include <arbor/mechcat.hpp>
+#include "backends/multicore/fvm.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/default/exp2syn.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/default/expsyn.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/default/hh.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/default/kamt.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/default/kdrmt.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/default/nax.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/default/nernst.hpp"
+#include "/root/repo/_mpi_build/mechanisms/generated/default/pas.hpp"
+using namespace arb::default_catalogue;
+
+namespace arb {
+
+mechanism_catalogue build_default_catalogue() {
+    mechanism_catalogue cat;
+
+    cat.add("exp2syn", mechanism_exp2syn_info());
+    cat.add("expsyn", mechanism_expsyn_info());
+    cat.add("hh", mechanism_hh_info());
+    cat.add("kamt", mechanism_kamt_info());
+    cat.add("kdrmt", mechanism_kdrmt_info());
+    cat.add("nax", mechanism_nax_info());
+    cat.add("nernst", mechanism_nernst_info());
+    cat.add("pas", mechanism_pas_info());
+    cat.register_implementation("exp2syn", make_mechanism_exp2syn<multicore::backend>());
+    cat.register_implementation("expsyn", make_mechanism_expsyn<multicore::backend>());
+    cat.register_implementation("hh", make_mechanism_hh<multicore::backend>());
+    cat.register_implementation("kamt", make_mechanism_kamt<multicore::backend>());
+    cat.register_implementation("kdrmt", make_mechanism_kdrmt<multicore::backend>());
+    cat.register_implementation("nax", make_mechanism_nax<multicore::backend>());
+    cat.register_implementation("nernst", make_mechanism_nernst<multicore::backend>());
+    cat.register_implementation("pas", make_mechanism_pas<multicore::backend>());
+    return cat;
+}
+
+const mechanism_catalogue& global_default_catalogue() {
+    static mechanism_catalogue cat = build_default_catalogue();
+    return cat;
+}
+
+} // namespace arb
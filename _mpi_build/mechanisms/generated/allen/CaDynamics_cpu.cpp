@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_CaDynamics: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "CaDynamics"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_CaDynamics()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"F", &F}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"gamma", &gamma},
+            {"cai", &cai},
+            {"depth", &depth},
+            {"decay", &decay},
+            {"minCai", &minCai}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gamma", 0.050000000000000003},
+            {"depth", 0.10000000000000001},
+            {"decay", 80.0},
+            {"minCai", 0.0001}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"cai", &cai}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"ca", &ion_ca_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"ca", &ion_ca_index_}
+        };
+    }
+
+private:
+    value_type F = 96485.332123310014;
+    value_type* gamma;
+    value_type* cai;
+    value_type* depth;
+    value_type* decay;
+    value_type* minCai;
+    ion_state_view ion_ca_;
+    iarray ion_ca_index_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_CaDynamics();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_CaDynamics<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_CaDynamics());
+}
+
+void mechanism_cpu_CaDynamics::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        cai[i_] = minCai[i_];
+    }
+}
+
+void mechanism_cpu_CaDynamics::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_CaDynamics::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_CaDynamics::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_CaDynamics::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_ca_index_i_ = ion_ca_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type ica = 0.10000000000000001*ion_ca_.current_density[ion_ca_index_i_];
+        value_type ba_0_, a_0_, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        a_0_ =  -( 1.0/decay[i_]);
+        ba_0_ = ( -10000.0*ica*gamma[i_]/( 2.0*F*depth[i_])- -minCai[i_]/decay[i_])/a_0_;
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        cai[i_] =  -ba_0_+(cai[i_]+ba_0_)*ll1_;
+    }
+}
+
+void mechanism_cpu_CaDynamics::nrn_current_range(size_type begin_, size_type end_) {
+}
+
+void mechanism_cpu_CaDynamics::write_ions_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_ca_index_i_ = ion_ca_index_[i_];
+        value_type cai_shadowed_ = 0;
+        cai_shadowed_ = cai[i_];
+        ion_ca_.internal_concentration[ion_ca_index_i_] = fma(weight_[i_], cai_shadowed_, ion_ca_.internal_concentration[ion_ca_index_i_]);
+    }
+}
+
+} // namespace allen_catalogue
+} // namespace arb
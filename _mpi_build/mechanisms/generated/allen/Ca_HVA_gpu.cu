@@ -0,0 +1,133 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_Ca_HVA_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* h;
+    value_type* m;
+    value_type* gbar;
+    ion_state_view ion_ca_;
+    const index_type* ion_ca_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_Ca_HVA_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type mBeta, mAlpha, hBeta, hAlpha, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        ll0_ =  -27.0-v;
+        ll1_ =  3.7999999999999998*exprelr(ll0_* 0.26315789473684209);
+        mAlpha =  0.055*ll1_;
+        mBeta =  0.93999999999999995*exp(( -75.0-v)* 0.058823529411764705);
+        params_.m[tid_] = mAlpha/(mAlpha+mBeta);
+        hAlpha =  0.000457*exp(( -13.0-v)* 0.02);
+        hBeta =  0.0064999999999999997/(exp(( -v- 15.0)* 0.035714285714285712)+ 1.0);
+        params_.h[tid_] = hAlpha/(hAlpha+hBeta);
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_Ca_HVA_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type a_1_, a_0_, ll3_, ll1_, ll2_, hBeta, hAlpha, ll0_, hRat, ba_0_, ll5_, ll4_, mAlpha, ba_1_, mBeta, mRat;
+        ll5_ =  0.;
+        ll4_ =  0.;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        ll0_ =  -27.0-v;
+        ll1_ =  3.7999999999999998*exprelr(ll0_* 0.26315789473684209);
+        mAlpha =  0.055*ll1_;
+        mBeta =  0.93999999999999995*exp(( -75.0-v)* 0.058823529411764705);
+        mRat = mAlpha+mBeta;
+        hAlpha =  0.000457*exp(( -13.0-v)* 0.02);
+        hBeta =  0.0064999999999999997/(exp(( -v- 15.0)* 0.035714285714285712)+ 1.0);
+        hRat = hAlpha+hBeta;
+        a_0_ =  -mRat;
+        ba_0_ = mAlpha/a_0_;
+        ll2_ = a_0_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        params_.m[tid_] =  -ba_0_+(params_.m[tid_]+ba_0_)*ll3_;
+        a_1_ =  -hRat;
+        ba_1_ = hAlpha/a_1_;
+        ll4_ = a_1_*dt;
+        ll5_ = ( 1.0+ 0.5*ll4_)/( 1.0- 0.5*ll4_);
+        params_.h[tid_] =  -ba_1_+(params_.h[tid_]+ba_1_)*ll5_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_Ca_HVA_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_ca_index_i_ = params_.ion_ca_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type eca = params_.ion_ca_.reversal_potential[ion_ca_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ica = 0;
+        ica = params_.gbar[tid_]*params_.m[tid_]*params_.m[tid_]*params_.h[tid_]*(v-eca);
+        current_ = ica;
+        conductivity_ = params_.gbar[tid_]*params_.m[tid_]*params_.m[tid_]*params_.h[tid_];
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+        params_.ion_ca_.current_density[ion_ca_index_i_] = fma(10.0*params_.weight_[tid_], ica, params_.ion_ca_.current_density[ion_ca_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_Ca_HVA_nrn_init_(mechanism_gpu_Ca_HVA_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Ca_HVA_nrn_current_(mechanism_gpu_Ca_HVA_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Ca_HVA_nrn_state_(mechanism_gpu_Ca_HVA_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Ca_HVA_write_ions_(mechanism_gpu_Ca_HVA_pp_& p) {}
+
+} // namespace allen_catalogue
+} // namespace arb
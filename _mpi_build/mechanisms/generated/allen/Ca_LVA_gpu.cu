@@ -0,0 +1,121 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_Ca_LVA_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* qt;
+    value_type* h;
+    value_type* m;
+    value_type* gbar;
+    ion_state_view ion_ca_;
+    const index_type* ion_ca_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_Ca_LVA_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type celsius = params_.temperature_degC_[node_index_i_];
+        params_.qt[tid_] = pow( 2.2999999999999998, (celsius- 21.0)* 0.10000000000000001);
+        params_.m[tid_] =  1.0/( 1.0+exp((v+ 40.0)* -0.16666666666666666));
+        params_.h[tid_] =  1.0/( 1.0+exp((v+ 90.0)* 0.15625));
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_Ca_LVA_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type ba_1_, ll1_, mInf, ll2_, ba_0_, a_1_, ll3_, hInf, ll0_, hRat, mRat, a_0_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        mInf =  1.0/( 1.0+exp((v+ 40.0)* -0.16666666666666666));
+        hInf =  1.0/( 1.0+exp((v+ 90.0)* 0.15625));
+        mRat = params_.qt[tid_]/( 5.0+ 20.0/( 1.0+exp((v+ 35.0)* 0.20000000000000001)));
+        hRat = params_.qt[tid_]/( 20.0+ 50.0/( 1.0+exp((v+ 50.0)* 0.14285714285714285)));
+        a_0_ =  -1.0*mRat;
+        ba_0_ = mInf*mRat/a_0_;
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        params_.m[tid_] =  -ba_0_+(params_.m[tid_]+ba_0_)*ll1_;
+        a_1_ =  -1.0*hRat;
+        ba_1_ = hInf*hRat/a_1_;
+        ll2_ = a_1_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        params_.h[tid_] =  -ba_1_+(params_.h[tid_]+ba_1_)*ll3_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_Ca_LVA_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_ca_index_i_ = params_.ion_ca_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type eca = params_.ion_ca_.reversal_potential[ion_ca_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ica = 0;
+        ica = params_.gbar[tid_]*params_.m[tid_]*params_.m[tid_]*params_.h[tid_]*(v-eca);
+        current_ = ica;
+        conductivity_ = params_.gbar[tid_]*params_.m[tid_]*params_.m[tid_]*params_.h[tid_];
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+        params_.ion_ca_.current_density[ion_ca_index_i_] = fma(10.0*params_.weight_[tid_], ica, params_.ion_ca_.current_density[ion_ca_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_Ca_LVA_nrn_init_(mechanism_gpu_Ca_LVA_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Ca_LVA_nrn_current_(mechanism_gpu_Ca_LVA_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Ca_LVA_nrn_state_(mechanism_gpu_Ca_LVA_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Ca_LVA_write_ions_(mechanism_gpu_Ca_LVA_pp_& p) {}
+
+} // namespace allen_catalogue
+} // namespace arb
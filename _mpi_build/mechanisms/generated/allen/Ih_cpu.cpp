@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_Ih: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "Ih"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_Ih()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"ehcn", &ehcn}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"m", &m},
+            {"gbar", &gbar}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &m}
+        };
+    }
+
+private:
+    value_type ehcn = -45.0;
+    value_type* m;
+    value_type* gbar;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_Ih();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_Ih<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_Ih());
+}
+
+void mechanism_cpu_Ih::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type mBeta, mAlpha, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        ll0_ = v+ 154.90000000000001;
+        ll1_ =  11.9*exprelr(ll0_* 0.084033613445378144);
+        mAlpha =  0.00643*ll1_;
+        mBeta =  0.193*exp(v* 0.030211480362537763);
+        m[i_] = mAlpha/(mAlpha+mBeta);
+    }
+}
+
+void mechanism_cpu_Ih::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_Ih::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_Ih::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_Ih::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type mRat, a_0_, mBeta, mAlpha, ll0_, ba_0_, ll2_, ll1_, ll3_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        ll0_ = v+ 154.90000000000001;
+        ll1_ =  11.9*exprelr(ll0_* 0.084033613445378144);
+        mAlpha =  0.00643*ll1_;
+        mBeta =  0.193*exp(v* 0.030211480362537763);
+        mRat = mAlpha+mBeta;
+        a_0_ =  -mRat;
+        ba_0_ = mAlpha/a_0_;
+        ll2_ = a_0_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        m[i_] =  -ba_0_+(m[i_]+ba_0_)*ll3_;
+    }
+}
+
+void mechanism_cpu_Ih::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type v = vec_v_[node_index_i_];
+        value_type ihcn = 0;
+        ihcn = gbar[i_]*m[i_]*(v-ehcn);
+        current_ = ihcn;
+        conductivity_ = gbar[i_]*m[i_];
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+    }
+}
+
+void mechanism_cpu_Ih::write_ions_range(size_type begin_, size_type end_) {
+}
+
+} // namespace allen_catalogue
+} // namespace arb
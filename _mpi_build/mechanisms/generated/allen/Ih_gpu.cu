@@ -0,0 +1,115 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_Ih_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type ehcn = -45.0;
+    value_type* m;
+    value_type* gbar;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_Ih_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type mBeta, mAlpha, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        ll0_ = v+ 154.90000000000001;
+        ll1_ =  11.9*exprelr(ll0_* 0.084033613445378144);
+        mAlpha =  0.00643*ll1_;
+        mBeta =  0.193*exp(v* 0.030211480362537763);
+        params_.m[tid_] = mAlpha/(mAlpha+mBeta);
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_Ih_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type mRat, a_0_, mBeta, mAlpha, ll0_, ba_0_, ll2_, ll1_, ll3_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        ll0_ = v+ 154.90000000000001;
+        ll1_ =  11.9*exprelr(ll0_* 0.084033613445378144);
+        mAlpha =  0.00643*ll1_;
+        mBeta =  0.193*exp(v* 0.030211480362537763);
+        mRat = mAlpha+mBeta;
+        a_0_ =  -mRat;
+        ba_0_ = mAlpha/a_0_;
+        ll2_ = a_0_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        params_.m[tid_] =  -ba_0_+(params_.m[tid_]+ba_0_)*ll3_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_Ih_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ihcn = 0;
+        ihcn = params_.gbar[tid_]*params_.m[tid_]*(v-params_.ehcn);
+        current_ = ihcn;
+        conductivity_ = params_.gbar[tid_]*params_.m[tid_];
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_Ih_nrn_init_(mechanism_gpu_Ih_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Ih_nrn_current_(mechanism_gpu_Ih_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Ih_nrn_state_(mechanism_gpu_Ih_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Ih_write_ions_(mechanism_gpu_Ih_pp_& p) {}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_Im: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "Im"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_Im()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"mTau", &mTau},
+            {"mAlpha", &mAlpha},
+            {"gbar", &gbar},
+            {"g", &g},
+            {"mBeta", &mBeta},
+            {"celsius", &celsius},
+            {"m", &m},
+            {"mInf", &mInf}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &ion_k_index_}
+        };
+    }
+
+private:
+    value_type* mTau;
+    value_type* mAlpha;
+    value_type* gbar;
+    value_type* g;
+    value_type* mBeta;
+    value_type* celsius;
+    value_type* m;
+    value_type* mInf;
+    ion_state_view ion_k_;
+    iarray ion_k_index_;
+    void rates(int i_, value_type v);
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_Im();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_Im<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_Im());
+}
+
+void mechanism_cpu_Im::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type v = vec_v_[node_index_i_];
+        rates(i_, v);
+        m[i_] = mInf[i_];
+    }
+}
+
+void mechanism_cpu_Im::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_Im::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_Im::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_Im::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type b_0_, a_0_, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        rates(i_, v);
+        a_0_ = mTau[i_];
+        b_0_ = mInf[i_];
+        ll0_ =  -dt/a_0_;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        m[i_] = b_0_+(m[i_]-b_0_)*ll1_;
+    }
+}
+
+void mechanism_cpu_Im::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_k_index_i_ = ion_k_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ek = ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type ik = 0;
+        g[i_] = gbar[i_]*m[i_];
+        ik = g[i_]*(v-ek);
+        current_ = ik;
+        conductivity_ = g[i_];
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+        ion_k_.current_density[ion_k_index_i_] = fma(10.0*weight_[i_], ik, ion_k_.current_density[ion_k_index_i_]);
+    }
+}
+
+void mechanism_cpu_Im::write_ions_range(size_type begin_, size_type end_) {
+}
+
+void mechanism_cpu_Im::rates(int i_, value_type v) {
+    value_type qt;
+    qt = pow( 2.2999999999999998, (celsius[i_]- 21.0)* 0.10000000000000001);
+    mAlpha[i_] =  0.0033*exp( 0.10000000000000001*(v- -35.0));
+    mBeta[i_] =  0.0033*exp( -0.10000000000000001*(v- -35.0));
+    mInf[i_] = mAlpha[i_]/(mAlpha[i_]+mBeta[i_]);
+    mTau[i_] =  1.0/(mAlpha[i_]+mBeta[i_])/qt;
+}
+
+} // namespace allen_catalogue
+} // namespace arb
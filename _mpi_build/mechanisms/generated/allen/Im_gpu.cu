@@ -0,0 +1,124 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_Im_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* mTau;
+    value_type* mAlpha;
+    value_type* gbar;
+    value_type* g;
+    value_type* mBeta;
+    value_type* celsius;
+    value_type* m;
+    value_type* mInf;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__device__
+void rates(mechanism_gpu_Im_pp_ params_, int tid_, value_type v) {
+    value_type qt;
+    qt = pow( 2.2999999999999998, (params_.celsius[tid_]- 21.0)* 0.10000000000000001);
+    params_.mAlpha[tid_] =  0.0033*exp( 0.10000000000000001*(v- -35.0));
+    params_.mBeta[tid_] =  0.0033*exp( -0.10000000000000001*(v- -35.0));
+    params_.mInf[tid_] = params_.mAlpha[tid_]/(params_.mAlpha[tid_]+params_.mBeta[tid_]);
+    params_.mTau[tid_] =  1.0/(params_.mAlpha[tid_]+params_.mBeta[tid_])/qt;
+}
+
+__global__
+void nrn_init(mechanism_gpu_Im_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        rates(params_, tid_, v);
+        params_.m[tid_] = params_.mInf[tid_];
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_Im_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type b_0_, a_0_, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        rates(params_, tid_, v);
+        a_0_ = params_.mTau[tid_];
+        b_0_ = params_.mInf[tid_];
+        ll0_ =  -dt/a_0_;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        params_.m[tid_] = b_0_+(params_.m[tid_]-b_0_)*ll1_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_Im_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_k_index_i_ = params_.ion_k_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ek = params_.ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ik = 0;
+        params_.g[tid_] = params_.gbar[tid_]*params_.m[tid_];
+        ik = params_.g[tid_]*(v-ek);
+        current_ = ik;
+        conductivity_ = params_.g[tid_];
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+        params_.ion_k_.current_density[ion_k_index_i_] = fma(10.0*params_.weight_[tid_], ik, params_.ion_k_.current_density[ion_k_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_Im_nrn_init_(mechanism_gpu_Im_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Im_nrn_current_(mechanism_gpu_Im_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Im_nrn_state_(mechanism_gpu_Im_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Im_write_ions_(mechanism_gpu_Im_pp_& p) {}
+
+} // namespace allen_catalogue
+} // namespace arb
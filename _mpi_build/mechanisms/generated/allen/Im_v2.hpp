@@ -0,0 +1,42 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_Im_v2();
+
+inline const ::arb::mechanism_info& mechanism_Im_v2_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+
+        },
+        // parameters
+        {
+            {"gbar", {spec::parameter, "S / cm2", 0.00001}}
+        },
+        // state variables
+        {
+            {"m", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+            {"k", {false, false, true, false, false, false, 0}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        0
+    };
+
+    return info;
+}
+
+} // namespace allen_catalogue
+} // namespace arb
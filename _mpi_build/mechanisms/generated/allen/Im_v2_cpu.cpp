@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_Im_v2: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "Im_v2"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_Im_v2()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"m", &m},
+            {"gbar", &gbar}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &ion_k_index_}
+        };
+    }
+
+private:
+    value_type* m;
+    value_type* gbar;
+    ion_state_view ion_k_;
+    iarray ion_k_index_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_Im_v2();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_Im_v2<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_Im_v2());
+}
+
+void mechanism_cpu_Im_v2::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type mBeta, mAlpha;
+        mAlpha =  0.0070000000000000001*exp( 2.4000000000000004*(v+ 48.0)* 0.038284839203675342);
+        mBeta =  0.0070000000000000001*exp( -3.5999999999999996*(v+ 48.0)* 0.038284839203675342);
+        m[i_] = mAlpha/(mAlpha+mBeta);
+    }
+}
+
+void mechanism_cpu_Im_v2::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_Im_v2::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_Im_v2::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_Im_v2::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type celsius = temperature_degC_[node_index_i_];
+        value_type ba_0_, mRat, a_0_, mBeta, mAlpha, qt, iab, ll0_, mInf, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        qt = pow( 2.2999999999999998, (celsius- 30.0)* 0.10000000000000001);
+        mAlpha =  0.0070000000000000001*exp( 2.4000000000000004*(v+ 48.0)* 0.038284839203675342);
+        mBeta =  0.0070000000000000001*exp( -3.5999999999999996*(v+ 48.0)* 0.038284839203675342);
+        iab =  1.0/(mAlpha+mBeta);
+        mInf = mAlpha*iab;
+        mRat = qt/( 15.0+iab);
+        a_0_ =  -1.0*mRat;
+        ba_0_ = mInf*mRat/a_0_;
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        m[i_] =  -ba_0_+(m[i_]+ba_0_)*ll1_;
+    }
+}
+
+void mechanism_cpu_Im_v2::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_k_index_i_ = ion_k_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ek = ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type ik = 0;
+        ik = gbar[i_]*m[i_]*(v-ek);
+        current_ = ik;
+        conductivity_ = gbar[i_]*m[i_];
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+        ion_k_.current_density[ion_k_index_i_] = fma(10.0*weight_[i_], ik, ion_k_.current_density[ion_k_index_i_]);
+    }
+}
+
+void mechanism_cpu_Im_v2::write_ions_range(size_type begin_, size_type end_) {
+}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,87 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+struct mechanism_gpu_Im_v2_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* m;
+    value_type* gbar;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+};
+
+void mechanism_gpu_Im_v2_nrn_init_(mechanism_gpu_Im_v2_pp_&);
+void mechanism_gpu_Im_v2_nrn_state_(mechanism_gpu_Im_v2_pp_&);
+void mechanism_gpu_Im_v2_nrn_current_(mechanism_gpu_Im_v2_pp_&);
+void mechanism_gpu_Im_v2_write_ions_(mechanism_gpu_Im_v2_pp_&);
+
+class mechanism_gpu_Im_v2: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "Im_v2"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_Im_v2()); }
+
+    void nrn_init() override {
+        mechanism_gpu_Im_v2_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_Im_v2_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_Im_v2_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_Im_v2_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() override { return &pp_; }
+
+    mechanism_field_table field_table() override {
+        return {
+            {"m", &pp_.m},
+            {"gbar", &pp_.gbar}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &pp_.m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &pp_.ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &pp_.ion_k_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_Im_v2_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_Im_v2();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_Im_v2<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_Im_v2());
+}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,199 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_K_P: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "K_P"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_K_P()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"vshift", &vshift},
+            {"tauF", &tauF}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"hTau", &hTau},
+            {"hInf", &hInf},
+            {"mTau", &mTau},
+            {"h", &h},
+            {"gbar", &gbar},
+            {"g", &g},
+            {"celsius", &celsius},
+            {"m", &m},
+            {"mInf", &mInf}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"h", &h},
+            {"m", &m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &ion_k_index_}
+        };
+    }
+
+private:
+    value_type vshift = 0.;
+    value_type tauF = 1.0;
+    value_type* hTau;
+    value_type* hInf;
+    value_type* mTau;
+    value_type* h;
+    value_type* gbar;
+    value_type* g;
+    value_type* celsius;
+    value_type* m;
+    value_type* mInf;
+    ion_state_view ion_k_;
+    iarray ion_k_index_;
+    void rates(int i_, value_type v);
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_K_P();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_K_P<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_K_P());
+}
+
+void mechanism_cpu_K_P::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type v = vec_v_[node_index_i_];
+        rates(i_, v);
+        m[i_] = mInf[i_];
+        h[i_] = hInf[i_];
+    }
+}
+
+void mechanism_cpu_K_P::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_K_P::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_K_P::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_K_P::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type b_0_, a_0_, b_1_, ll0_, a_1_, ll2_, ll1_, ll3_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        rates(i_, v);
+        a_0_ = mTau[i_];
+        b_0_ = mInf[i_];
+        ll0_ =  -dt/a_0_;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        m[i_] = b_0_+(m[i_]-b_0_)*ll1_;
+        a_1_ = hTau[i_];
+        b_1_ = hInf[i_];
+        ll2_ =  -dt/a_1_;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        h[i_] = b_1_+(h[i_]-b_1_)*ll3_;
+    }
+}
+
+void mechanism_cpu_K_P::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_k_index_i_ = ion_k_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ek = ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type ik = 0;
+        g[i_] = gbar[i_]*m[i_]*m[i_]*h[i_];
+        ik = g[i_]*(v-ek);
+        current_ = ik;
+        conductivity_ = g[i_];
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+        ion_k_.current_density[ion_k_index_i_] = fma(10.0*weight_[i_], ik, ion_k_.current_density[ion_k_index_i_]);
+    }
+}
+
+void mechanism_cpu_K_P::write_ions_range(size_type begin_, size_type end_) {
+}
+
+void mechanism_cpu_K_P::rates(int i_, value_type v) {
+    value_type qt;
+    qt = pow( 2.2999999999999998, (celsius[i_]- 21.0)* 0.10000000000000001);
+    mInf[i_] =  1.0/( 1.0+exp( -(v-( -14.300000000000001+vshift))* 0.068493150684931503));
+    if (v< -50.0+vshift) {
+        mTau[i_] = tauF*( 1.25+ 175.03*exp( -(v-vshift)* -0.025999999999999999))/qt;
+    }
+    else {
+        mTau[i_] = tauF*( 1.25+ 13.0*exp( -(v-vshift)* 0.025999999999999999))/qt;
+    }
+    hInf[i_] =  1.0/( 1.0+exp( -(v-( -54.0+vshift))* -0.090909090909090912));
+    hTau[i_] = ( 360.0+( 1010.0+ 24.0*(v-( -55.0+vshift)))*exp(pow( -((v-( -75.0+vshift))* 0.020833333333333332),  2.0)))/qt;
+}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,140 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_K_P_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type vshift = 0.;
+    value_type tauF = 1.0;
+    value_type* hTau;
+    value_type* hInf;
+    value_type* mTau;
+    value_type* h;
+    value_type* gbar;
+    value_type* g;
+    value_type* celsius;
+    value_type* m;
+    value_type* mInf;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__device__
+void rates(mechanism_gpu_K_P_pp_ params_, int tid_, value_type v) {
+    value_type qt;
+    qt = pow( 2.2999999999999998, (params_.celsius[tid_]- 21.0)* 0.10000000000000001);
+    params_.mInf[tid_] =  1.0/( 1.0+exp( -(v-( -14.300000000000001+params_.vshift))* 0.068493150684931503));
+    if (v< -50.0+params_.vshift) {
+        params_.mTau[tid_] = params_.tauF*( 1.25+ 175.03*exp( -(v-params_.vshift)* -0.025999999999999999))/qt;
+    }
+    else {
+        params_.mTau[tid_] = params_.tauF*( 1.25+ 13.0*exp( -(v-params_.vshift)* 0.025999999999999999))/qt;
+    }
+    params_.hInf[tid_] =  1.0/( 1.0+exp( -(v-( -54.0+params_.vshift))* -0.090909090909090912));
+    params_.hTau[tid_] = ( 360.0+( 1010.0+ 24.0*(v-( -55.0+params_.vshift)))*exp(pow( -((v-( -75.0+params_.vshift))* 0.020833333333333332),  2.0)))/qt;
+}
+
+__global__
+void nrn_init(mechanism_gpu_K_P_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        rates(params_, tid_, v);
+        params_.m[tid_] = params_.mInf[tid_];
+        params_.h[tid_] = params_.hInf[tid_];
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_K_P_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type b_0_, a_0_, b_1_, ll0_, a_1_, ll2_, ll1_, ll3_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        rates(params_, tid_, v);
+        a_0_ = params_.mTau[tid_];
+        b_0_ = params_.mInf[tid_];
+        ll0_ =  -dt/a_0_;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        params_.m[tid_] = b_0_+(params_.m[tid_]-b_0_)*ll1_;
+        a_1_ = params_.hTau[tid_];
+        b_1_ = params_.hInf[tid_];
+        ll2_ =  -dt/a_1_;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        params_.h[tid_] = b_1_+(params_.h[tid_]-b_1_)*ll3_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_K_P_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_k_index_i_ = params_.ion_k_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ek = params_.ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ik = 0;
+        params_.g[tid_] = params_.gbar[tid_]*params_.m[tid_]*params_.m[tid_]*params_.h[tid_];
+        ik = params_.g[tid_]*(v-ek);
+        current_ = ik;
+        conductivity_ = params_.g[tid_];
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+        params_.ion_k_.current_density[ion_k_index_i_] = fma(10.0*params_.weight_[tid_], ik, params_.ion_k_.current_density[ion_k_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_K_P_nrn_init_(mechanism_gpu_K_P_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_K_P_nrn_current_(mechanism_gpu_K_P_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_K_P_nrn_state_(mechanism_gpu_K_P_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_K_P_write_ions_(mechanism_gpu_K_P_pp_& p) {}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_K_T: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "K_T"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_K_T()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"vshift", &vshift},
+            {"mTauF", &mTauF},
+            {"hTauF", &hTauF}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"m", &m},
+            {"gbar", &gbar},
+            {"h", &h}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &m},
+            {"h", &h}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &ion_k_index_}
+        };
+    }
+
+private:
+    value_type vshift = 0.;
+    value_type mTauF = 1.0;
+    value_type hTauF = 1.0;
+    value_type* m;
+    value_type* gbar;
+    value_type* h;
+    ion_state_view ion_k_;
+    iarray ion_k_index_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_K_T();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_K_T<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_K_T());
+}
+
+void mechanism_cpu_K_T::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type v = vec_v_[node_index_i_];
+        m[i_] =  1.0/( 1.0+exp( -(v+ 47.0-vshift)* 0.034482758620689655));
+        h[i_] =  1.0/( 1.0+exp((v+ 66.0-vshift)* 0.10000000000000001));
+    }
+}
+
+void mechanism_cpu_K_T::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_K_T::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_K_T::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_K_T::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type celsius = temperature_degC_[node_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type ba_1_, a_1_, ll1_, mInf, ll2_, ba_0_, ll3_, hInf, ll0_, hRat, mRat, qt, a_0_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        qt = pow( 2.2999999999999998, (celsius- 21.0)* 0.10000000000000001);
+        mInf =  1.0/( 1.0+exp( -(v+ 47.0-vshift)* 0.034482758620689655));
+        hInf =  1.0/( 1.0+exp((v+ 66.0-vshift)* 0.10000000000000001));
+        mRat = qt/( 0.34000000000000002+mTauF* 0.92000000000000004*exp(pow( -((v+ 71.0-vshift)* 0.016949152542372881),  2.0)));
+        hRat = qt/( 8.0+hTauF* 49.0*exp(pow( -((v+ 73.0-vshift)* 0.043478260869565216),  2.0)));
+        a_0_ =  -1.0*mRat;
+        ba_0_ = mInf*mRat/a_0_;
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        m[i_] =  -ba_0_+(m[i_]+ba_0_)*ll1_;
+        a_1_ =  -1.0*hRat;
+        ba_1_ = hInf*hRat/a_1_;
+        ll2_ = a_1_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        h[i_] =  -ba_1_+(h[i_]+ba_1_)*ll3_;
+    }
+}
+
+void mechanism_cpu_K_T::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_k_index_i_ = ion_k_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ek = ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type ik = 0;
+        ik = gbar[i_]*m[i_]*m[i_]*m[i_]*m[i_]*h[i_]*(v-ek);
+        current_ = ik;
+        conductivity_ = gbar[i_]*m[i_]*m[i_]*m[i_]*m[i_]*h[i_];
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+        ion_k_.current_density[ion_k_index_i_] = fma(10.0*weight_[i_], ik, ion_k_.current_density[ion_k_index_i_]);
+    }
+}
+
+void mechanism_cpu_K_T::write_ions_range(size_type begin_, size_type end_) {
+}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,116 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_Kd_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* m;
+    value_type* gbar;
+    value_type* h;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_Kd_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        params_.m[tid_] =  1.0- 1.0/( 1.0+exp((v+ 43.0)* 0.125));
+        params_.h[tid_] =  1.0/( 1.0+exp((v+ 67.0)* 0.13698630136986301));
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_Kd_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ba_1_, a_0_, hInf, ll0_, a_1_, ba_0_, ll2_, mInf, ll1_, ll3_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        mInf =  1.0- 1.0/( 1.0+exp((v+ 43.0)* 0.125));
+        hInf =  1.0/( 1.0+exp((v+ 67.0)* 0.13698630136986301));
+        a_0_ =  -1.0;
+        ba_0_ = mInf/a_0_;
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        params_.m[tid_] =  -ba_0_+(params_.m[tid_]+ba_0_)*ll1_;
+        a_1_ =  -0.00066666666666666664;
+        ba_1_ = hInf* 0.00066666666666666664/a_1_;
+        ll2_ = a_1_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        params_.h[tid_] =  -ba_1_+(params_.h[tid_]+ba_1_)*ll3_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_Kd_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_k_index_i_ = params_.ion_k_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ek = params_.ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ik = 0;
+        ik = params_.gbar[tid_]*params_.m[tid_]*params_.h[tid_]*(v-ek);
+        current_ = ik;
+        conductivity_ = params_.gbar[tid_]*params_.m[tid_]*params_.h[tid_];
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+        params_.ion_k_.current_density[ion_k_index_i_] = fma(10.0*params_.weight_[tid_], ik, params_.ion_k_.current_density[ion_k_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_Kd_nrn_init_(mechanism_gpu_Kd_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Kd_nrn_current_(mechanism_gpu_Kd_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Kd_nrn_state_(mechanism_gpu_Kd_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Kd_write_ions_(mechanism_gpu_Kd_pp_& p) {}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_Kv2like: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "Kv2like"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_Kv2like()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"h2", &h2},
+            {"m", &m},
+            {"h1", &h1},
+            {"gbar", &gbar}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"h2", &h2},
+            {"m", &m},
+            {"h1", &h1}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &ion_k_index_}
+        };
+    }
+
+private:
+    value_type* h2;
+    value_type* m;
+    value_type* h1;
+    value_type* gbar;
+    ion_state_view ion_k_;
+    iarray ion_k_index_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_Kv2like();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_Kv2like<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_Kv2like());
+}
+
+void mechanism_cpu_Kv2like::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type mBeta, mAlpha, hInf, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        ll0_ =  43.0-v;
+        ll1_ =  11.0*exprelr(ll0_* 0.090909090909090912);
+        mAlpha =  0.12*ll1_;
+        mBeta =  0.02*exp( -(v+ 1.27)* 0.0083333333333333332);
+        hInf =  1.0/( 1.0+exp((v+ 58.0)* 0.090909090909090912));
+        m[i_] = mAlpha/(mAlpha+mBeta);
+        h1[i_] = hInf;
+        h2[i_] = hInf;
+    }
+}
+
+void mechanism_cpu_Kv2like::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_Kv2like::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_Kv2like::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_Kv2like::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type celsius = temperature_degC_[node_index_i_];
+        value_type ba_2_, a_2_, qt, mRat, ll7_, a_1_, ll6_, ll1_, ll2_, ll0_, a_0_, h1Rat, h2Rat, ba_1_, mBeta, ll3_, hInf, ba_0_, ll5_, ll4_, mAlpha;
+        ll7_ =  0.;
+        ll6_ =  0.;
+        ll5_ =  0.;
+        ll4_ =  0.;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        qt = pow( 2.2999999999999998, (celsius- 21.0)* 0.10000000000000001);
+        ll0_ =  43.0-v;
+        ll1_ =  11.0*exprelr(ll0_* 0.090909090909090912);
+        mAlpha =  0.12*ll1_;
+        mBeta =  0.02*exp( -(v+ 1.27)* 0.0083333333333333332);
+        mRat =  0.40000000000000002*qt*(mAlpha+mBeta);
+        hInf =  1.0/( 1.0+exp((v+ 58.0)* 0.090909090909090912));
+        h1Rat = qt/( 360.0+( 1010.0+ 23.699999999999999*(v+ 54.0))*exp(pow( -((v+ 75.0)* 0.020833333333333332),  2.0)));
+        h2Rat = qt/( 2350.0+ 1380.0*exp( -0.010999999999999999*v)- 210.0*exp( -0.029999999999999999*v));
+        if (h2Rat< 0.) {
+            h2Rat =  0.001;
+        }
+        a_0_ =  -mRat;
+        ba_0_ =  0.40000000000000002*qt*mAlpha/a_0_;
+        ll2_ = a_0_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        m[i_] =  -ba_0_+(m[i_]+ba_0_)*ll3_;
+        a_1_ =  -1.0*h1Rat;
+        ba_1_ = hInf*h1Rat/a_1_;
+        ll4_ = a_1_*dt;
+        ll5_ = ( 1.0+ 0.5*ll4_)/( 1.0- 0.5*ll4_);
+        h1[i_] =  -ba_1_+(h1[i_]+ba_1_)*ll5_;
+        a_2_ =  -1.0*h2Rat;
+        ba_2_ = hInf*h2Rat/a_2_;
+        ll6_ = a_2_*dt;
+        ll7_ = ( 1.0+ 0.5*ll6_)/( 1.0- 0.5*ll6_);
+        h2[i_] =  -ba_2_+(h2[i_]+ba_2_)*ll7_;
+    }
+}
+
+void mechanism_cpu_Kv2like::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_k_index_i_ = ion_k_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ek = ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type ik = 0;
+        ik =  0.5*gbar[i_]*m[i_]*m[i_]*(h1[i_]+h2[i_])*(v-ek);
+        current_ = ik;
+        conductivity_ =  0.5*gbar[i_]*m[i_]*m[i_]*(h1[i_]+h2[i_]);
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+        ion_k_.current_density[ion_k_index_i_] = fma(10.0*weight_[i_], ik, ion_k_.current_density[ion_k_index_i_]);
+    }
+}
+
+void mechanism_cpu_Kv2like::write_ions_range(size_type begin_, size_type end_) {
+}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,146 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_Kv2like_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* h2;
+    value_type* m;
+    value_type* h1;
+    value_type* gbar;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_Kv2like_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type mBeta, mAlpha, hInf, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        ll0_ =  43.0-v;
+        ll1_ =  11.0*exprelr(ll0_* 0.090909090909090912);
+        mAlpha =  0.12*ll1_;
+        mBeta =  0.02*exp( -(v+ 1.27)* 0.0083333333333333332);
+        hInf =  1.0/( 1.0+exp((v+ 58.0)* 0.090909090909090912));
+        params_.m[tid_] = mAlpha/(mAlpha+mBeta);
+        params_.h1[tid_] = hInf;
+        params_.h2[tid_] = hInf;
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_Kv2like_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type celsius = params_.temperature_degC_[node_index_i_];
+        value_type ba_2_, a_2_, qt, mRat, ll7_, a_1_, ll6_, ll1_, ll2_, ll0_, a_0_, h1Rat, h2Rat, ba_1_, mBeta, ll3_, hInf, ba_0_, ll5_, ll4_, mAlpha;
+        ll7_ =  0.;
+        ll6_ =  0.;
+        ll5_ =  0.;
+        ll4_ =  0.;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        qt = pow( 2.2999999999999998, (celsius- 21.0)* 0.10000000000000001);
+        ll0_ =  43.0-v;
+        ll1_ =  11.0*exprelr(ll0_* 0.090909090909090912);
+        mAlpha =  0.12*ll1_;
+        mBeta =  0.02*exp( -(v+ 1.27)* 0.0083333333333333332);
+        mRat =  0.40000000000000002*qt*(mAlpha+mBeta);
+        hInf =  1.0/( 1.0+exp((v+ 58.0)* 0.090909090909090912));
+        h1Rat = qt/( 360.0+( 1010.0+ 23.699999999999999*(v+ 54.0))*exp(pow( -((v+ 75.0)* 0.020833333333333332),  2.0)));
+        h2Rat = qt/( 2350.0+ 1380.0*exp( -0.010999999999999999*v)- 210.0*exp( -0.029999999999999999*v));
+        if (h2Rat< 0.) {
+            h2Rat =  0.001;
+        }
+        a_0_ =  -mRat;
+        ba_0_ =  0.40000000000000002*qt*mAlpha/a_0_;
+        ll2_ = a_0_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        params_.m[tid_] =  -ba_0_+(params_.m[tid_]+ba_0_)*ll3_;
+        a_1_ =  -1.0*h1Rat;
+        ba_1_ = hInf*h1Rat/a_1_;
+        ll4_ = a_1_*dt;
+        ll5_ = ( 1.0+ 0.5*ll4_)/( 1.0- 0.5*ll4_);
+        params_.h1[tid_] =  -ba_1_+(params_.h1[tid_]+ba_1_)*ll5_;
+        a_2_ =  -1.0*h2Rat;
+        ba_2_ = hInf*h2Rat/a_2_;
+        ll6_ = a_2_*dt;
+        ll7_ = ( 1.0+ 0.5*ll6_)/( 1.0- 0.5*ll6_);
+        params_.h2[tid_] =  -ba_2_+(params_.h2[tid_]+ba_2_)*ll7_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_Kv2like_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_k_index_i_ = params_.ion_k_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ek = params_.ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ik = 0;
+        ik =  0.5*params_.gbar[tid_]*params_.m[tid_]*params_.m[tid_]*(params_.h1[tid_]+params_.h2[tid_])*(v-ek);
+        current_ = ik;
+        conductivity_ =  0.5*params_.gbar[tid_]*params_.m[tid_]*params_.m[tid_]*(params_.h1[tid_]+params_.h2[tid_]);
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+        params_.ion_k_.current_density[ion_k_index_i_] = fma(10.0*params_.weight_[tid_], ik, params_.ion_k_.current_density[ion_k_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_Kv2like_nrn_init_(mechanism_gpu_Kv2like_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Kv2like_nrn_current_(mechanism_gpu_Kv2like_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Kv2like_nrn_state_(mechanism_gpu_Kv2like_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Kv2like_write_ions_(mechanism_gpu_Kv2like_pp_& p) {}
+
+} // namespace allen_catalogue
+} // namespace arb
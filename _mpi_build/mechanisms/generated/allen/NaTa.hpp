@@ -0,0 +1,50 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_NaTa();
+
+inline const ::arb::mechanism_info& mechanism_NaTa_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+            {"malphaF", {spec::global, "", 0.182}},
+            {"mbetaF", {spec::global, "", 0.124}},
+            {"mvhalf", {spec::global, "mV", -48}},
+            {"mk", {spec::global, "mV", 6}},
+            {"halphaF", {spec::global, "", 0.015}},
+            {"hbetaF", {spec::global, "", 0.015}},
+            {"hvhalf", {spec::global, "mV", -69}},
+            {"hk", {spec::global, "mV", 6}}
+        },
+        // parameters
+        {
+            {"gbar", {spec::parameter, "S / cm2", 0.00001}}
+        },
+        // state variables
+        {
+            {"m", {spec::state, "", 0}},
+            {"h", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+            {"na", {false, false, true, false, false, false, 0}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        0
+    };
+
+    return info;
+}
+
+} // namespace allen_catalogue
+} // namespace arb
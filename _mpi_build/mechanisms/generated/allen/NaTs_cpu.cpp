@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_NaTs: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "NaTs"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_NaTs()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"mk", &mk},
+            {"mbetaF", &mbetaF},
+            {"halphaF", &halphaF},
+            {"malphaF", &malphaF},
+            {"mvhalf", &mvhalf},
+            {"hvhalf", &hvhalf},
+            {"hk", &hk},
+            {"hbetaF", &hbetaF}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"mTau", &mTau},
+            {"g", &g},
+            {"gbar", &gbar},
+            {"h", &h},
+            {"m", &m},
+            {"mInf", &mInf},
+            {"celsius", &celsius},
+            {"hAlpha", &hAlpha},
+            {"mAlpha", &mAlpha},
+            {"hInf", &hInf},
+            {"hTau", &hTau},
+            {"mBeta", &mBeta},
+            {"hBeta", &hBeta}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"h", &h},
+            {"m", &m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"na", &ion_na_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"na", &ion_na_index_}
+        };
+    }
+
+private:
+    value_type mk = 6.0;
+    value_type mbetaF = 0.124;
+    value_type halphaF = 0.014999999999999999;
+    value_type malphaF = 0.182;
+    value_type mvhalf = -40.0;
+    value_type hvhalf = -66.0;
+    value_type hk = 6.0;
+    value_type hbetaF = 0.014999999999999999;
+    value_type* mTau;
+    value_type* g;
+    value_type* gbar;
+    value_type* h;
+    value_type* m;
+    value_type* mInf;
+    value_type* celsius;
+    value_type* hAlpha;
+    value_type* mAlpha;
+    value_type* hInf;
+    value_type* hTau;
+    value_type* mBeta;
+    value_type* hBeta;
+    ion_state_view ion_na_;
+    iarray ion_na_index_;
+    void rates(int i_, value_type v);
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_NaTs();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_NaTs<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_NaTs());
+}
+
+void mechanism_cpu_NaTs::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type v = vec_v_[node_index_i_];
+        rates(i_, v);
+        m[i_] = mInf[i_];
+        h[i_] = hInf[i_];
+    }
+}
+
+void mechanism_cpu_NaTs::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_NaTs::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_NaTs::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_NaTs::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type b_0_, a_0_, b_1_, ll0_, a_1_, ll2_, ll1_, ll3_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        rates(i_, v);
+        a_0_ = mTau[i_];
+        b_0_ = mInf[i_];
+        ll0_ =  -dt/a_0_;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        m[i_] = b_0_+(m[i_]-b_0_)*ll1_;
+        a_1_ = hTau[i_];
+        b_1_ = hInf[i_];
+        ll2_ =  -dt/a_1_;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        h[i_] = b_1_+(h[i_]-b_1_)*ll3_;
+    }
+}
+
+void mechanism_cpu_NaTs::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_na_index_i_ = ion_na_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ena = ion_na_.reversal_potential[ion_na_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type ina = 0;
+        g[i_] = gbar[i_]*m[i_]*m[i_]*m[i_]*h[i_];
+        ina = g[i_]*(v-ena);
+        current_ = ina;
+        conductivity_ = g[i_];
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+        ion_na_.current_density[ion_na_index_i_] = fma(10.0*weight_[i_], ina, ion_na_.current_density[ion_na_index_i_]);
+    }
+}
+
+void mechanism_cpu_NaTs::write_ions_range(size_type begin_, size_type end_) {
+}
+
+void mechanism_cpu_NaTs::rates(int i_, value_type v) {
+    value_type qt, ll0_, ll2_, ll4_, ll1_, ll3_, ll5_, ll7_, ll6_;
+    ll7_ =  0.;
+    ll6_ =  0.;
+    ll5_ =  0.;
+    ll4_ =  0.;
+    ll3_ =  0.;
+    ll2_ =  0.;
+    ll1_ =  0.;
+    ll0_ =  0.;
+    qt = pow( 2.2999999999999998, (celsius[i_]- 23.0)* 0.10000000000000001);
+    ll0_ =  -(v-mvhalf);
+    if (abs(ll0_/mk)< 9.9999999999999995e-07) {
+        ll1_ = mk*( 1.0-ll0_/mk* 0.5);
+    }
+    else {
+        ll1_ = ll0_/(exp(ll0_/mk)- 1.0);
+    }
+    mAlpha[i_] = malphaF*ll1_;
+    ll2_ = v-mvhalf;
+    if (abs(ll2_/mk)< 9.9999999999999995e-07) {
+        ll3_ = mk*( 1.0-ll2_/mk* 0.5);
+    }
+    else {
+        ll3_ = ll2_/(exp(ll2_/mk)- 1.0);
+    }
+    mBeta[i_] = mbetaF*ll3_;
+    mInf[i_] = mAlpha[i_]/(mAlpha[i_]+mBeta[i_]);
+    mTau[i_] =  1.0/(mAlpha[i_]+mBeta[i_])/qt;
+    ll4_ = v-hvhalf;
+    if (abs(ll4_/hk)< 9.9999999999999995e-07) {
+        ll5_ = hk*( 1.0-ll4_/hk* 0.5);
+    }
+    else {
+        ll5_ = ll4_/(exp(ll4_/hk)- 1.0);
+    }
+    hAlpha[i_] = halphaF*ll5_;
+    ll6_ =  -(v-hvhalf);
+    if (abs(ll6_/hk)< 9.9999999999999995e-07) {
+        ll7_ = hk*( 1.0-ll6_/hk* 0.5);
+    }
+    else {
+        ll7_ = ll6_/(exp(ll6_/hk)- 1.0);
+    }
+    hBeta[i_] = hbetaF*ll7_;
+    hInf[i_] = hAlpha[i_]/(hAlpha[i_]+hBeta[i_]);
+    hTau[i_] =  1.0/(hAlpha[i_]+hBeta[i_])/qt;
+}
+
+} // namespace allen_catalogue
+} // namespace arb
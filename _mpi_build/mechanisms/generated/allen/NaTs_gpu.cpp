@@ -0,0 +1,130 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+struct mechanism_gpu_NaTs_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type mk = 6.0;
+    value_type mbetaF = 0.124;
+    value_type halphaF = 0.014999999999999999;
+    value_type malphaF = 0.182;
+    value_type mvhalf = -40.0;
+    value_type hvhalf = -66.0;
+    value_type hk = 6.0;
+    value_type hbetaF = 0.014999999999999999;
+    value_type* mTau;
+    value_type* g;
+    value_type* gbar;
+    value_type* h;
+    value_type* m;
+    value_type* mInf;
+    value_type* celsius;
+    value_type* hAlpha;
+    value_type* mAlpha;
+    value_type* hInf;
+    value_type* hTau;
+    value_type* mBeta;
+    value_type* hBeta;
+    ion_state_view ion_na_;
+    const index_type* ion_na_index_;
+};
+
+void mechanism_gpu_NaTs_nrn_init_(mechanism_gpu_NaTs_pp_&);
+void mechanism_gpu_NaTs_nrn_state_(mechanism_gpu_NaTs_pp_&);
+void mechanism_gpu_NaTs_nrn_current_(mechanism_gpu_NaTs_pp_&);
+void mechanism_gpu_NaTs_write_ions_(mechanism_gpu_NaTs_pp_&);
+
+class mechanism_gpu_NaTs: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "NaTs"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_NaTs()); }
+
+    void nrn_init() override {
+        mechanism_gpu_NaTs_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_NaTs_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_NaTs_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_NaTs_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() override { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"mk", &pp_.mk},
+            {"mbetaF", &pp_.mbetaF},
+            {"halphaF", &pp_.halphaF},
+            {"malphaF", &pp_.malphaF},
+            {"mvhalf", &pp_.mvhalf},
+            {"hvhalf", &pp_.hvhalf},
+            {"hk", &pp_.hk},
+            {"hbetaF", &pp_.hbetaF}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"mTau", &pp_.mTau},
+            {"g", &pp_.g},
+            {"gbar", &pp_.gbar},
+            {"h", &pp_.h},
+            {"m", &pp_.m},
+            {"mInf", &pp_.mInf},
+            {"celsius", &pp_.celsius},
+            {"hAlpha", &pp_.hAlpha},
+            {"mAlpha", &pp_.mAlpha},
+            {"hInf", &pp_.hInf},
+            {"hTau", &pp_.hTau},
+            {"mBeta", &pp_.mBeta},
+            {"hBeta", &pp_.hBeta}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"h", &pp_.h},
+            {"m", &pp_.m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"na", &pp_.ion_na_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"na", &pp_.ion_na_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_NaTs_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_NaTs();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_NaTs<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_NaTs());
+}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,185 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_NaTs_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type mk = 6.0;
+    value_type mbetaF = 0.124;
+    value_type halphaF = 0.014999999999999999;
+    value_type malphaF = 0.182;
+    value_type mvhalf = -40.0;
+    value_type hvhalf = -66.0;
+    value_type hk = 6.0;
+    value_type hbetaF = 0.014999999999999999;
+    value_type* mTau;
+    value_type* g;
+    value_type* gbar;
+    value_type* h;
+    value_type* m;
+    value_type* mInf;
+    value_type* celsius;
+    value_type* hAlpha;
+    value_type* mAlpha;
+    value_type* hInf;
+    value_type* hTau;
+    value_type* mBeta;
+    value_type* hBeta;
+    ion_state_view ion_na_;
+    const index_type* ion_na_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__device__
+void rates(mechanism_gpu_NaTs_pp_ params_, int tid_, value_type v) {
+    value_type qt, ll0_, ll2_, ll4_, ll1_, ll3_, ll5_, ll7_, ll6_;
+    ll7_ =  0.;
+    ll6_ =  0.;
+    ll5_ =  0.;
+    ll4_ =  0.;
+    ll3_ =  0.;
+    ll2_ =  0.;
+    ll1_ =  0.;
+    ll0_ =  0.;
+    qt = pow( 2.2999999999999998, (params_.celsius[tid_]- 23.0)* 0.10000000000000001);
+    ll0_ =  -(v-params_.mvhalf);
+    if (abs(ll0_/params_.mk)< 9.9999999999999995e-07) {
+        ll1_ = params_.mk*( 1.0-ll0_/params_.mk* 0.5);
+    }
+    else {
+        ll1_ = ll0_/(exp(ll0_/params_.mk)- 1.0);
+    }
+    params_.mAlpha[tid_] = params_.malphaF*ll1_;
+    ll2_ = v-params_.mvhalf;
+    if (abs(ll2_/params_.mk)< 9.9999999999999995e-07) {
+        ll3_ = params_.mk*( 1.0-ll2_/params_.mk* 0.5);
+    }
+    else {
+        ll3_ = ll2_/(exp(ll2_/params_.mk)- 1.0);
+    }
+    params_.mBeta[tid_] = params_.mbetaF*ll3_;
+    params_.mInf[tid_] = params_.mAlpha[tid_]/(params_.mAlpha[tid_]+params_.mBeta[tid_]);
+    params_.mTau[tid_] =  1.0/(params_.mAlpha[tid_]+params_.mBeta[tid_])/qt;
+    ll4_ = v-params_.hvhalf;
+    if (abs(ll4_/params_.hk)< 9.9999999999999995e-07) {
+        ll5_ = params_.hk*( 1.0-ll4_/params_.hk* 0.5);
+    }
+    else {
+        ll5_ = ll4_/(exp(ll4_/params_.hk)- 1.0);
+    }
+    params_.hAlpha[tid_] = params_.halphaF*ll5_;
+    ll6_ =  -(v-params_.hvhalf);
+    if (abs(ll6_/params_.hk)< 9.9999999999999995e-07) {
+        ll7_ = params_.hk*( 1.0-ll6_/params_.hk* 0.5);
+    }
+    else {
+        ll7_ = ll6_/(exp(ll6_/params_.hk)- 1.0);
+    }
+    params_.hBeta[tid_] = params_.hbetaF*ll7_;
+    params_.hInf[tid_] = params_.hAlpha[tid_]/(params_.hAlpha[tid_]+params_.hBeta[tid_]);
+    params_.hTau[tid_] =  1.0/(params_.hAlpha[tid_]+params_.hBeta[tid_])/qt;
+}
+
+__global__
+void nrn_init(mechanism_gpu_NaTs_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        rates(params_, tid_, v);
+        params_.m[tid_] = params_.mInf[tid_];
+        params_.h[tid_] = params_.hInf[tid_];
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_NaTs_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type b_0_, a_0_, b_1_, ll0_, a_1_, ll2_, ll1_, ll3_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        rates(params_, tid_, v);
+        a_0_ = params_.mTau[tid_];
+        b_0_ = params_.mInf[tid_];
+        ll0_ =  -dt/a_0_;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        params_.m[tid_] = b_0_+(params_.m[tid_]-b_0_)*ll1_;
+        a_1_ = params_.hTau[tid_];
+        b_1_ = params_.hInf[tid_];
+        ll2_ =  -dt/a_1_;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        params_.h[tid_] = b_1_+(params_.h[tid_]-b_1_)*ll3_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_NaTs_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_na_index_i_ = params_.ion_na_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ena = params_.ion_na_.reversal_potential[ion_na_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ina = 0;
+        params_.g[tid_] = params_.gbar[tid_]*params_.m[tid_]*params_.m[tid_]*params_.m[tid_]*params_.h[tid_];
+        ina = params_.g[tid_]*(v-ena);
+        current_ = ina;
+        conductivity_ = params_.g[tid_];
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+        params_.ion_na_.current_density[ion_na_index_i_] = fma(10.0*params_.weight_[tid_], ina, params_.ion_na_.current_density[ion_na_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_NaTs_nrn_init_(mechanism_gpu_NaTs_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_NaTs_nrn_current_(mechanism_gpu_NaTs_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_NaTs_nrn_state_(mechanism_gpu_NaTs_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_NaTs_write_ions_(mechanism_gpu_NaTs_pp_& p) {}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,64 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_NaV();
+
+inline const ::arb::mechanism_info& mechanism_NaV_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+            {"Con", {spec::global, "/ ms", 0.01}},
+            {"Coff", {spec::global, "/ ms", 40}},
+            {"Oon", {spec::global, "/ ms", 8}},
+            {"Ooff", {spec::global, "/ ms", 0.05}},
+            {"alpha", {spec::global, "/ ms", 400}},
+            {"beta", {spec::global, "/ ms", 12}},
+            {"gamma", {spec::global, "/ ms", 250}},
+            {"delta", {spec::global, "/ ms", 60}},
+            {"alfac", {spec::global, "", 2.51}},
+            {"btfac", {spec::global, "", 5.32}},
+            {"x1", {spec::global, "mV", 24}},
+            {"x2", {spec::global, "mV", -24}}
+        },
+        // parameters
+        {
+            {"gbar", {spec::parameter, "S / cm2", .015}}
+        },
+        // state variables
+        {
+            {"C1", {spec::state, "", 0}},
+            {"C2", {spec::state, "", 0}},
+            {"C3", {spec::state, "", 0}},
+            {"C4", {spec::state, "", 0}},
+            {"C5", {spec::state, "", 0}},
+            {"I1", {spec::state, "", 0}},
+            {"I2", {spec::state, "", 0}},
+            {"I3", {spec::state, "", 0}},
+            {"I4", {spec::state, "", 0}},
+            {"I5", {spec::state, "", 0}},
+            {"O", {spec::state, "", 0}},
+            {"I6", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+            {"na", {false, false, true, false, false, false, 0}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        1
+    };
+
+    return info;
+}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,150 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+struct mechanism_gpu_NaV_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type btfac = 5.3200000000000003;
+    value_type Con = 0.01;
+    value_type gamma = 250.0;
+    value_type Ooff = 0.050000000000000003;
+    value_type Coff = 40.0;
+    value_type alpha = 400.0;
+    value_type alfac = 2.5099999999999998;
+    value_type Oon = 8.0;
+    value_type beta = 12.0;
+    value_type delta = 60.0;
+    value_type x2 = -24.0;
+    value_type x1 = 24.0;
+    value_type* I4;
+    value_type* I3;
+    value_type* I5;
+    value_type* qt;
+    value_type* C2;
+    value_type* C5;
+    value_type* I2;
+    value_type* C1;
+    value_type* C4;
+    value_type* C3;
+    value_type* O;
+    value_type* gbar;
+    value_type* I6;
+    value_type* I1;
+    ion_state_view ion_na_;
+    const index_type* ion_na_index_;
+};
+
+void mechanism_gpu_NaV_nrn_init_(mechanism_gpu_NaV_pp_&);
+void mechanism_gpu_NaV_nrn_state_(mechanism_gpu_NaV_pp_&);
+void mechanism_gpu_NaV_nrn_current_(mechanism_gpu_NaV_pp_&);
+void mechanism_gpu_NaV_write_ions_(mechanism_gpu_NaV_pp_&);
+
+class mechanism_gpu_NaV: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "NaV"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_NaV()); }
+
+    void nrn_init() override {
+        mechanism_gpu_NaV_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_NaV_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_NaV_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_NaV_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() override { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"btfac", &pp_.btfac},
+            {"Con", &pp_.Con},
+            {"gamma", &pp_.gamma},
+            {"Ooff", &pp_.Ooff},
+            {"Coff", &pp_.Coff},
+            {"alpha", &pp_.alpha},
+            {"alfac", &pp_.alfac},
+            {"Oon", &pp_.Oon},
+            {"beta", &pp_.beta},
+            {"delta", &pp_.delta},
+            {"x2", &pp_.x2},
+            {"x1", &pp_.x1}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"I4", &pp_.I4},
+            {"I3", &pp_.I3},
+            {"I5", &pp_.I5},
+            {"qt", &pp_.qt},
+            {"C2", &pp_.C2},
+            {"C5", &pp_.C5},
+            {"I2", &pp_.I2},
+            {"C1", &pp_.C1},
+            {"C4", &pp_.C4},
+            {"C3", &pp_.C3},
+            {"O", &pp_.O},
+            {"gbar", &pp_.gbar},
+            {"I6", &pp_.I6},
+            {"I1", &pp_.I1}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 0.014999999999999999}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"I4", &pp_.I4},
+            {"I3", &pp_.I3},
+            {"I5", &pp_.I5},
+            {"C2", &pp_.C2},
+            {"C5", &pp_.C5},
+            {"I2", &pp_.I2},
+            {"C1", &pp_.C1},
+            {"C4", &pp_.C4},
+            {"C3", &pp_.C3},
+            {"O", &pp_.O},
+            {"I6", &pp_.I6},
+            {"I1", &pp_.I1}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"na", &pp_.ion_na_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"na", &pp_.ion_na_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_NaV_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_NaV();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_NaV<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_NaV());
+}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_Nap: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "Nap"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_Nap()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"h", &h},
+            {"gbar", &gbar},
+            {"g", &g},
+            {"hAlpha", &hAlpha},
+            {"celsius", &celsius},
+            {"hInf", &hInf},
+            {"mInf", &mInf},
+            {"hTau", &hTau},
+            {"hBeta", &hBeta}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"h", &h}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"na", &ion_na_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"na", &ion_na_index_}
+        };
+    }
+
+private:
+    value_type* h;
+    value_type* gbar;
+    value_type* g;
+    value_type* hAlpha;
+    value_type* celsius;
+    value_type* hInf;
+    value_type* mInf;
+    value_type* hTau;
+    value_type* hBeta;
+    ion_state_view ion_na_;
+    iarray ion_na_index_;
+    void rates(int i_, value_type v);
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_Nap();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_Nap<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_Nap());
+}
+
+void mechanism_cpu_Nap::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type v = vec_v_[node_index_i_];
+        rates(i_, v);
+        h[i_] = hInf[i_];
+    }
+}
+
+void mechanism_cpu_Nap::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_Nap::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_Nap::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_Nap::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type b_0_, a_0_, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        rates(i_, v);
+        a_0_ = hTau[i_];
+        b_0_ = hInf[i_];
+        ll0_ =  -dt/a_0_;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        h[i_] = b_0_+(h[i_]-b_0_)*ll1_;
+    }
+}
+
+void mechanism_cpu_Nap::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_na_index_i_ = ion_na_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ena = ion_na_.reversal_potential[ion_na_index_i_];
+        value_type ina = 0;
+        value_type v = vec_v_[node_index_i_];
+        rates(i_, v);
+        g[i_] = gbar[i_]*mInf[i_]*h[i_];
+        ina = g[i_]*(v-ena);
+        current_ = ina;
+        conductivity_ = g[i_];
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+        ion_na_.current_density[ion_na_index_i_] = fma(10.0*weight_[i_], ina, ion_na_.current_density[ion_na_index_i_]);
+    }
+}
+
+void mechanism_cpu_Nap::write_ions_range(size_type begin_, size_type end_) {
+}
+
+void mechanism_cpu_Nap::rates(int i_, value_type v) {
+    value_type qt, ll0_, ll2_, ll1_, ll3_;
+    ll3_ =  0.;
+    ll2_ =  0.;
+    ll1_ =  0.;
+    ll0_ =  0.;
+    qt = pow( 2.2999999999999998, (celsius[i_]- 21.0)* 0.10000000000000001);
+    mInf[i_] =  1.0/( 1.0+exp((v- -52.600000000000001)* -0.21739130434782611));
+    hInf[i_] =  1.0/( 1.0+exp((v- -48.799999999999997)* 0.10000000000000001));
+    ll0_ = v+ 17.0;
+    if (abs(ll0_* 0.21598272138228941)< 9.9999999999999995e-07) {
+        ll1_ =  4.6299999999999999*( 1.0-ll0_* 0.21598272138228941* 0.5);
+    }
+    else {
+        ll1_ = ll0_/(exp(ll0_* 0.21598272138228941)- 1.0);
+    }
+    hAlpha[i_] =  2.88e-06*ll1_;
+    ll2_ =  -(v+ 64.400000000000006);
+    if (abs(ll2_* 0.38022813688212931)< 9.9999999999999995e-07) {
+        ll3_ =  2.6299999999999999*( 1.0-ll2_* 0.38022813688212931* 0.5);
+    }
+    else {
+        ll3_ = ll2_/(exp(ll2_* 0.38022813688212931)- 1.0);
+    }
+    hBeta[i_] =  6.9399999999999996e-06*ll3_;
+    hTau[i_] =  1.0/(hAlpha[i_]+hBeta[i_])/qt;
+}
+
+} // namespace allen_catalogue
+} // namespace arb
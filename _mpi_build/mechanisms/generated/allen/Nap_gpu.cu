@@ -0,0 +1,145 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_Nap_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* h;
+    value_type* gbar;
+    value_type* g;
+    value_type* hAlpha;
+    value_type* celsius;
+    value_type* hInf;
+    value_type* mInf;
+    value_type* hTau;
+    value_type* hBeta;
+    ion_state_view ion_na_;
+    const index_type* ion_na_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__device__
+void rates(mechanism_gpu_Nap_pp_ params_, int tid_, value_type v) {
+    value_type qt, ll0_, ll2_, ll1_, ll3_;
+    ll3_ =  0.;
+    ll2_ =  0.;
+    ll1_ =  0.;
+    ll0_ =  0.;
+    qt = pow( 2.2999999999999998, (params_.celsius[tid_]- 21.0)* 0.10000000000000001);
+    params_.mInf[tid_] =  1.0/( 1.0+exp((v- -52.600000000000001)* -0.21739130434782611));
+    params_.hInf[tid_] =  1.0/( 1.0+exp((v- -48.799999999999997)* 0.10000000000000001));
+    ll0_ = v+ 17.0;
+    if (abs(ll0_* 0.21598272138228941)< 9.9999999999999995e-07) {
+        ll1_ =  4.6299999999999999*( 1.0-ll0_* 0.21598272138228941* 0.5);
+    }
+    else {
+        ll1_ = ll0_/(exp(ll0_* 0.21598272138228941)- 1.0);
+    }
+    params_.hAlpha[tid_] =  2.88e-06*ll1_;
+    ll2_ =  -(v+ 64.400000000000006);
+    if (abs(ll2_* 0.38022813688212931)< 9.9999999999999995e-07) {
+        ll3_ =  2.6299999999999999*( 1.0-ll2_* 0.38022813688212931* 0.5);
+    }
+    else {
+        ll3_ = ll2_/(exp(ll2_* 0.38022813688212931)- 1.0);
+    }
+    params_.hBeta[tid_] =  6.9399999999999996e-06*ll3_;
+    params_.hTau[tid_] =  1.0/(params_.hAlpha[tid_]+params_.hBeta[tid_])/qt;
+}
+
+__global__
+void nrn_init(mechanism_gpu_Nap_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        rates(params_, tid_, v);
+        params_.h[tid_] = params_.hInf[tid_];
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_Nap_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type b_0_, a_0_, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        rates(params_, tid_, v);
+        a_0_ = params_.hTau[tid_];
+        b_0_ = params_.hInf[tid_];
+        ll0_ =  -dt/a_0_;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        params_.h[tid_] = b_0_+(params_.h[tid_]-b_0_)*ll1_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_Nap_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_na_index_i_ = params_.ion_na_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ena = params_.ion_na_.reversal_potential[ion_na_index_i_];
+        value_type ina = 0;
+        value_type v = params_.vec_v_[node_index_i_];
+        rates(params_, tid_, v);
+        params_.g[tid_] = params_.gbar[tid_]*params_.mInf[tid_]*params_.h[tid_];
+        ina = params_.g[tid_]*(v-ena);
+        current_ = ina;
+        conductivity_ = params_.g[tid_];
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+        params_.ion_na_.current_density[ion_na_index_i_] = fma(10.0*params_.weight_[tid_], ina, params_.ion_na_.current_density[ion_na_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_Nap_nrn_init_(mechanism_gpu_Nap_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Nap_nrn_current_(mechanism_gpu_Nap_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Nap_nrn_state_(mechanism_gpu_Nap_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_Nap_write_ions_(mechanism_gpu_Nap_pp_& p) {}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,43 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_SK();
+
+inline const ::arb::mechanism_info& mechanism_SK_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+            {"zTau", {spec::global, "ms", 1}}
+        },
+        // parameters
+        {
+            {"gbar", {spec::parameter, "mho / cm2", .000001}}
+        },
+        // state variables
+        {
+            {"z", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+            {"k", {false, false, true, false, false, false, 0}},
+            {"ca", {false, false, false, false, false, false, 0}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        0
+    };
+
+    return info;
+}
+
+} // namespace allen_catalogue
+} // namespace arb
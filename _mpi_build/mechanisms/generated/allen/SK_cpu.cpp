@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_SK: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "SK"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_SK()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"zTau", &zTau}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"zInf", &zInf},
+            {"z", &z},
+            {"gbar", &gbar},
+            {"g", &g}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 9.9999999999999995e-07}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"z", &z}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &ion_k_},
+            {"ca", &ion_ca_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &ion_k_index_},
+            {"ca", &ion_ca_index_}
+        };
+    }
+
+private:
+    value_type zTau = 1.0;
+    value_type* zInf;
+    value_type* z;
+    value_type* gbar;
+    value_type* g;
+    ion_state_view ion_k_;
+    iarray ion_k_index_;
+    ion_state_view ion_ca_;
+    iarray ion_ca_index_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_SK();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_SK<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_SK());
+}
+
+void mechanism_cpu_SK::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto ion_ca_index_i_ = ion_ca_index_[i_];
+        value_type cai = ion_ca_.internal_concentration[ion_ca_index_i_];
+        value_type l_ca;
+        l_ca = cai;
+        if (l_ca< 9.9999999999999995e-08) {
+            l_ca = l_ca+ 9.9999999999999995e-08;
+        }
+        z[i_] =  1.0/( 1.0+pow( 0.00042999999999999999/l_ca,  4.7999999999999998));
+    }
+}
+
+void mechanism_cpu_SK::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_SK::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_SK::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_SK::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_ca_index_i_ = ion_ca_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type cai = ion_ca_.internal_concentration[ion_ca_index_i_];
+        value_type b_0_, a_0_, l_ca, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        l_ca = cai;
+        if (l_ca< 9.9999999999999995e-08) {
+            l_ca = l_ca+ 9.9999999999999995e-08;
+        }
+        zInf[i_] =  1.0/( 1.0+pow( 0.00042999999999999999/l_ca,  4.7999999999999998));
+        a_0_ = zTau;
+        b_0_ = zInf[i_];
+        ll0_ =  -dt/a_0_;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        z[i_] = b_0_+(z[i_]-b_0_)*ll1_;
+    }
+}
+
+void mechanism_cpu_SK::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_k_index_i_ = ion_k_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ek = ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type ik = 0;
+        ik = gbar[i_]*z[i_]*(v-ek);
+        current_ = ik;
+        conductivity_ = gbar[i_]*z[i_];
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+        ion_k_.current_density[ion_k_index_i_] = fma(10.0*weight_[i_], ik, ion_k_.current_density[ion_k_index_i_]);
+    }
+}
+
+void mechanism_cpu_SK::write_ions_range(size_type begin_, size_type end_) {
+}
+
+} // namespace allen_catalogue
+} // namespace arb
@@ -0,0 +1,101 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace allen_catalogue {
+
+struct mechanism_gpu_SK_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type zTau = 1.0;
+    value_type* zInf;
+    value_type* z;
+    value_type* gbar;
+    value_type* g;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+    ion_state_view ion_ca_;
+    const index_type* ion_ca_index_;
+};
+
+void mechanism_gpu_SK_nrn_init_(mechanism_gpu_SK_pp_&);
+void mechanism_gpu_SK_nrn_state_(mechanism_gpu_SK_pp_&);
+void mechanism_gpu_SK_nrn_current_(mechanism_gpu_SK_pp_&);
+void mechanism_gpu_SK_write_ions_(mechanism_gpu_SK_pp_&);
+
+class mechanism_gpu_SK: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "SK"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_SK()); }
+
+    void nrn_init() override {
+        mechanism_gpu_SK_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_SK_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_SK_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_SK_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() override { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"zTau", &pp_.zTau}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"zInf", &pp_.zInf},
+            {"z", &pp_.z},
+            {"gbar", &pp_.gbar},
+            {"g", &pp_.g}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 9.9999999999999995e-07}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"z", &pp_.z}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &pp_.ion_k_},
+            {"ca", &pp_.ion_ca_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &pp_.ion_k_index_},
+            {"ca", &pp_.ion_ca_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_SK_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_SK();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_SK<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_SK());
+}
+
+} // namespace allen_catalogue
+} // namespace arb
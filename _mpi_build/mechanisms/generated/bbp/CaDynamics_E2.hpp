@@ -0,0 +1,46 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+namespace bbp_catalogue {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_CaDynamics_E2();
+
+inline const ::arb::mechanism_info& mechanism_CaDynamics_E2_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+            {"F", {spec::global, "coulomb / mole", 96485.3321233100184}}
+        },
+        // parameters
+        {
+            {"gamma", {spec::parameter, "", 0.05}},
+            {"decay", {spec::parameter, "ms", 80}},
+            {"depth", {spec::parameter, "um", 0.1}},
+            {"minCai", {spec::parameter, "mM", 1e-4}},
+            {"initCai", {spec::parameter, "", 5e-5}}
+        },
+        // state variables
+        {
+            {"cai", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+            {"ca", {true, false, false, false, false, false, 0}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        0
+    };
+
+    return info;
+}
+
+} // namespace bbp_catalogue
+} // namespace arb
@@ -0,0 +1,105 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace bbp_catalogue {
+
+struct mechanism_gpu_CaDynamics_E2_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type F = 96485.332123310014;
+    value_type* gamma;
+    value_type* cai;
+    value_type* depth;
+    value_type* decay;
+    value_type* minCai;
+    value_type* initCai;
+    ion_state_view ion_ca_;
+    const index_type* ion_ca_index_;
+};
+
+void mechanism_gpu_CaDynamics_E2_nrn_init_(mechanism_gpu_CaDynamics_E2_pp_&);
+void mechanism_gpu_CaDynamics_E2_nrn_state_(mechanism_gpu_CaDynamics_E2_pp_&);
+void mechanism_gpu_CaDynamics_E2_nrn_current_(mechanism_gpu_CaDynamics_E2_pp_&);
+void mechanism_gpu_CaDynamics_E2_write_ions_(mechanism_gpu_CaDynamics_E2_pp_&);
+
+class mechanism_gpu_CaDynamics_E2: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "CaDynamics_E2"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_CaDynamics_E2()); }
+
+    void nrn_init() override {
+        mechanism_gpu_CaDynamics_E2_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_CaDynamics_E2_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_CaDynamics_E2_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_CaDynamics_E2_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() override { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"F", &pp_.F}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"gamma", &pp_.gamma},
+            {"cai", &pp_.cai},
+            {"depth", &pp_.depth},
+            {"decay", &pp_.decay},
+            {"minCai", &pp_.minCai},
+            {"initCai", &pp_.initCai}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gamma", 0.050000000000000003},
+            {"depth", 0.10000000000000001},
+            {"decay", 80.0},
+            {"minCai", 0.0001},
+            {"initCai", 5.0000000000000002e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"cai", &pp_.cai}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"ca", &pp_.ion_ca_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"ca", &pp_.ion_ca_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_CaDynamics_E2_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_CaDynamics_E2();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_CaDynamics_E2<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_CaDynamics_E2());
+}
+
+} // namespace bbp_catalogue
+} // namespace arb
@@ -0,0 +1,90 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace bbp_catalogue {
+
+struct mechanism_gpu_Ca_HVA_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* h;
+    value_type* m;
+    value_type* gCa_HVAbar;
+    ion_state_view ion_ca_;
+    const index_type* ion_ca_index_;
+};
+
+void mechanism_gpu_Ca_HVA_nrn_init_(mechanism_gpu_Ca_HVA_pp_&);
+void mechanism_gpu_Ca_HVA_nrn_state_(mechanism_gpu_Ca_HVA_pp_&);
+void mechanism_gpu_Ca_HVA_nrn_current_(mechanism_gpu_Ca_HVA_pp_&);
+void mechanism_gpu_Ca_HVA_write_ions_(mechanism_gpu_Ca_HVA_pp_&);
+
+class mechanism_gpu_Ca_HVA: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "Ca_HVA"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_Ca_HVA()); }
+
+    void nrn_init() override {
+        mechanism_gpu_Ca_HVA_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_Ca_HVA_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_Ca_HVA_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_Ca_HVA_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() override { return &pp_; }
+
+    mechanism_field_table field_table() override {
+        return {
+            {"h", &pp_.h},
+            {"m", &pp_.m},
+            {"gCa_HVAbar", &pp_.gCa_HVAbar}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gCa_HVAbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"h", &pp_.h},
+            {"m", &pp_.m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"ca", &pp_.ion_ca_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"ca", &pp_.ion_ca_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_Ca_HVA_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_Ca_HVA();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_Ca_HVA<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_Ca_HVA());
+}
+
+} // namespace bbp_catalogue
+} // namespace arb
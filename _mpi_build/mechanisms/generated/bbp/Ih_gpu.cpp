@@ -0,0 +1,81 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace bbp_catalogue {
+
+struct mechanism_gpu_Ih_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type ehcn = -45.0;
+    value_type* m;
+    value_type* gIhbar;
+};
+
+void mechanism_gpu_Ih_nrn_init_(mechanism_gpu_Ih_pp_&);
+void mechanism_gpu_Ih_nrn_state_(mechanism_gpu_Ih_pp_&);
+void mechanism_gpu_Ih_nrn_current_(mechanism_gpu_Ih_pp_&);
+void mechanism_gpu_Ih_write_ions_(mechanism_gpu_Ih_pp_&);
+
+class mechanism_gpu_Ih: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "Ih"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_Ih()); }
+
+    void nrn_init() override {
+        mechanism_gpu_Ih_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_Ih_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_Ih_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_Ih_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() override { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"ehcn", &pp_.ehcn}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"m", &pp_.m},
+            {"gIhbar", &pp_.gIhbar}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gIhbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &pp_.m}
+        };
+    }
+
+private:
+    mechanism_gpu_Ih_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_Ih();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_Ih<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_Ih());
+}
+
+} // namespace bbp_catalogue
+} // namespace arb
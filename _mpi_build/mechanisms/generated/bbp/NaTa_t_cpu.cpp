@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace bbp_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_NaTa_t: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "NaTa_t"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_NaTa_t()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"h", &h},
+            {"m", &m},
+            {"gNaTa_tbar", &gNaTa_tbar}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gNaTa_tbar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"h", &h},
+            {"m", &m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"na", &ion_na_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"na", &ion_na_index_}
+        };
+    }
+
+private:
+    value_type* h;
+    value_type* m;
+    value_type* gNaTa_tbar;
+    ion_state_view ion_na_;
+    iarray ion_na_index_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_NaTa_t();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_NaTa_t<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_NaTa_t());
+}
+
+void mechanism_cpu_NaTa_t::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type mBeta, mAlpha, hBeta, hAlpha;
+        mAlpha =  1.0920000000000001*exprelr( -(v+ 38.0)* 0.16666666666666666);
+        mBeta =  0.74399999999999999*exprelr((v+ 38.0)* 0.16666666666666666);
+        m[i_] = mAlpha/(mAlpha+mBeta);
+        hAlpha =  0.089999999999999997*exprelr((v+ 66.0)* 0.16666666666666666);
+        hBeta =  0.089999999999999997*exprelr( -(v+ 66.0)* 0.16666666666666666);
+        h[i_] = hAlpha/(hAlpha+hBeta);
+    }
+}
+
+void mechanism_cpu_NaTa_t::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_NaTa_t::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_NaTa_t::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_NaTa_t::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type a_1_, ll3_, ll1_, mRate, ll2_, ll0_, hAlpha, hBeta, hRate, qt, ba_0_, mAlpha, ba_1_, mBeta, a_0_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        qt =  2.952882641412121;
+        mAlpha =  1.0920000000000001*exprelr( -(v+ 38.0)* 0.16666666666666666);
+        mBeta =  0.74399999999999999*exprelr((v+ 38.0)* 0.16666666666666666);
+        mRate = mAlpha+mBeta;
+        hAlpha =  0.089999999999999997*exprelr((v+ 66.0)* 0.16666666666666666);
+        hBeta =  0.089999999999999997*exprelr( -(v+ 66.0)* 0.16666666666666666);
+        hRate = hAlpha+hBeta;
+        a_0_ = qt* -mRate;
+        ba_0_ = qt*mAlpha/a_0_;
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        m[i_] =  -ba_0_+(m[i_]+ba_0_)*ll1_;
+        a_1_ = qt* -hRate;
+        ba_1_ = qt*hAlpha/a_1_;
+        ll2_ = a_1_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        h[i_] =  -ba_1_+(h[i_]+ba_1_)*ll3_;
+    }
+}
+
+void mechanism_cpu_NaTa_t::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_na_index_i_ = ion_na_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ena = ion_na_.reversal_potential[ion_na_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type ina = 0;
+        ina = gNaTa_tbar[i_]*m[i_]*m[i_]*m[i_]*h[i_]*(v-ena);
+        current_ = ina;
+        conductivity_ = gNaTa_tbar[i_]*m[i_]*m[i_]*m[i_]*h[i_];
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+        ion_na_.current_density[ion_na_index_i_] = fma(10.0*weight_[i_], ina, ion_na_.current_density[ion_na_index_i_]);
+    }
+}
+
+void mechanism_cpu_NaTa_t::write_ions_range(size_type begin_, size_type end_) {
+}
+
+} // namespace bbp_catalogue
+} // namespace arb
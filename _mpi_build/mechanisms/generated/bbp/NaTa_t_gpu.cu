@@ -0,0 +1,126 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace bbp_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_NaTa_t_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* h;
+    value_type* m;
+    value_type* gNaTa_tbar;
+    ion_state_view ion_na_;
+    const index_type* ion_na_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_NaTa_t_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type mBeta, mAlpha, hBeta, hAlpha;
+        mAlpha =  1.0920000000000001*exprelr( -(v+ 38.0)* 0.16666666666666666);
+        mBeta =  0.74399999999999999*exprelr((v+ 38.0)* 0.16666666666666666);
+        params_.m[tid_] = mAlpha/(mAlpha+mBeta);
+        hAlpha =  0.089999999999999997*exprelr((v+ 66.0)* 0.16666666666666666);
+        hBeta =  0.089999999999999997*exprelr( -(v+ 66.0)* 0.16666666666666666);
+        params_.h[tid_] = hAlpha/(hAlpha+hBeta);
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_NaTa_t_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type a_1_, ll3_, ll1_, mRate, ll2_, ll0_, hAlpha, hBeta, hRate, qt, ba_0_, mAlpha, ba_1_, mBeta, a_0_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        qt =  2.952882641412121;
+        mAlpha =  1.0920000000000001*exprelr( -(v+ 38.0)* 0.16666666666666666);
+        mBeta =  0.74399999999999999*exprelr((v+ 38.0)* 0.16666666666666666);
+        mRate = mAlpha+mBeta;
+        hAlpha =  0.089999999999999997*exprelr((v+ 66.0)* 0.16666666666666666);
+        hBeta =  0.089999999999999997*exprelr( -(v+ 66.0)* 0.16666666666666666);
+        hRate = hAlpha+hBeta;
+        a_0_ = qt* -mRate;
+        ba_0_ = qt*mAlpha/a_0_;
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        params_.m[tid_] =  -ba_0_+(params_.m[tid_]+ba_0_)*ll1_;
+        a_1_ = qt* -hRate;
+        ba_1_ = qt*hAlpha/a_1_;
+        ll2_ = a_1_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        params_.h[tid_] =  -ba_1_+(params_.h[tid_]+ba_1_)*ll3_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_NaTa_t_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_na_index_i_ = params_.ion_na_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ena = params_.ion_na_.reversal_potential[ion_na_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ina = 0;
+        ina = params_.gNaTa_tbar[tid_]*params_.m[tid_]*params_.m[tid_]*params_.m[tid_]*params_.h[tid_]*(v-ena);
+        current_ = ina;
+        conductivity_ = params_.gNaTa_tbar[tid_]*params_.m[tid_]*params_.m[tid_]*params_.m[tid_]*params_.h[tid_];
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+        params_.ion_na_.current_density[ion_na_index_i_] = fma(10.0*params_.weight_[tid_], ina, params_.ion_na_.current_density[ion_na_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_NaTa_t_nrn_init_(mechanism_gpu_NaTa_t_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_NaTa_t_nrn_current_(mechanism_gpu_NaTa_t_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_NaTa_t_nrn_state_(mechanism_gpu_NaTa_t_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_NaTa_t_write_ions_(mechanism_gpu_NaTa_t_pp_& p) {}
+
+} // namespace bbp_catalogue
+} // namespace arb
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace bbp_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_Nap_Et2: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "Nap_Et2"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_Nap_Et2()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"m", &m},
+            {"h", &h},
+            {"gNap_Et2bar", &gNap_Et2bar}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gNap_Et2bar", 1.0000000000000001e-05}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &m},
+            {"h", &h}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"na", &ion_na_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"na", &ion_na_index_}
+        };
+    }
+
+private:
+    value_type* m;
+    value_type* h;
+    value_type* gNap_Et2bar;
+    ion_state_view ion_na_;
+    iarray ion_na_index_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_Nap_Et2();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_Nap_Et2<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_Nap_Et2());
+}
+
+void mechanism_cpu_Nap_Et2::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type v = vec_v_[node_index_i_];
+        m[i_] =  1.0/( 1.0+exp( -(v+ 52.600000000000001)* 0.21739130434782611));
+        h[i_] =  1.0/( 1.0+exp((v+ 48.799999999999997)* 0.10000000000000001));
+    }
+}
+
+void mechanism_cpu_Nap_Et2::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_Nap_Et2::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_Nap_Et2::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_Nap_Et2::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type a_1_, a_0_, ll1_, mInf, ll2_, hBeta, ll0_, hAlpha, ll3_, hInf, hRho, ba_0_, mAlpha, ba_1_, mBeta, mRho, qt;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        qt =  2.952882641412121;
+        mInf =  1.0/( 1.0+exp( -(v+ 52.600000000000001)* 0.21739130434782611));
+        mAlpha =  1.0920000000000001*exprelr( -(v+ 38.0)* 0.16666666666666666);
+        mBeta =  0.74399999999999999*exprelr((v+ 38.0)* 0.16666666666666666);
+        mRho = mAlpha+mBeta;
+        hInf =  1.0/( 1.0+exp((v+ 48.799999999999997)* 0.10000000000000001));
+        hAlpha =  1.3334399999999999e-05*exprelr((v+ 17.0)* 0.21598272138228941);
+        hBeta =  1.8252199999999998e-05*exprelr( -(v+ 64.400000000000006)* 0.38022813688212931);
+        hRho = hAlpha+hBeta;
+        a_0_ = qt* -1.0*mRho* 0.16666666666666666;
+        ba_0_ = qt*mInf*mRho* 0.16666666666666666/a_0_;
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        m[i_] =  -ba_0_+(m[i_]+ba_0_)*ll1_;
+        a_1_ = qt* -1.0*hRho;
+        ba_1_ = qt*hInf*hRho/a_1_;
+        ll2_ = a_1_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        h[i_] =  -ba_1_+(h[i_]+ba_1_)*ll3_;
+    }
+}
+
+void mechanism_cpu_Nap_Et2::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_na_index_i_ = ion_na_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ena = ion_na_.reversal_potential[ion_na_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type ina = 0;
+        ina = gNap_Et2bar[i_]*m[i_]*m[i_]*m[i_]*h[i_]*(v-ena);
+        current_ = ina;
+        conductivity_ = gNap_Et2bar[i_]*m[i_]*m[i_]*m[i_]*h[i_];
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+        ion_na_.current_density[ion_na_index_i_] = fma(10.0*weight_[i_], ina, ion_na_.current_density[ion_na_index_i_]);
+    }
+}
+
+void mechanism_cpu_Nap_Et2::write_ions_range(size_type begin_, size_type end_) {
+}
+
+} // namespace bbp_catalogue
+} // namespace arb
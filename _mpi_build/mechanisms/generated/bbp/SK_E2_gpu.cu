@@ -0,0 +1,121 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace bbp_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_SK_E2_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type zTau = 1.0;
+    value_type* z;
+    value_type* gSK_E2bar;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+    ion_state_view ion_ca_;
+    const index_type* ion_ca_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_SK_E2_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_ca_index_i_ = params_.ion_ca_index_[tid_];
+        value_type cai = params_.ion_ca_.internal_concentration[ion_ca_index_i_];
+        if (cai< 9.9999999999999995e-08) {
+            params_.z[tid_] =  0.;
+        }
+        else {
+            params_.z[tid_] =  1.0/( 1.0+pow( 0.00042999999999999999/cai,  4.7999999999999998));
+        }
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_SK_E2_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_ca_index_i_ = params_.ion_ca_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type cai = params_.ion_ca_.internal_concentration[ion_ca_index_i_];
+        value_type b_0_, a_0_, ll0_, ll1_, ll2_;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        if (cai< 9.9999999999999995e-08) {
+            ll0_ =  0.;
+        }
+        else {
+            ll0_ =  1.0/( 1.0+pow( 0.00042999999999999999/cai,  4.7999999999999998));
+        }
+        a_0_ = params_.zTau;
+        b_0_ = ll0_;
+        ll1_ =  -dt/a_0_;
+        ll2_ = ( 1.0+ 0.5*ll1_)/( 1.0- 0.5*ll1_);
+        params_.z[tid_] = b_0_+(params_.z[tid_]-b_0_)*ll2_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_SK_E2_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_k_index_i_ = params_.ion_k_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type ek = params_.ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ik = 0;
+        ik = params_.gSK_E2bar[tid_]*params_.z[tid_]*(v-ek);
+        current_ = ik;
+        conductivity_ = params_.gSK_E2bar[tid_]*params_.z[tid_];
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+        params_.ion_k_.current_density[ion_k_index_i_] = fma(10.0*params_.weight_[tid_], ik, params_.ion_k_.current_density[ion_k_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_SK_E2_nrn_init_(mechanism_gpu_SK_E2_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_SK_E2_nrn_current_(mechanism_gpu_SK_E2_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_SK_E2_nrn_state_(mechanism_gpu_SK_E2_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_SK_E2_write_ions_(mechanism_gpu_SK_E2_pp_& p) {}
+
+} // namespace bbp_catalogue
+} // namespace arb
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace default_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_exp2syn: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "exp2syn"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::point; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_exp2syn()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+    void deliver_events(deliverable_event_stream::state events) override;
+    void net_receive(int i_, value_type weight);
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"B", &B},
+            {"tau1", &tau1},
+            {"A", &A},
+            {"tau2", &tau2},
+            {"e", &e},
+            {"factor", &factor}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"tau1", 0.5},
+            {"tau2", 2.0},
+            {"e", 0.}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"B", &B},
+            {"A", &A}
+        };
+    }
+
+private:
+    value_type* B;
+    value_type* tau1;
+    value_type* A;
+    value_type* tau2;
+    value_type* e;
+    value_type* factor;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_exp2syn();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_exp2syn<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_exp2syn());
+}
+
+void mechanism_cpu_exp2syn::deliver_events(deliverable_event_stream::state events) {
+    auto ncell = events.n_streams();
+    for (size_type c = 0; c<ncell; ++c) {
+        auto begin = events.begin_marked(c);
+        auto end = events.end_marked(c);
+        for (auto p = begin; p<end; ++p) {
+            net_receive(p->mech_index, p->weight);
+        }
+    }
+}
+
+void mechanism_cpu_exp2syn::net_receive(int i_, value_type weight) {
+    A[i_] = A[i_]+weight*factor[i_];
+    B[i_] = B[i_]+weight*factor[i_];
+}
+
+void mechanism_cpu_exp2syn::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type tp;
+        A[i_] =  0.;
+        B[i_] =  0.;
+        tp = tau1[i_]*tau2[i_]/(tau2[i_]-tau1[i_])*log(tau2[i_]/tau1[i_]);
+        factor[i_] =  1.0/( -exp( -tp/tau1[i_])+exp( -tp/tau2[i_]));
+    }
+}
+
+void mechanism_cpu_exp2syn::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_exp2syn::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_exp2syn::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_exp2syn::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type a_0_, ll0_, a_1_, ll2_, ll1_, ll3_;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        a_0_ =  -1.0/tau1[i_];
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        A[i_] = A[i_]*ll1_;
+        a_1_ =  -1.0/tau2[i_];
+        ll2_ = a_1_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        B[i_] = B[i_]*ll3_;
+    }
+}
+
+void mechanism_cpu_exp2syn::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type v = vec_v_[node_index_i_];
+        value_type i = 0;
+        i = (B[i_]-A[i_])*(v-e[i_]);
+        current_ = i;
+        conductivity_ = B[i_]-A[i_];
+        vec_g_[node_index_i_] = fma(weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(weight_[i_], current_, vec_i_[node_index_i_]);
+    }
+}
+
+void mechanism_cpu_exp2syn::write_ions_range(size_type begin_, size_type end_) {
+}
+
+} // namespace default_catalogue
+} // namespace arb
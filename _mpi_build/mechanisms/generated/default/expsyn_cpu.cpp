@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace default_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_expsyn: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "expsyn"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::point; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_expsyn()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+    void deliver_events(deliverable_event_stream::state events) override;
+    void net_receive(int i_, value_type weight);
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"g", &g},
+            {"tau", &tau},
+            {"e", &e}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"tau", 2.0},
+            {"e", 0.}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"g", &g}
+        };
+    }
+
+private:
+    value_type* g;
+    value_type* tau;
+    value_type* e;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_expsyn();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_expsyn<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_expsyn());
+}
+
+void mechanism_cpu_expsyn::deliver_events(deliverable_event_stream::state events) {
+    auto ncell = events.n_streams();
+    for (size_type c = 0; c<ncell; ++c) {
+        auto begin = events.begin_marked(c);
+        auto end = events.end_marked(c);
+        for (auto p = begin; p<end; ++p) {
+            net_receive(p->mech_index, p->weight);
+        }
+    }
+}
+
+void mechanism_cpu_expsyn::net_receive(int i_, value_type weight) {
+    g[i_] = g[i_]+weight;
+}
+
+void mechanism_cpu_expsyn::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        g[i_] =  0.;
+    }
+}
+
+void mechanism_cpu_expsyn::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_expsyn::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_expsyn::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_expsyn::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type a_0_, ll0_, ll1_;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        a_0_ =  -1.0/tau[i_];
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        g[i_] = g[i_]*ll1_;
+    }
+}
+
+void mechanism_cpu_expsyn::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type v = vec_v_[node_index_i_];
+        value_type i = 0;
+        i = g[i_]*(v-e[i_]);
+        current_ = i;
+        conductivity_ = g[i_];
+        vec_g_[node_index_i_] = fma(weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(weight_[i_], current_, vec_i_[node_index_i_]);
+    }
+}
+
+void mechanism_cpu_expsyn::write_ions_range(size_type begin_, size_type end_) {
+}
+
+} // namespace default_catalogue
+} // namespace arb
@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+
+namespace arb {
+namespace default_catalogue {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::arb::math::safeinv;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_hh: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "hh"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_hh()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_state_range(size_type begin_, size_type end_) override;
+    void nrn_current_range(size_type begin_, size_type end_) override;
+    void write_ions_range(size_type begin_, size_type end_) override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"gl", &gl},
+            {"gnabar", &gnabar},
+            {"n", &n},
+            {"h", &h},
+            {"q10", &q10},
+            {"m", &m},
+            {"el", &el},
+            {"gkbar", &gkbar}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gl", 0.00029999999999999997},
+            {"gnabar", 0.12},
+            {"el", -54.299999999999997},
+            {"gkbar", 0.035999999999999997}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"n", &n},
+            {"h", &h},
+            {"m", &m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"na", &ion_na_},
+            {"k", &ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"na", &ion_na_index_},
+            {"k", &ion_k_index_}
+        };
+    }
+
+private:
+    value_type* gl;
+    value_type* gnabar;
+    value_type* n;
+    value_type* h;
+    value_type* q10;
+    value_type* m;
+    value_type* el;
+    value_type* gkbar;
+    ion_state_view ion_na_;
+    iarray ion_na_index_;
+    ion_state_view ion_k_;
+    iarray ion_k_index_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_hh();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_hh<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_hh());
+}
+
+void mechanism_cpu_hh::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type celsius = temperature_degC_[node_index_i_];
+        value_type r_3_, r_2_, r_1_, r_0_, beta, alpha;
+        q10[i_] = pow( 3.0, (celsius- 6.2999999999999998)* 0.10000000000000001);
+        r_0_ =  0.;
+        r_1_ =  0.;
+        r_1_ =  -(v+ 40.0);
+        r_0_ =  10.0*exprelr(r_1_* 0.10000000000000001);
+        alpha =  0.10000000000000001*r_0_;
+        beta =  4.0*exp( -(v+ 65.0)* 0.055555555555555552);
+        m[i_] = alpha/(alpha+beta);
+        alpha =  0.070000000000000007*exp( -(v+ 65.0)* 0.050000000000000003);
+        beta =  1.0/(exp( -(v+ 35.0)* 0.10000000000000001)+ 1.0);
+        h[i_] = alpha/(alpha+beta);
+        r_2_ =  0.;
+        r_3_ =  0.;
+        r_3_ =  -(v+ 55.0);
+        r_2_ =  10.0*exprelr(r_3_* 0.10000000000000001);
+        alpha =  0.01*r_2_;
+        beta =  0.125*exp( -(v+ 65.0)* 0.012500000000000001);
+        n[i_] = alpha/(alpha+beta);
+    }
+}
+
+void mechanism_cpu_hh::nrn_state() {
+    nrn_state_range(0, width_);
+}
+
+void mechanism_cpu_hh::nrn_current() {
+    nrn_current_range(0, width_);
+}
+
+void mechanism_cpu_hh::write_ions() {
+    write_ions_range(0, width_);
+}
+
+void mechanism_cpu_hh::nrn_state_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto node_index_i_ = node_index_[i_];
+        value_type dt = vec_dt_[node_index_i_];
+        value_type v = vec_v_[node_index_i_];
+        value_type ba_2_, a_2_, r_2_, ba_1_, a_1_, r_3_, ll3_, ba_0_, ll5_, ll4_, ll2_, r_0_, r_1_, ll0_, ll1_, beta, alpha, sum, a_0_;
+        ll5_ =  0.;
+        ll4_ =  0.;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        r_0_ =  0.;
+        r_1_ =  0.;
+        r_1_ =  -(v+ 40.0);
+        r_0_ =  10.0*exprelr(r_1_* 0.10000000000000001);
+        alpha =  0.10000000000000001*r_0_;
+        beta =  4.0*exp( -(v+ 65.0)* 0.055555555555555552);
+        sum = alpha+beta;
+        a_0_ =  -sum*q10[i_];
+        ba_0_ = alpha*q10[i_]/a_0_;
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        m[i_] =  -ba_0_+(m[i_]+ba_0_)*ll1_;
+        alpha =  0.070000000000000007*exp( -(v+ 65.0)* 0.050000000000000003);
+        beta =  1.0/(exp( -(v+ 35.0)* 0.10000000000000001)+ 1.0);
+        sum = alpha+beta;
+        a_1_ =  -sum*q10[i_];
+        ba_1_ = alpha*q10[i_]/a_1_;
+        ll2_ = a_1_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        h[i_] =  -ba_1_+(h[i_]+ba_1_)*ll3_;
+        r_2_ =  0.;
+        r_3_ =  0.;
+        r_3_ =  -(v+ 55.0);
+        r_2_ =  10.0*exprelr(r_3_* 0.10000000000000001);
+        alpha =  0.01*r_2_;
+        beta =  0.125*exp( -(v+ 65.0)* 0.012500000000000001);
+        sum = alpha+beta;
+        a_2_ =  -sum*q10[i_];
+        ba_2_ = alpha*q10[i_]/a_2_;
+        ll4_ = a_2_*dt;
+        ll5_ = ( 1.0+ 0.5*ll4_)/( 1.0- 0.5*ll4_);
+        n[i_] =  -ba_2_+(n[i_]+ba_2_)*ll5_;
+    }
+}
+
+void mechanism_cpu_hh::nrn_current_range(size_type begin_, size_type end_) {
+    int n_ = end_;
+    for (int i_ = begin_; i_ < n_; ++i_) {
+        auto ion_na_index_i_ = ion_na_index_[i_];
+        auto ion_k_index_i_ = ion_k_index_[i_];
+        auto node_index_i_ = node_index_[i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type il = 0;
+        value_type ek = ion_k_.reversal_potential[ion_k_index_i_];
+        value_type ik = 0;
+        value_type ena = ion_na_.reversal_potential[ion_na_index_i_];
+        value_type ina = 0;
+        value_type v = vec_v_[node_index_i_];
+        value_type n_, m_, n2, gk;
+        n_ = n[i_];
+        m_ = m[i_];
+        n2 = n_*n_;
+        gk = gkbar[i_]*n2*n2;
+        ina = gnabar[i_]*m_*m_*m_*h[i_]*(v-ena);
+        ik = gk*(v-ek);
+        il = gl[i_]*(v-el[i_]);
+        current_ = ik+il+ina;
+        conductivity_ = gnabar[i_]*m_*m_*m_*h[i_]+gl[i_]+gk;
+        vec_g_[node_index_i_] = fma(10.0*weight_[i_], conductivity_, vec_g_[node_index_i_]);
+        vec_i_[node_index_i_] = fma(10.0*weight_[i_], current_, vec_i_[node_index_i_]);
+        ion_k_.current_density[ion_k_index_i_] = fma(10.0*weight_[i_], ik, ion_k_.current_density[ion_k_index_i_]);
+        ion_na_.current_density[ion_na_index_i_] = fma(10.0*weight_[i_], ina, ion_na_.current_density[ion_na_index_i_]);
+    }
+}
+
+void mechanism_cpu_hh::write_ions_range(size_type begin_, size_type end_) {
+}
+
+} // namespace default_catalogue
+} // namespace arb
@@ -0,0 +1,108 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace default_catalogue {
+
+struct mechanism_gpu_hh_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* gl;
+    value_type* gnabar;
+    value_type* n;
+    value_type* h;
+    value_type* q10;
+    value_type* m;
+    value_type* el;
+    value_type* gkbar;
+    ion_state_view ion_na_;
+    const index_type* ion_na_index_;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+};
+
+void mechanism_gpu_hh_nrn_init_(mechanism_gpu_hh_pp_&);
+void mechanism_gpu_hh_nrn_state_(mechanism_gpu_hh_pp_&);
+void mechanism_gpu_hh_nrn_current_(mechanism_gpu_hh_pp_&);
+void mechanism_gpu_hh_write_ions_(mechanism_gpu_hh_pp_&);
+
+class mechanism_gpu_hh: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "hh"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_hh()); }
+
+    void nrn_init() override {
+        mechanism_gpu_hh_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_hh_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_hh_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_hh_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() override { return &pp_; }
+
+    mechanism_field_table field_table() override {
+        return {
+            {"gl", &pp_.gl},
+            {"gnabar", &pp_.gnabar},
+            {"n", &pp_.n},
+            {"h", &pp_.h},
+            {"q10", &pp_.q10},
+            {"m", &pp_.m},
+            {"el", &pp_.el},
+            {"gkbar", &pp_.gkbar}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gl", 0.00029999999999999997},
+            {"gnabar", 0.12},
+            {"el", -54.299999999999997},
+            {"gkbar", 0.035999999999999997}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"n", &pp_.n},
+            {"h", &pp_.h},
+            {"m", &pp_.m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"na", &pp_.ion_na_},
+            {"k", &pp_.ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"na", &pp_.ion_na_index_},
+            {"k", &pp_.ion_k_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_hh_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_hh();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_hh<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_hh());
+}
+
+} // namespace default_catalogue
+} // namespace arb
@@ -0,0 +1,175 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/gpu_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace default_catalogue {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_hh_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* gl;
+    value_type* gnabar;
+    value_type* n;
+    value_type* h;
+    value_type* q10;
+    value_type* m;
+    value_type* el;
+    value_type* gkbar;
+    ion_state_view ion_na_;
+    const index_type* ion_na_index_;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::safeinv;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_hh_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type celsius = params_.temperature_degC_[node_index_i_];
+        value_type r_3_, r_2_, r_1_, r_0_, beta, alpha;
+        params_.q10[tid_] = pow( 3.0, (celsius- 6.2999999999999998)* 0.10000000000000001);
+        r_0_ =  0.;
+        r_1_ =  0.;
+        r_1_ =  -(v+ 40.0);
+        r_0_ =  10.0*exprelr(r_1_* 0.10000000000000001);
+        alpha =  0.10000000000000001*r_0_;
+        beta =  4.0*exp( -(v+ 65.0)* 0.055555555555555552);
+        params_.m[tid_] = alpha/(alpha+beta);
+        alpha =  0.070000000000000007*exp( -(v+ 65.0)* 0.050000000000000003);
+        beta =  1.0/(exp( -(v+ 35.0)* 0.10000000000000001)+ 1.0);
+        params_.h[tid_] = alpha/(alpha+beta);
+        r_2_ =  0.;
+        r_3_ =  0.;
+        r_3_ =  -(v+ 55.0);
+        r_2_ =  10.0*exprelr(r_3_* 0.10000000000000001);
+        alpha =  0.01*r_2_;
+        beta =  0.125*exp( -(v+ 65.0)* 0.012500000000000001);
+        params_.n[tid_] = alpha/(alpha+beta);
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_hh_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ba_2_, a_2_, r_2_, ba_1_, a_1_, r_3_, ll3_, ba_0_, ll5_, ll4_, ll2_, r_0_, r_1_, ll0_, ll1_, beta, alpha, sum, a_0_;
+        ll5_ =  0.;
+        ll4_ =  0.;
+        ll3_ =  0.;
+        ll2_ =  0.;
+        ll1_ =  0.;
+        ll0_ =  0.;
+        r_0_ =  0.;
+        r_1_ =  0.;
+        r_1_ =  -(v+ 40.0);
+        r_0_ =  10.0*exprelr(r_1_* 0.10000000000000001);
+        alpha =  0.10000000000000001*r_0_;
+        beta =  4.0*exp( -(v+ 65.0)* 0.055555555555555552);
+        sum = alpha+beta;
+        a_0_ =  -sum*params_.q10[tid_];
+        ba_0_ = alpha*params_.q10[tid_]/a_0_;
+        ll0_ = a_0_*dt;
+        ll1_ = ( 1.0+ 0.5*ll0_)/( 1.0- 0.5*ll0_);
+        params_.m[tid_] =  -ba_0_+(params_.m[tid_]+ba_0_)*ll1_;
+        alpha =  0.070000000000000007*exp( -(v+ 65.0)* 0.050000000000000003);
+        beta =  1.0/(exp( -(v+ 35.0)* 0.10000000000000001)+ 1.0);
+        sum = alpha+beta;
+        a_1_ =  -sum*params_.q10[tid_];
+        ba_1_ = alpha*params_.q10[tid_]/a_1_;
+        ll2_ = a_1_*dt;
+        ll3_ = ( 1.0+ 0.5*ll2_)/( 1.0- 0.5*ll2_);
+        params_.h[tid_] =  -ba_1_+(params_.h[tid_]+ba_1_)*ll3_;
+        r_2_ =  0.;
+        r_3_ =  0.;
+        r_3_ =  -(v+ 55.0);
+        r_2_ =  10.0*exprelr(r_3_* 0.10000000000000001);
+        alpha =  0.01*r_2_;
+        beta =  0.125*exp( -(v+ 65.0)* 0.012500000000000001);
+        sum = alpha+beta;
+        a_2_ =  -sum*params_.q10[tid_];
+        ba_2_ = alpha*params_.q10[tid_]/a_2_;
+        ll4_ = a_2_*dt;
+        ll5_ = ( 1.0+ 0.5*ll4_)/( 1.0- 0.5*ll4_);
+        params_.n[tid_] =  -ba_2_+(params_.n[tid_]+ba_2_)*ll5_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_hh_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_na_index_i_ = params_.ion_na_index_[tid_];
+        auto ion_k_index_i_ = params_.ion_k_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type il = 0;
+        value_type ek = params_.ion_k_.reversal_potential[ion_k_index_i_];
+        value_type ik = 0;
+        value_type ena = params_.ion_na_.reversal_potential[ion_na_index_i_];
+        value_type ina = 0;
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type n_, m_, n2, gk;
+        n_ = params_.n[tid_];
+        m_ = params_.m[tid_];
+        n2 = n_*n_;
+        gk = params_.gkbar[tid_]*n2*n2;
+        ina = params_.gnabar[tid_]*m_*m_*m_*params_.h[tid_]*(v-ena);
+        ik = gk*(v-ek);
+        il = params_.gl[tid_]*(v-params_.el[tid_]);
+        current_ = ik+il+ina;
+        conductivity_ = params_.gnabar[tid_]*m_*m_*m_*params_.h[tid_]+params_.gl[tid_]+gk;
+        params_.vec_g_[node_index_i_] = fma(10.0*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10.0*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+        params_.ion_k_.current_density[ion_k_index_i_] = fma(10.0*params_.weight_[tid_], ik, params_.ion_k_.current_density[ion_k_index_i_]);
+        params_.ion_na_.current_density[ion_na_index_i_] = fma(10.0*params_.weight_[tid_], ina, params_.ion_na_.current_density[ion_na_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_hh_nrn_init_(mechanism_gpu_hh_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_hh_nrn_current_(mechanism_gpu_hh_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_hh_nrn_state_(mechanism_gpu_hh_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_hh_write_ions_(mechanism_gpu_hh_pp_& p) {}
+
+} // namespace default_catalogue
+} // namespace arb
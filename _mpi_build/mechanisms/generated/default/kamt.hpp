@@ -0,0 +1,53 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+namespace default_catalogue {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_kamt();
+
+inline const ::arb::mechanism_info& mechanism_kamt_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+            {"a0m", {spec::global, "", 0.04}},
+            {"vhalfm", {spec::global, "", -45}},
+            {"zetam", {spec::global, "", 0.1}},
+            {"gmm", {spec::global, "", 0.75}},
+            {"a0h", {spec::global, "", 0.018}},
+            {"vhalfh", {spec::global, "", -70}},
+            {"zetah", {spec::global, "", 0.2}},
+            {"gmh", {spec::global, "", 0.99}},
+            {"sha", {spec::global, "", 9.9}},
+            {"shi", {spec::global, "", 5.7}}
+        },
+        // parameters
+        {
+            {"gbar", {spec::parameter, "mho / cm2", 0.002}},
+            {"q10", {spec::parameter, "", 3}}
+        },
+        // state variables
+        {
+            {"m", {spec::state, "", 0}},
+            {"h", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+            {"k", {false, false, true, false, false, false, 0}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        0
+    };
+
+    return info;
+}
+
+} // namespace default_catalogue
+} // namespace arb
@@ -0,0 +1,111 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace default_catalogue {
+
+struct mechanism_gpu_kdrmt_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type betm = 0.;
+    value_type alpm = 0.;
+    value_type a0m = 0.0035000000000000001;
+    value_type zetam = 0.055;
+    value_type gmm = 0.5;
+    value_type* minf;
+    value_type* q10;
+    value_type* mtau;
+    value_type* m;
+    value_type* gbar;
+    value_type* vhalfm;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+};
+
+void mechanism_gpu_kdrmt_nrn_init_(mechanism_gpu_kdrmt_pp_&);
+void mechanism_gpu_kdrmt_nrn_state_(mechanism_gpu_kdrmt_pp_&);
+void mechanism_gpu_kdrmt_nrn_current_(mechanism_gpu_kdrmt_pp_&);
+void mechanism_gpu_kdrmt_write_ions_(mechanism_gpu_kdrmt_pp_&);
+
+class mechanism_gpu_kdrmt: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "kdrmt"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_kdrmt()); }
+
+    void nrn_init() override {
+        mechanism_gpu_kdrmt_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_kdrmt_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_kdrmt_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_kdrmt_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() override { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"betm", &pp_.betm},
+            {"alpm", &pp_.alpm},
+            {"a0m", &pp_.a0m},
+            {"zetam", &pp_.zetam},
+            {"gmm", &pp_.gmm}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"minf", &pp_.minf},
+            {"q10", &pp_.q10},
+            {"mtau", &pp_.mtau},
+            {"m", &pp_.m},
+            {"gbar", &pp_.gbar},
+            {"vhalfm", &pp_.vhalfm}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"q10", 3.0},
+            {"gbar", 0.002},
+            {"vhalfm", -50.0}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &pp_.m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &pp_.ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &pp_.ion_k_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_kdrmt_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_kdrmt();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_kdrmt<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_kdrmt());
+}
+
+} // namespace default_catalogue
+} // namespace arb
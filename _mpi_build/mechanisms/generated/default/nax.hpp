@@ -0,0 +1,58 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+namespace default_catalogue {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_nax();
+
+inline const ::arb::mechanism_info& mechanism_nax_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+            {"tha", {spec::global, "mV", -30}},
+            {"qa", {spec::global, "mV", 7.2}},
+            {"Ra", {spec::global, "/ ms", 0.4}},
+            {"Rb", {spec::global, "/ ms", 0.124}},
+            {"thi1", {spec::global, "mV", -45}},
+            {"thi2", {spec::global, "mV", -45}},
+            {"qd", {spec::global, "mV", 1.5}},
+            {"qg", {spec::global, "mV", 1.5}},
+            {"mmin", {spec::global, "", 0.02}},
+            {"hmin", {spec::global, "", 0.5}},
+            {"q10", {spec::global, "", 2}},
+            {"Rg", {spec::global, "/ ms", 0.01}},
+            {"Rd", {spec::global, "/ ms", .03}},
+            {"thinf", {spec::global, "mV", -50}},
+            {"qinf", {spec::global, "mV", 4}}
+        },
+        // parameters
+        {
+            {"sh", {spec::parameter, "mV", 5}},
+            {"gbar", {spec::parameter, "mho / cm2", 0.010}}
+        },
+        // state variables
+        {
+            {"m", {spec::state, "", 0}},
+            {"h", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+            {"na", {false, false, true, false, false, false, 0}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        0
+    };
+
+    return info;
+}
+
+} // namespace default_catalogue
+} // namespace arb
@@ -0,0 +1,75 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+namespace default_catalogue {
+
+struct mechanism_gpu_pas_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* g;
+    value_type* e;
+};
+
+void mechanism_gpu_pas_nrn_init_(mechanism_gpu_pas_pp_&);
+void mechanism_gpu_pas_nrn_state_(mechanism_gpu_pas_pp_&);
+void mechanism_gpu_pas_nrn_current_(mechanism_gpu_pas_pp_&);
+void mechanism_gpu_pas_write_ions_(mechanism_gpu_pas_pp_&);
+
+class mechanism_gpu_pas: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "pas"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_pas()); }
+
+    void nrn_init() override {
+        mechanism_gpu_pas_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_pas_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_pas_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_pas_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() override { return &pp_; }
+
+    mechanism_field_table field_table() override {
+        return {
+            {"g", &pp_.g},
+            {"e", &pp_.e}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"g", 0.001},
+            {"e", -65.0}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+        };
+    }
+
+private:
+    mechanism_gpu_pas_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_pas();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_pas<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_pas());
+}
+
+} // namespace default_catalogue
+} // namespace arb
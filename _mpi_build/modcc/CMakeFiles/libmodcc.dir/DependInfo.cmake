@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modcc/astmanip.cpp" "modcc/CMakeFiles/libmodcc.dir/astmanip.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/astmanip.cpp.o.d"
+  "/root/repo/modcc/blocks.cpp" "modcc/CMakeFiles/libmodcc.dir/blocks.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/blocks.cpp.o.d"
+  "/root/repo/modcc/errorvisitor.cpp" "modcc/CMakeFiles/libmodcc.dir/errorvisitor.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/errorvisitor.cpp.o.d"
+  "/root/repo/modcc/expression.cpp" "modcc/CMakeFiles/libmodcc.dir/expression.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/expression.cpp.o.d"
+  "/root/repo/modcc/functionexpander.cpp" "modcc/CMakeFiles/libmodcc.dir/functionexpander.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/functionexpander.cpp.o.d"
+  "/root/repo/modcc/functioninliner.cpp" "modcc/CMakeFiles/libmodcc.dir/functioninliner.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/functioninliner.cpp.o.d"
+  "/root/repo/modcc/io/prefixbuf.cpp" "modcc/CMakeFiles/libmodcc.dir/io/prefixbuf.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/io/prefixbuf.cpp.o.d"
+  "/root/repo/modcc/kineticrewriter.cpp" "modcc/CMakeFiles/libmodcc.dir/kineticrewriter.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/kineticrewriter.cpp.o.d"
+  "/root/repo/modcc/lexer.cpp" "modcc/CMakeFiles/libmodcc.dir/lexer.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/lexer.cpp.o.d"
+  "/root/repo/modcc/linearrewriter.cpp" "modcc/CMakeFiles/libmodcc.dir/linearrewriter.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/linearrewriter.cpp.o.d"
+  "/root/repo/modcc/module.cpp" "modcc/CMakeFiles/libmodcc.dir/module.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/module.cpp.o.d"
+  "/root/repo/modcc/parser.cpp" "modcc/CMakeFiles/libmodcc.dir/parser.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/parser.cpp.o.d"
+  "/root/repo/modcc/printer/cexpr_emit.cpp" "modcc/CMakeFiles/libmodcc.dir/printer/cexpr_emit.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/printer/cexpr_emit.cpp.o.d"
+  "/root/repo/modcc/printer/cprinter.cpp" "modcc/CMakeFiles/libmodcc.dir/printer/cprinter.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/printer/cprinter.cpp.o.d"
+  "/root/repo/modcc/printer/gpuprinter.cpp" "modcc/CMakeFiles/libmodcc.dir/printer/gpuprinter.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/printer/gpuprinter.cpp.o.d"
+  "/root/repo/modcc/printer/infoprinter.cpp" "modcc/CMakeFiles/libmodcc.dir/printer/infoprinter.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/printer/infoprinter.cpp.o.d"
+  "/root/repo/modcc/printer/printerutil.cpp" "modcc/CMakeFiles/libmodcc.dir/printer/printerutil.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/printer/printerutil.cpp.o.d"
+  "/root/repo/modcc/solvers.cpp" "modcc/CMakeFiles/libmodcc.dir/solvers.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/solvers.cpp.o.d"
+  "/root/repo/modcc/symdiff.cpp" "modcc/CMakeFiles/libmodcc.dir/symdiff.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/symdiff.cpp.o.d"
+  "/root/repo/modcc/symge.cpp" "modcc/CMakeFiles/libmodcc.dir/symge.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/symge.cpp.o.d"
+  "/root/repo/modcc/token.cpp" "modcc/CMakeFiles/libmodcc.dir/token.cpp.o" "gcc" "modcc/CMakeFiles/libmodcc.dir/token.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/sup/ioutil.cpp" "sup/CMakeFiles/arbor-sup.dir/ioutil.cpp.o" "gcc" "sup/CMakeFiles/arbor-sup.dir/ioutil.cpp.o.d"
+  "/root/repo/sup/json_meter.cpp" "sup/CMakeFiles/arbor-sup.dir/json_meter.cpp.o" "gcc" "sup/CMakeFiles/arbor-sup.dir/json_meter.cpp.o.d"
+  "/root/repo/sup/path.cpp" "sup/CMakeFiles/arbor-sup.dir/path.cpp.o" "gcc" "sup/CMakeFiles/arbor-sup.dir/path.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mpi_build/arbor/CMakeFiles/arbor.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
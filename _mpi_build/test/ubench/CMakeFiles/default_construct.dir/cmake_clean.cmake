@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/default_construct"
+  "../../bin/default_construct.pdb"
+  "CMakeFiles/default_construct.dir/default_construct.cpp.o"
+  "CMakeFiles/default_construct.dir/default_construct.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/default_construct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/event_delivery"
+  "../../bin/event_delivery.pdb"
+  "CMakeFiles/event_delivery.dir/event_delivery.cpp.o"
+  "CMakeFiles/event_delivery.dir/event_delivery.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/event_delivery.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
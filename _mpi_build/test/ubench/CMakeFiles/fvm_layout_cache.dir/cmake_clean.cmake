@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/fvm_layout_cache"
+  "../../bin/fvm_layout_cache.pdb"
+  "CMakeFiles/fvm_layout_cache.dir/fvm_layout_cache.cpp.o"
+  "CMakeFiles/fvm_layout_cache.dir/fvm_layout_cache.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fvm_layout_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
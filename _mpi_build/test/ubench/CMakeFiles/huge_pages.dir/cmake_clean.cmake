@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/huge_pages"
+  "../../bin/huge_pages.pdb"
+  "CMakeFiles/huge_pages.dir/huge_pages.cpp.o"
+  "CMakeFiles/huge_pages.dir/huge_pages.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/huge_pages.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
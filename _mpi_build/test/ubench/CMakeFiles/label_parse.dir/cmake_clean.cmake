@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/label_parse"
+  "../../bin/label_parse.pdb"
+  "CMakeFiles/label_parse.dir/label_parse.cpp.o"
+  "CMakeFiles/label_parse.dir/label_parse.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/label_parse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
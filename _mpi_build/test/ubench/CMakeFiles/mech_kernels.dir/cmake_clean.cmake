@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/mech_kernels"
+  "../../bin/mech_kernels.pdb"
+  "CMakeFiles/mech_kernels.dir/mech_kernels.cpp.o"
+  "CMakeFiles/mech_kernels.dir/mech_kernels.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mech_kernels.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/merge_events"
+  "../../bin/merge_events.pdb"
+  "CMakeFiles/merge_events.dir/merge_events.cpp.o"
+  "CMakeFiles/merge_events.dir/merge_events.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merge_events.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/morphology_construction"
+  "../../bin/morphology_construction.pdb"
+  "CMakeFiles/morphology_construction.dir/morphology_construction.cpp.o"
+  "CMakeFiles/morphology_construction.dir/morphology_construction.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/morphology_construction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
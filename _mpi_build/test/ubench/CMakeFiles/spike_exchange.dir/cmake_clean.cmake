@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/spike_exchange"
+  "../../bin/spike_exchange.pdb"
+  "CMakeFiles/spike_exchange.dir/spike_exchange.cpp.o"
+  "CMakeFiles/spike_exchange.dir/spike_exchange.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spike_exchange.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/step_kernels"
+  "../../bin/step_kernels.pdb"
+  "CMakeFiles/step_kernels.dir/step_kernels.cpp.o"
+  "CMakeFiles/step_kernels.dir/step_kernels.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/step_kernels.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit-distributed/distributed_listener.cpp" "test/unit-distributed/CMakeFiles/unit-mpi.dir/distributed_listener.cpp.o" "gcc" "test/unit-distributed/CMakeFiles/unit-mpi.dir/distributed_listener.cpp.o.d"
+  "/root/repo/test/unit-distributed/test.cpp" "test/unit-distributed/CMakeFiles/unit-mpi.dir/test.cpp.o" "gcc" "test/unit-distributed/CMakeFiles/unit-mpi.dir/test.cpp.o.d"
+  "/root/repo/test/unit-distributed/test_communicator.cpp" "test/unit-distributed/CMakeFiles/unit-mpi.dir/test_communicator.cpp.o" "gcc" "test/unit-distributed/CMakeFiles/unit-mpi.dir/test_communicator.cpp.o.d"
+  "/root/repo/test/unit-distributed/test_domain_decomposition.cpp" "test/unit-distributed/CMakeFiles/unit-mpi.dir/test_domain_decomposition.cpp.o" "gcc" "test/unit-distributed/CMakeFiles/unit-mpi.dir/test_domain_decomposition.cpp.o.d"
+  "/root/repo/test/unit-distributed/test_mpi.cpp" "test/unit-distributed/CMakeFiles/unit-mpi.dir/test_mpi.cpp.o" "gcc" "test/unit-distributed/CMakeFiles/unit-mpi.dir/test_mpi.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mpi_build/test/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/arbor/CMakeFiles/arbor.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/arborenv/CMakeFiles/arborenv.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/sup/CMakeFiles/arbor-sup.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
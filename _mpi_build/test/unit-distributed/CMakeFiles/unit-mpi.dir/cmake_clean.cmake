@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../bin/unit-mpi"
+  "../../bin/unit-mpi.pdb"
+  "CMakeFiles/unit-mpi.dir/distributed_listener.cpp.o"
+  "CMakeFiles/unit-mpi.dir/distributed_listener.cpp.o.d"
+  "CMakeFiles/unit-mpi.dir/test.cpp.o"
+  "CMakeFiles/unit-mpi.dir/test.cpp.o.d"
+  "CMakeFiles/unit-mpi.dir/test_communicator.cpp.o"
+  "CMakeFiles/unit-mpi.dir/test_communicator.cpp.o.d"
+  "CMakeFiles/unit-mpi.dir/test_domain_decomposition.cpp.o"
+  "CMakeFiles/unit-mpi.dir/test_domain_decomposition.cpp.o.d"
+  "CMakeFiles/unit-mpi.dir/test_mpi.cpp.o"
+  "CMakeFiles/unit-mpi.dir/test_mpi.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-mpi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/modcc-simd-avx.dir/simd_avx/exp2syn_cpu.cpp.o"
+  "CMakeFiles/modcc-simd-avx.dir/simd_avx/exp2syn_cpu.cpp.o.d"
+  "CMakeFiles/modcc-simd-avx.dir/simd_avx/expsyn_cpu.cpp.o"
+  "CMakeFiles/modcc-simd-avx.dir/simd_avx/expsyn_cpu.cpp.o.d"
+  "simd_avx/exp2syn_cpu.cpp"
+  "simd_avx/expsyn_cpu.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/modcc-simd-avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_mpi_build/test/unit-modcc/simd_avx512/exp2syn_cpu.cpp" "test/unit-modcc/CMakeFiles/modcc-simd-avx512.dir/simd_avx512/exp2syn_cpu.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/modcc-simd-avx512.dir/simd_avx512/exp2syn_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit-modcc/simd_avx512/expsyn_cpu.cpp" "test/unit-modcc/CMakeFiles/modcc-simd-avx512.dir/simd_avx512/expsyn_cpu.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/modcc-simd-avx512.dir/simd_avx512/expsyn_cpu.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
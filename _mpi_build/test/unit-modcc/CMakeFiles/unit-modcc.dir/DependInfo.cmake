@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit-modcc/common.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/common.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/common.cpp.o.d"
+  "/root/repo/test/unit-modcc/driver.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/driver.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/driver.cpp.o.d"
+  "/root/repo/test/unit-modcc/expr_expand.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/expr_expand.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/expr_expand.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_fn_rewriters.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_fn_rewriters.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_fn_rewriters.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_kinetic_rewriter.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_kinetic_rewriter.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_kinetic_rewriter.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_lexer.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_lexer.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_lexer.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_module.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_module.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_module.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_msparse.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_msparse.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_msparse.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_parser.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_parser.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_parser.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_prefixbuf.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_prefixbuf.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_prefixbuf.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_printers.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_printers.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_printers.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_removelocals.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_removelocals.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_removelocals.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_simd_backend.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_simd_backend.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_simd_backend.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_symdiff.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_symdiff.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_symdiff.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_symge.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_symge.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_symge.cpp.o.d"
+  "/root/repo/test/unit-modcc/test_visitors.cpp" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_visitors.cpp.o" "gcc" "test/unit-modcc/CMakeFiles/unit-modcc.dir/test_visitors.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mpi_build/modcc/CMakeFiles/libmodcc.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/test/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,122 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/diam_test_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/diam_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/diam_test_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/diam_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/diam_test_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/diam_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/non_linear_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/non_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/non_linear_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/non_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/non_linear_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/non_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_eX_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/read_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_eX_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/read_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_eX_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/read_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_eX_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_eX_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_eX_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/write_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX.hpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,140 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_test_mods"
+  "mechanisms/ca_linear.hpp"
+  "mechanisms/ca_linear_cpu.cpp"
+  "mechanisms/ca_linear_gpu.cpp"
+  "mechanisms/ca_linear_gpu.cu"
+  "mechanisms/celsius_test.hpp"
+  "mechanisms/celsius_test_cpu.cpp"
+  "mechanisms/celsius_test_gpu.cpp"
+  "mechanisms/celsius_test_gpu.cu"
+  "mechanisms/diam_test.hpp"
+  "mechanisms/diam_test_cpu.cpp"
+  "mechanisms/diam_test_gpu.cpp"
+  "mechanisms/diam_test_gpu.cu"
+  "mechanisms/fixed_ica_current.hpp"
+  "mechanisms/fixed_ica_current_cpu.cpp"
+  "mechanisms/fixed_ica_current_gpu.cpp"
+  "mechanisms/fixed_ica_current_gpu.cu"
+  "mechanisms/linear_ca_conc.hpp"
+  "mechanisms/linear_ca_conc_cpu.cpp"
+  "mechanisms/linear_ca_conc_gpu.cpp"
+  "mechanisms/linear_ca_conc_gpu.cu"
+  "mechanisms/non_linear.hpp"
+  "mechanisms/non_linear_cpu.cpp"
+  "mechanisms/non_linear_gpu.cpp"
+  "mechanisms/non_linear_gpu.cu"
+  "mechanisms/param_as_state.hpp"
+  "mechanisms/param_as_state_cpu.cpp"
+  "mechanisms/param_as_state_gpu.cpp"
+  "mechanisms/param_as_state_gpu.cu"
+  "mechanisms/point_ica_current.hpp"
+  "mechanisms/point_ica_current_cpu.cpp"
+  "mechanisms/point_ica_current_gpu.cpp"
+  "mechanisms/point_ica_current_gpu.cu"
+  "mechanisms/read_cai_init.hpp"
+  "mechanisms/read_cai_init_cpu.cpp"
+  "mechanisms/read_cai_init_gpu.cpp"
+  "mechanisms/read_cai_init_gpu.cu"
+  "mechanisms/read_eX.hpp"
+  "mechanisms/read_eX_cpu.cpp"
+  "mechanisms/read_eX_gpu.cpp"
+  "mechanisms/read_eX_gpu.cu"
+  "mechanisms/test0_kin_compartment.hpp"
+  "mechanisms/test0_kin_compartment_cpu.cpp"
+  "mechanisms/test0_kin_compartment_gpu.cpp"
+  "mechanisms/test0_kin_compartment_gpu.cu"
+  "mechanisms/test0_kin_conserve.hpp"
+  "mechanisms/test0_kin_conserve_cpu.cpp"
+  "mechanisms/test0_kin_conserve_gpu.cpp"
+  "mechanisms/test0_kin_conserve_gpu.cu"
+  "mechanisms/test0_kin_diff.hpp"
+  "mechanisms/test0_kin_diff_cpu.cpp"
+  "mechanisms/test0_kin_diff_gpu.cpp"
+  "mechanisms/test0_kin_diff_gpu.cu"
+  "mechanisms/test0_kin_steadystate.hpp"
+  "mechanisms/test0_kin_steadystate_cpu.cpp"
+  "mechanisms/test0_kin_steadystate_gpu.cpp"
+  "mechanisms/test0_kin_steadystate_gpu.cu"
+  "mechanisms/test1_kin_compartment.hpp"
+  "mechanisms/test1_kin_compartment_cpu.cpp"
+  "mechanisms/test1_kin_compartment_gpu.cpp"
+  "mechanisms/test1_kin_compartment_gpu.cu"
+  "mechanisms/test1_kin_conserve.hpp"
+  "mechanisms/test1_kin_conserve_cpu.cpp"
+  "mechanisms/test1_kin_conserve_gpu.cpp"
+  "mechanisms/test1_kin_conserve_gpu.cu"
+  "mechanisms/test1_kin_diff.hpp"
+  "mechanisms/test1_kin_diff_cpu.cpp"
+  "mechanisms/test1_kin_diff_gpu.cpp"
+  "mechanisms/test1_kin_diff_gpu.cu"
+  "mechanisms/test1_kin_steadystate.hpp"
+  "mechanisms/test1_kin_steadystate_cpu.cpp"
+  "mechanisms/test1_kin_steadystate_gpu.cpp"
+  "mechanisms/test1_kin_steadystate_gpu.cu"
+  "mechanisms/test2_kin_diff.hpp"
+  "mechanisms/test2_kin_diff_cpu.cpp"
+  "mechanisms/test2_kin_diff_gpu.cpp"
+  "mechanisms/test2_kin_diff_gpu.cu"
+  "mechanisms/test3_kin_diff.hpp"
+  "mechanisms/test3_kin_diff_cpu.cpp"
+  "mechanisms/test3_kin_diff_gpu.cpp"
+  "mechanisms/test3_kin_diff_gpu.cu"
+  "mechanisms/test4_kin_compartment.hpp"
+  "mechanisms/test4_kin_compartment_cpu.cpp"
+  "mechanisms/test4_kin_compartment_gpu.cpp"
+  "mechanisms/test4_kin_compartment_gpu.cu"
+  "mechanisms/test_ca.hpp"
+  "mechanisms/test_ca_cpu.cpp"
+  "mechanisms/test_ca_gpu.cpp"
+  "mechanisms/test_ca_gpu.cu"
+  "mechanisms/test_ca_read_valence.hpp"
+  "mechanisms/test_ca_read_valence_cpu.cpp"
+  "mechanisms/test_ca_read_valence_gpu.cpp"
+  "mechanisms/test_ca_read_valence_gpu.cu"
+  "mechanisms/test_cl_valence.hpp"
+  "mechanisms/test_cl_valence_cpu.cpp"
+  "mechanisms/test_cl_valence_gpu.cpp"
+  "mechanisms/test_cl_valence_gpu.cu"
+  "mechanisms/test_kin1.hpp"
+  "mechanisms/test_kin1_cpu.cpp"
+  "mechanisms/test_kin1_gpu.cpp"
+  "mechanisms/test_kin1_gpu.cu"
+  "mechanisms/test_kinlva.hpp"
+  "mechanisms/test_kinlva_cpu.cpp"
+  "mechanisms/test_kinlva_gpu.cpp"
+  "mechanisms/test_kinlva_gpu.cu"
+  "mechanisms/test_linear_init.hpp"
+  "mechanisms/test_linear_init_cpu.cpp"
+  "mechanisms/test_linear_init_gpu.cpp"
+  "mechanisms/test_linear_init_gpu.cu"
+  "mechanisms/test_linear_init_shuffle.hpp"
+  "mechanisms/test_linear_init_shuffle_cpu.cpp"
+  "mechanisms/test_linear_init_shuffle_gpu.cpp"
+  "mechanisms/test_linear_init_shuffle_gpu.cu"
+  "mechanisms/test_linear_state.hpp"
+  "mechanisms/test_linear_state_cpu.cpp"
+  "mechanisms/test_linear_state_gpu.cpp"
+  "mechanisms/test_linear_state_gpu.cu"
+  "mechanisms/write_Xi_Xo.hpp"
+  "mechanisms/write_Xi_Xo_cpu.cpp"
+  "mechanisms/write_Xi_Xo_gpu.cpp"
+  "mechanisms/write_Xi_Xo_gpu.cu"
+  "mechanisms/write_cai_breakpoint.hpp"
+  "mechanisms/write_cai_breakpoint_cpu.cpp"
+  "mechanisms/write_cai_breakpoint_gpu.cpp"
+  "mechanisms/write_cai_breakpoint_gpu.cu"
+  "mechanisms/write_eX.hpp"
+  "mechanisms/write_eX_cpu.cpp"
+  "mechanisms/write_eX_gpu.cpp"
+  "mechanisms/write_eX_gpu.cu"
+  "mechanisms/write_multiple_eX.hpp"
+  "mechanisms/write_multiple_eX_cpu.cpp"
+  "mechanisms/write_multiple_eX_gpu.cpp"
+  "mechanisms/write_multiple_eX_gpu.cu"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/build_test_mods.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_mpi_build/test/unit/mechanisms/scalar/exp2syn_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/scalar/exp2syn.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/scalar/expsyn_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/scalar/expsyn.hpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
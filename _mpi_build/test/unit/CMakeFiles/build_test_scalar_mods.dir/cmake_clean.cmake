@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_test_scalar_mods"
+  "mechanisms/scalar/exp2syn.hpp"
+  "mechanisms/scalar/exp2syn_cpu.cpp"
+  "mechanisms/scalar/expsyn.hpp"
+  "mechanisms/scalar/expsyn_cpu.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/build_test_scalar_mods.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_test_simd_mods"
+  "mechanisms/simd/exp2syn.hpp"
+  "mechanisms/simd/exp2syn_cpu.cpp"
+  "mechanisms/simd/expsyn.hpp"
+  "mechanisms/simd/expsyn_cpu.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/build_test_simd_mods.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
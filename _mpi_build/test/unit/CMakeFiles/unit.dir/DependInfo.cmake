@@ -0,0 +1,256 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/common_cells.cpp" "test/unit/CMakeFiles/unit.dir/__/common_cells.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/__/common_cells.cpp.o.d"
+  "/root/repo/test/unit/mech_private_field_access.cpp" "test/unit/CMakeFiles/unit.dir/mech_private_field_access.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mech_private_field_access.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/ca_linear_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/ca_linear_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/celsius_test_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/celsius_test_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/diam_test_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/diam_test_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/diam_test_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/fixed_ica_current_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/fixed_ica_current_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/linear_ca_conc_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/linear_ca_conc_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/non_linear_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/non_linear_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/non_linear_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/param_as_state_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/param_as_state_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/point_ica_current_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/point_ica_current_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/read_cai_init_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/read_cai_init_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_eX_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/read_eX_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/read_eX_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/scalar/exp2syn_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/scalar/exp2syn_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/scalar/exp2syn_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/scalar/expsyn_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/scalar/expsyn_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/scalar/expsyn_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/simd/exp2syn_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/simd/exp2syn_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/simd/exp2syn_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/simd/expsyn_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/simd/expsyn_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/simd/expsyn_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test0_kin_compartment_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test0_kin_compartment_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test0_kin_conserve_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test0_kin_conserve_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test0_kin_diff_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test0_kin_diff_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test0_kin_steadystate_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test0_kin_steadystate_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test1_kin_compartment_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test1_kin_compartment_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test1_kin_conserve_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test1_kin_conserve_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test1_kin_diff_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test1_kin_diff_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test1_kin_steadystate_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test1_kin_steadystate_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test2_kin_diff_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test2_kin_diff_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test3_kin_diff_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test3_kin_diff_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test4_kin_compartment_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test4_kin_compartment_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test_ca_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test_ca_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test_ca_read_valence_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test_ca_read_valence_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test_cl_valence_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test_cl_valence_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test_kin1_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test_kin1_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test_kinlva_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test_kinlva_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test_linear_init_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test_linear_init_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test_linear_init_shuffle_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test_linear_init_shuffle_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/test_linear_state_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/test_linear_state_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/write_Xi_Xo_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/write_Xi_Xo_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/write_cai_breakpoint_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/write_cai_breakpoint_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_eX_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/write_eX_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/write_eX_cpu.cpp.o.d"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX_cpu.cpp" "test/unit/CMakeFiles/unit.dir/mechanisms/write_multiple_eX_cpu.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/mechanisms/write_multiple_eX_cpu.cpp.o.d"
+  "/root/repo/test/unit/stats.cpp" "test/unit/CMakeFiles/unit.dir/stats.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/stats.cpp.o.d"
+  "/root/repo/test/unit/test.cpp" "test/unit/CMakeFiles/unit.dir/test.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test.cpp.o.d"
+  "/root/repo/test/unit/test_algorithms.cpp" "test/unit/CMakeFiles/unit.dir/test_algorithms.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_algorithms.cpp.o.d"
+  "/root/repo/test/unit/test_any_cast.cpp" "test/unit/CMakeFiles/unit.dir/test_any_cast.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_any_cast.cpp.o.d"
+  "/root/repo/test/unit/test_any_ptr.cpp" "test/unit/CMakeFiles/unit.dir/test_any_ptr.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_any_ptr.cpp.o.d"
+  "/root/repo/test/unit/test_any_visitor.cpp" "test/unit/CMakeFiles/unit.dir/test_any_visitor.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_any_visitor.cpp.o.d"
+  "/root/repo/test/unit/test_backend.cpp" "test/unit/CMakeFiles/unit.dir/test_backend.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_backend.cpp.o.d"
+  "/root/repo/test/unit/test_cable_cell.cpp" "test/unit/CMakeFiles/unit.dir/test_cable_cell.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_cable_cell.cpp.o.d"
+  "/root/repo/test/unit/test_counter.cpp" "test/unit/CMakeFiles/unit.dir/test_counter.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_counter.cpp.o.d"
+  "/root/repo/test/unit/test_cv_geom.cpp" "test/unit/CMakeFiles/unit.dir/test_cv_geom.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_cv_geom.cpp.o.d"
+  "/root/repo/test/unit/test_cv_layout.cpp" "test/unit/CMakeFiles/unit.dir/test_cv_layout.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_cv_layout.cpp.o.d"
+  "/root/repo/test/unit/test_cv_policy.cpp" "test/unit/CMakeFiles/unit.dir/test_cv_policy.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_cv_policy.cpp.o.d"
+  "/root/repo/test/unit/test_cycle.cpp" "test/unit/CMakeFiles/unit.dir/test_cycle.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_cycle.cpp.o.d"
+  "/root/repo/test/unit/test_domain_decomposition.cpp" "test/unit/CMakeFiles/unit.dir/test_domain_decomposition.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_domain_decomposition.cpp.o.d"
+  "/root/repo/test/unit/test_double_buffer.cpp" "test/unit/CMakeFiles/unit.dir/test_double_buffer.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_double_buffer.cpp.o.d"
+  "/root/repo/test/unit/test_dry_run_context.cpp" "test/unit/CMakeFiles/unit.dir/test_dry_run_context.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_dry_run_context.cpp.o.d"
+  "/root/repo/test/unit/test_event_binner.cpp" "test/unit/CMakeFiles/unit.dir/test_event_binner.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_event_binner.cpp.o.d"
+  "/root/repo/test/unit/test_event_delivery.cpp" "test/unit/CMakeFiles/unit.dir/test_event_delivery.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_event_delivery.cpp.o.d"
+  "/root/repo/test/unit/test_event_generators.cpp" "test/unit/CMakeFiles/unit.dir/test_event_generators.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_event_generators.cpp.o.d"
+  "/root/repo/test/unit/test_event_queue.cpp" "test/unit/CMakeFiles/unit.dir/test_event_queue.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_event_queue.cpp.o.d"
+  "/root/repo/test/unit/test_expected.cpp" "test/unit/CMakeFiles/unit.dir/test_expected.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_expected.cpp.o.d"
+  "/root/repo/test/unit/test_filter.cpp" "test/unit/CMakeFiles/unit.dir/test_filter.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_filter.cpp.o.d"
+  "/root/repo/test/unit/test_fvm_layout.cpp" "test/unit/CMakeFiles/unit.dir/test_fvm_layout.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_fvm_layout.cpp.o.d"
+  "/root/repo/test/unit/test_fvm_lowered.cpp" "test/unit/CMakeFiles/unit.dir/test_fvm_lowered.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_fvm_lowered.cpp.o.d"
+  "/root/repo/test/unit/test_kinetic_linear.cpp" "test/unit/CMakeFiles/unit.dir/test_kinetic_linear.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_kinetic_linear.cpp.o.d"
+  "/root/repo/test/unit/test_lexcmp.cpp" "test/unit/CMakeFiles/unit.dir/test_lexcmp.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_lexcmp.cpp.o.d"
+  "/root/repo/test/unit/test_lif_cell_group.cpp" "test/unit/CMakeFiles/unit.dir/test_lif_cell_group.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_lif_cell_group.cpp.o.d"
+  "/root/repo/test/unit/test_local_context.cpp" "test/unit/CMakeFiles/unit.dir/test_local_context.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_local_context.cpp.o.d"
+  "/root/repo/test/unit/test_maputil.cpp" "test/unit/CMakeFiles/unit.dir/test_maputil.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_maputil.cpp.o.d"
+  "/root/repo/test/unit/test_mask_stream.cpp" "test/unit/CMakeFiles/unit.dir/test_mask_stream.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_mask_stream.cpp.o.d"
+  "/root/repo/test/unit/test_math.cpp" "test/unit/CMakeFiles/unit.dir/test_math.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_math.cpp.o.d"
+  "/root/repo/test/unit/test_matrix.cpp" "test/unit/CMakeFiles/unit.dir/test_matrix.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_matrix.cpp.o.d"
+  "/root/repo/test/unit/test_mc_cell_group.cpp" "test/unit/CMakeFiles/unit.dir/test_mc_cell_group.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_mc_cell_group.cpp.o.d"
+  "/root/repo/test/unit/test_mcable_map.cpp" "test/unit/CMakeFiles/unit.dir/test_mcable_map.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_mcable_map.cpp.o.d"
+  "/root/repo/test/unit/test_mech_temp_diam.cpp" "test/unit/CMakeFiles/unit.dir/test_mech_temp_diam.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_mech_temp_diam.cpp.o.d"
+  "/root/repo/test/unit/test_mechanisms.cpp" "test/unit/CMakeFiles/unit.dir/test_mechanisms.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_mechanisms.cpp.o.d"
+  "/root/repo/test/unit/test_mechcat.cpp" "test/unit/CMakeFiles/unit.dir/test_mechcat.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_mechcat.cpp.o.d"
+  "/root/repo/test/unit/test_mechinfo.cpp" "test/unit/CMakeFiles/unit.dir/test_mechinfo.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_mechinfo.cpp.o.d"
+  "/root/repo/test/unit/test_merge_events.cpp" "test/unit/CMakeFiles/unit.dir/test_merge_events.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_merge_events.cpp.o.d"
+  "/root/repo/test/unit/test_merge_view.cpp" "test/unit/CMakeFiles/unit.dir/test_merge_view.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_merge_view.cpp.o.d"
+  "/root/repo/test/unit/test_morph_components.cpp" "test/unit/CMakeFiles/unit.dir/test_morph_components.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_morph_components.cpp.o.d"
+  "/root/repo/test/unit/test_morph_embedding.cpp" "test/unit/CMakeFiles/unit.dir/test_morph_embedding.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_morph_embedding.cpp.o.d"
+  "/root/repo/test/unit/test_morph_expr.cpp" "test/unit/CMakeFiles/unit.dir/test_morph_expr.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_morph_expr.cpp.o.d"
+  "/root/repo/test/unit/test_morph_place.cpp" "test/unit/CMakeFiles/unit.dir/test_morph_place.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_morph_place.cpp.o.d"
+  "/root/repo/test/unit/test_morph_primitives.cpp" "test/unit/CMakeFiles/unit.dir/test_morph_primitives.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_morph_primitives.cpp.o.d"
+  "/root/repo/test/unit/test_morph_spatial_index.cpp" "test/unit/CMakeFiles/unit.dir/test_morph_spatial_index.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_morph_spatial_index.cpp.o.d"
+  "/root/repo/test/unit/test_morph_stitch.cpp" "test/unit/CMakeFiles/unit.dir/test_morph_stitch.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_morph_stitch.cpp.o.d"
+  "/root/repo/test/unit/test_morphology.cpp" "test/unit/CMakeFiles/unit.dir/test_morphology.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_morphology.cpp.o.d"
+  "/root/repo/test/unit/test_multi_event_stream.cpp" "test/unit/CMakeFiles/unit.dir/test_multi_event_stream.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_multi_event_stream.cpp.o.d"
+  "/root/repo/test/unit/test_ordered_forest.cpp" "test/unit/CMakeFiles/unit.dir/test_ordered_forest.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_ordered_forest.cpp.o.d"
+  "/root/repo/test/unit/test_padded.cpp" "test/unit/CMakeFiles/unit.dir/test_padded.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_padded.cpp.o.d"
+  "/root/repo/test/unit/test_partition.cpp" "test/unit/CMakeFiles/unit.dir/test_partition.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_partition.cpp.o.d"
+  "/root/repo/test/unit/test_partition_by_constraint.cpp" "test/unit/CMakeFiles/unit.dir/test_partition_by_constraint.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_partition_by_constraint.cpp.o.d"
+  "/root/repo/test/unit/test_path.cpp" "test/unit/CMakeFiles/unit.dir/test_path.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_path.cpp.o.d"
+  "/root/repo/test/unit/test_piecewise.cpp" "test/unit/CMakeFiles/unit.dir/test_piecewise.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_piecewise.cpp.o.d"
+  "/root/repo/test/unit/test_pp_util.cpp" "test/unit/CMakeFiles/unit.dir/test_pp_util.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_pp_util.cpp.o.d"
+  "/root/repo/test/unit/test_probe.cpp" "test/unit/CMakeFiles/unit.dir/test_probe.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_probe.cpp.o.d"
+  "/root/repo/test/unit/test_range.cpp" "test/unit/CMakeFiles/unit.dir/test_range.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_range.cpp.o.d"
+  "/root/repo/test/unit/test_ratelem.cpp" "test/unit/CMakeFiles/unit.dir/test_ratelem.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_ratelem.cpp.o.d"
+  "/root/repo/test/unit/test_recipe.cpp" "test/unit/CMakeFiles/unit.dir/test_recipe.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_recipe.cpp.o.d"
+  "/root/repo/test/unit/test_s_expr.cpp" "test/unit/CMakeFiles/unit.dir/test_s_expr.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_s_expr.cpp.o.d"
+  "/root/repo/test/unit/test_schedule.cpp" "test/unit/CMakeFiles/unit.dir/test_schedule.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_schedule.cpp.o.d"
+  "/root/repo/test/unit/test_scope_exit.cpp" "test/unit/CMakeFiles/unit.dir/test_scope_exit.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_scope_exit.cpp.o.d"
+  "/root/repo/test/unit/test_segment_tree.cpp" "test/unit/CMakeFiles/unit.dir/test_segment_tree.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_segment_tree.cpp.o.d"
+  "/root/repo/test/unit/test_simd.cpp" "test/unit/CMakeFiles/unit.dir/test_simd.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_simd.cpp.o.d"
+  "/root/repo/test/unit/test_simulation.cpp" "test/unit/CMakeFiles/unit.dir/test_simulation.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_simulation.cpp.o.d"
+  "/root/repo/test/unit/test_span.cpp" "test/unit/CMakeFiles/unit.dir/test_span.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_span.cpp.o.d"
+  "/root/repo/test/unit/test_spike_codec.cpp" "test/unit/CMakeFiles/unit.dir/test_spike_codec.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_spike_codec.cpp.o.d"
+  "/root/repo/test/unit/test_spike_source.cpp" "test/unit/CMakeFiles/unit.dir/test_spike_source.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_spike_source.cpp.o.d"
+  "/root/repo/test/unit/test_spike_store.cpp" "test/unit/CMakeFiles/unit.dir/test_spike_store.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_spike_store.cpp.o.d"
+  "/root/repo/test/unit/test_spikes.cpp" "test/unit/CMakeFiles/unit.dir/test_spikes.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_spikes.cpp.o.d"
+  "/root/repo/test/unit/test_stats.cpp" "test/unit/CMakeFiles/unit.dir/test_stats.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_stats.cpp.o.d"
+  "/root/repo/test/unit/test_strprintf.cpp" "test/unit/CMakeFiles/unit.dir/test_strprintf.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_strprintf.cpp.o.d"
+  "/root/repo/test/unit/test_swcio.cpp" "test/unit/CMakeFiles/unit.dir/test_swcio.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_swcio.cpp.o.d"
+  "/root/repo/test/unit/test_synapses.cpp" "test/unit/CMakeFiles/unit.dir/test_synapses.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_synapses.cpp.o.d"
+  "/root/repo/test/unit/test_thread.cpp" "test/unit/CMakeFiles/unit.dir/test_thread.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_thread.cpp.o.d"
+  "/root/repo/test/unit/test_threading_exceptions.cpp" "test/unit/CMakeFiles/unit.dir/test_threading_exceptions.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_threading_exceptions.cpp.o.d"
+  "/root/repo/test/unit/test_topology.cpp" "test/unit/CMakeFiles/unit.dir/test_topology.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_topology.cpp.o.d"
+  "/root/repo/test/unit/test_transform.cpp" "test/unit/CMakeFiles/unit.dir/test_transform.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_transform.cpp.o.d"
+  "/root/repo/test/unit/test_tree.cpp" "test/unit/CMakeFiles/unit.dir/test_tree.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_tree.cpp.o.d"
+  "/root/repo/test/unit/test_uninitialized.cpp" "test/unit/CMakeFiles/unit.dir/test_uninitialized.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_uninitialized.cpp.o.d"
+  "/root/repo/test/unit/test_unique.cpp" "test/unit/CMakeFiles/unit.dir/test_unique.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_unique.cpp.o.d"
+  "/root/repo/test/unit/test_unique_any.cpp" "test/unit/CMakeFiles/unit.dir/test_unique_any.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_unique_any.cpp.o.d"
+  "/root/repo/test/unit/test_vector.cpp" "test/unit/CMakeFiles/unit.dir/test_vector.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_vector.cpp.o.d"
+  "/root/repo/test/unit/test_version.cpp" "test/unit/CMakeFiles/unit.dir/test_version.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/test_version.cpp.o.d"
+  "/root/repo/test/unit/unit_test_catalogue.cpp" "test/unit/CMakeFiles/unit.dir/unit_test_catalogue.cpp.o" "gcc" "test/unit/CMakeFiles/unit.dir/unit_test_catalogue.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/ca_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/celsius_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/diam_test_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/diam_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/diam_test_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/diam_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/diam_test_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/diam_test.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/fixed_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/linear_ca_conc.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/non_linear_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/non_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/non_linear_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/non_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/non_linear_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/non_linear.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/param_as_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/point_ica_current.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/read_cai_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_eX_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/read_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_eX_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/read_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/read_eX_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/read_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/scalar/exp2syn_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/scalar/exp2syn.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/scalar/expsyn_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/scalar/expsyn.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/simd/exp2syn_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/simd/exp2syn.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/simd/expsyn_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/simd/expsyn.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test0_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_conserve.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test1_kin_steadystate.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test2_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test3_kin_diff.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test4_kin_compartment.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_ca_read_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_cl_valence.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_kin1.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_kinlva.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_init_shuffle.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/test_linear_state.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/write_Xi_Xo.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/write_cai_breakpoint.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_eX_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_eX_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_eX_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/write_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX_cpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX_gpu.cpp" "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX.hpp"
+  "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX_gpu.cu" "/root/repo/_mpi_build/test/unit/mechanisms/write_multiple_eX.hpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mpi_build/test/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/arbor/CMakeFiles/arbor.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/arborenv/CMakeFiles/arborenv.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/arborio/CMakeFiles/arborio.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/sup/CMakeFiles/arbor-sup.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
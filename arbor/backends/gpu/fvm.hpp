@@ -65,6 +65,19 @@ struct backend {
             context);
     }
 
+    // Cell group updates are not shared between host threads.
+    static void set_thread_team(unsigned, const execution_context&, shared_state&, matrix_state&, threshold_watcher&) {}
+
+    // Cell groups of single-CV cells take the general integration path.
+    struct single_cv_integrator {
+        single_cv_integrator() = default;
+        single_cv_integrator(shared_state&, matrix_state&, threshold_watcher&,
+            const std::vector<arb::mechanism*>&, const std::vector<arb::mechanism*>&) {}
+
+        bool active() const { return false; }
+        void step(value_type, value_type, sample_event_stream&, array&, array&) {}
+    };
+
     static value_type* mechanism_field_data(arb::mechanism* mptr, const std::string& field);
 };
 
@@ -197,6 +197,17 @@ void mechanism::set_parameter(const std::string& key, const std::vector<fvm_valu
     }
 }
 
+void mechanism::set_global(const std::string& key, fvm_value_type value) {
+    if (auto opt_ptr = value_by_key(global_table(), key)) {
+        // Take reference to corresponding derived (generated) mechanism value member.
+        value_type& global = *opt_ptr.value();
+        global = value;
+    }
+    else {
+        throw arbor_internal_error("gpu/mechanism: no such mechanism global");
+    }
+}
+
 fvm_value_type* mechanism::field_data(const std::string& field_var) {
     if (auto opt_ptr = value_by_key(field_table(), field_var)) {
         return *opt_ptr.value();
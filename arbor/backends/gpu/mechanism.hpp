@@ -69,6 +69,7 @@ public:
     }
 
     void set_parameter(const std::string& key, const std::vector<fvm_value_type>& values) override;
+    void set_global(const std::string& key, fvm_value_type value) override;
 
     // Peek into mechanism state variable; implements arb::gpu::backend::mechanism_field_data.
     // Returns pointer to GPU memory corresponding to state variable data.
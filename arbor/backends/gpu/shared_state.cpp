@@ -36,7 +36,9 @@ void add_gj_current_impl(
 
 void take_samples_impl(
     const multi_event_stream_state<raw_probe_info>& s,
-    const fvm_value_type* time, fvm_value_type* sample_time, fvm_value_type* sample_value);
+    const fvm_value_type* time, fvm_value_type* sample_time, fvm_value_type* sample_value,
+    fvm_size_type n_row, const fvm_index_type* row_divs, const fvm_index_type* row_cv,
+    const fvm_value_type* row_coef, fvm_value_type* row_value, const fvm_value_type* voltage);
 
 void add_scalar(std::size_t n, fvm_value_type* data, fvm_value_type v);
 
@@ -127,6 +129,20 @@ void shared_state::add_ion(
         std::forward_as_tuple(charge, ion_info, 1u));
 }
 
+void shared_state::set_transfer(
+    const std::vector<fvm_index_type>& row_divs,
+    const std::vector<fvm_index_type>& cv,
+    const std::vector<fvm_value_type>& coef)
+{
+    arb_assert(!row_divs.empty() && row_divs.back()==(fvm_index_type)cv.size());
+    arb_assert(cv.size()==coef.size());
+
+    transfer_row_divs = iarray(make_const_view(row_divs));
+    transfer_cv = iarray(make_const_view(cv));
+    transfer_coef = array(make_const_view(coef));
+    transfer_value = array(row_divs.size()-1, 0);
+}
+
 void shared_state::reset() {
     memory::copy(init_voltage, voltage);
     memory::fill(current_density, 0);
@@ -174,7 +190,9 @@ std::pair<fvm_value_type, fvm_value_type> shared_state::voltage_bounds() const {
 }
 
 void shared_state::take_samples(const sample_event_stream::state& s, array& sample_time, array& sample_value) {
-    take_samples_impl(s, time.data(), sample_time.data(), sample_value.data());
+    take_samples_impl(s, time.data(), sample_time.data(), sample_value.data(),
+        transfer_value.size(), transfer_row_divs.data(), transfer_cv.data(),
+        transfer_coef.data(), transfer_value.data(), voltage.data());
 }
 
 // Debug interface
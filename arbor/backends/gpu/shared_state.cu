@@ -71,7 +71,13 @@ __global__ void take_samples_impl(
     multi_event_stream_state<raw_probe_info> s,
     const fvm_value_type* __restrict__ const time,
     fvm_value_type* __restrict__ const sample_time,
-    fvm_value_type* __restrict__ const sample_value)
+    fvm_value_type* __restrict__ const sample_value,
+    unsigned n_row,
+    const fvm_index_type* __restrict__ const row_divs,
+    const fvm_index_type* __restrict__ const row_cv,
+    const fvm_value_type* __restrict__ const row_coef,
+    fvm_value_type* __restrict__ const row_value,
+    const fvm_value_type* __restrict__ const voltage)
 {
     unsigned i = threadIdx.x+blockIdx.x*blockDim.x;
     if (i<s.n) {
@@ -79,7 +85,19 @@ __global__ void take_samples_impl(
         auto end = s.ev_data+s.end_offset[i];
         for (auto p = begin; p!=end; ++p) {
             sample_time[p->offset] = time[i];
-            sample_value[p->offset] = *p->handle;
+            if (p->handle>=row_value && p->handle<row_value+n_row) {
+                // Evaluate the row of the transfer map.
+                auto r = p->handle-row_value;
+                fvm_value_type x = 0;
+                for (auto k = row_divs[r]; k<row_divs[r+1]; ++k) {
+                    x += row_coef[k]*voltage[row_cv[k]];
+                }
+                row_value[r] = x;
+                sample_value[p->offset] = x;
+            }
+            else {
+                sample_value[p->offset] = *p->handle;
+            }
         }
     }
 }
@@ -130,13 +148,16 @@ void add_gj_current_impl(
 
 void take_samples_impl(
     const multi_event_stream_state<raw_probe_info>& s,
-    const fvm_value_type* time, fvm_value_type* sample_time, fvm_value_type* sample_value)
+    const fvm_value_type* time, fvm_value_type* sample_time, fvm_value_type* sample_value,
+    fvm_size_type n_row, const fvm_index_type* row_divs, const fvm_index_type* row_cv,
+    const fvm_value_type* row_coef, fvm_value_type* row_value, const fvm_value_type* voltage)
 {
     if (!s.n_streams()) return;
 
     constexpr int block_dim = 128;
     const int nblock = block_count(s.n_streams(), block_dim);
-    kernel::take_samples_impl<<<nblock, block_dim>>>(s, time, sample_time, sample_value);
+    kernel::take_samples_impl<<<nblock, block_dim>>>(s, time, sample_time, sample_value,
+        n_row, row_divs, row_cv, row_coef, row_value, voltage);
 }
 
 } // namespace gpu
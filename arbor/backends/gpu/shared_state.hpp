@@ -81,6 +81,15 @@ struct shared_state {
 
     std::unordered_map<std::string, ion_state> ion_data;
 
+    // Sparse map, in compressed row form, from CV voltages to the values of
+    // probes that are linear in the voltages, such as extracellular potentials.
+    // A row is evaluated when a sample is taken with a handle into
+    // transfer_value.
+    iarray transfer_row_divs; // Partitions transfer_cv and transfer_coef by row.
+    iarray transfer_cv;       // CV index of each coefficient.
+    array transfer_coef;      // Coefficients [mV/mV].
+    array transfer_value;     // Row values at the last sample [mV].
+
     deliverable_event_stream deliverable_events;
 
     shared_state() = default;
@@ -100,6 +109,12 @@ struct shared_state {
         int charge,
         const fvm_ion_config& ion_data);
 
+    // Set the sparse transfer map; invalidates handles into transfer_value.
+    void set_transfer(
+        const std::vector<fvm_index_type>& row_divs,
+        const std::vector<fvm_index_type>& cv,
+        const std::vector<fvm_value_type>& coef);
+
     void zero_currents();
 
     void ions_init_concentration();
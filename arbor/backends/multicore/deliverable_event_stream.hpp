@@ -0,0 +1,149 @@
+#pragma once
+
+// Deliverable events partitioned by mechanism --- multicore back-end.
+//
+// Each point mechanism in a cell group has its own multi-event stream, with
+// one stream per integration domain, so that event delivery to a mechanism
+// only visits the events that target it. Events without a mechanism, such as
+// those that stop integration at exact sample times, are kept in a stream of
+// their own: they bound the integration step, but are not delivered.
+
+#include <utility>
+#include <vector>
+
+#include <arbor/fvm_types.hpp>
+
+#include "backends/event.hpp"
+#include "backends/multicore/multi_event_stream.hpp"
+
+namespace arb {
+namespace multicore {
+
+class deliverable_event_stream {
+public:
+    using size_type = fvm_size_type;
+    using stream_type = multi_event_stream<deliverable_event>;
+    using state = stream_type::state;
+
+    deliverable_event_stream() {}
+
+    explicit deliverable_event_stream(size_type n_stream):
+        n_stream_(n_stream), other_(n_stream), empty_offsets_(n_stream, 0)
+    {}
+
+    size_type n_streams() const { return n_stream_; }
+
+    // Make room for the events of mechanisms with ids up to and including mech_id.
+    void add_mechanism(size_type mech_id) {
+        while (streams_.size()<=mech_id) {
+            streams_.emplace_back(n_stream_);
+        }
+    }
+
+    bool empty() const {
+        for (auto& s: streams_) {
+            if (!s.empty()) return false;
+        }
+        return other_.empty();
+    }
+
+    void clear() {
+        for (auto& s: streams_) {
+            s.clear();
+        }
+        other_.clear();
+    }
+
+    // Initialize event streams from a vector of events, sorted by integration
+    // domain and then by time. The order is kept within each mechanism.
+    void init(const std::vector<deliverable_event>& staged) {
+        // One bucket per mechanism, and a last one for other events.
+        auto n = streams_.size();
+        buckets_.resize(n+1);
+        for (auto& b: buckets_) {
+            b.clear();
+        }
+        for (auto& ev: staged) {
+            auto id = ev.handle.mech_id;
+            buckets_[id<n? id: n].push_back(ev);
+        }
+        for (size_type i = 0; i<n; ++i) {
+            streams_[i].init(std::move(buckets_[i]));
+        }
+        other_.init(std::move(buckets_[n]));
+    }
+
+    // Mark, drop and look ahead as for multi_event_stream; streams without
+    // any remaining events are skipped.
+
+    template <typename TimeSeq>
+    void mark_until_after(const TimeSeq& t_until) {
+        for_each_nonempty([&](stream_type& s) { s.mark_until_after(t_until); });
+    }
+
+    template <typename TimeSeq>
+    void mark_until(const TimeSeq& t_until) {
+        for_each_nonempty([&](stream_type& s) { s.mark_until(t_until); });
+    }
+
+    void drop_marked_events() {
+        for_each_nonempty([](stream_type& s) { s.drop_marked_events(); });
+    }
+
+    template <typename TimeSeq>
+    void event_time_if_before(TimeSeq& t_until) {
+        for_each_nonempty([&](stream_type& s) { s.event_time_if_before(t_until); });
+    }
+
+    // Marked events of the mechanism with id mech_id.
+    state marked_events(size_type mech_id) const {
+        return marked_events(mech_id, 0, n_stream_);
+    }
+
+    // As above, restricted to the streams [first, last).
+
+    template <typename TimeSeq>
+    void mark_until_after(const TimeSeq& t_until, size_type first, size_type last) {
+        for_each_nonempty([&](stream_type& s) { s.mark_until_after(t_until, first, last); });
+    }
+
+    void drop_marked_events(size_type first, size_type last) {
+        for_each_nonempty([&](stream_type& s) { s.drop_marked_events(first, last); });
+    }
+
+    template <typename TimeSeq>
+    void event_time_if_before(TimeSeq& t_until, size_type first, size_type last) {
+        for_each_nonempty([&](stream_type& s) { s.event_time_if_before(t_until, first, last); });
+    }
+
+    state marked_events(size_type mech_id, size_type first, size_type last) const {
+        if (mech_id<streams_.size()) {
+            return streams_[mech_id].marked_events(first, last);
+        }
+        return {last-first, nullptr, empty_offsets_.data(), empty_offsets_.data()};
+    }
+
+private:
+    size_type n_stream_ = 0;
+    std::vector<stream_type> streams_;
+
+    // Events that target no mechanism.
+    stream_type other_;
+
+    template <typename F>
+    void for_each_nonempty(F&& f) {
+        for (auto& s: streams_) {
+            if (!s.empty()) f(s);
+        }
+        if (!other_.empty()) f(other_);
+    }
+
+    // Per-mechanism staging buffers.
+    std::vector<std::vector<deliverable_event>> buckets_;
+
+    // Offsets of the marked events of a mechanism without a stream.
+    std::vector<fvm_index_type> empty_offsets_;
+};
+
+} // namespace multicore
+} // namespace arb
@@ -10,6 +10,8 @@
 #include "backends/multicore/multi_event_stream.hpp"
 #include "backends/multicore/multicore_common.hpp"
 #include "backends/multicore/shared_state.hpp"
+#include "backends/multicore/single_cv_integrator.hpp"
+#include "backends/multicore/thread_team.hpp"
 #include "backends/multicore/threshold_watcher.hpp"
 #include "execution_context.hpp"
 #include "util/padded_alloc.hpp"
@@ -47,6 +49,8 @@ struct backend {
     using shared_state = arb::multicore::shared_state;
     using ion_state = arb::multicore::ion_state;
 
+    using single_cv_integrator = arb::multicore::single_cv_integrator;
+
     static threshold_watcher voltage_watcher(
         const shared_state& state,
         const std::vector<index_type>& cv,
@@ -63,6 +67,26 @@ struct backend {
             context);
     }
 
+    // Share the mechanism, matrix and threshold updates of a cell group over
+    // a team of team_size threads from the context's thread pool.
+    static void set_thread_team(
+        unsigned team_size,
+        const execution_context& context,
+        shared_state& state,
+        matrix_state& matrix,
+        threshold_watcher& watcher)
+    {
+#ifdef ARB_HAVE_PROFILING
+        // Profiler regions can not nest, and a thread waiting on its team may
+        // run the update of another cell group.
+        team_size = 1;
+#endif
+        thread_team team{context.thread_pool.get(), team_size};
+        state.team = team;
+        matrix.set_thread_team(team);
+        watcher.set_thread_team(team);
+    }
+
     static fvm_value_type* mechanism_field_data(arb::mechanism* mptr, const std::string& field);
 };
 
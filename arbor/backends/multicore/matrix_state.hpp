@@ -1,11 +1,14 @@
 #pragma once
 
+#include <algorithm>
+
 #include <util/partition.hpp>
 #include <util/span.hpp>
 
 #include <memory/memory.hpp>
 
 #include "multicore_common.hpp"
+#include "thread_team.hpp"
 
 namespace arb {
 namespace multicore {
@@ -36,6 +39,14 @@ public:
     // the invariant part of the matrix diagonal
     array invariant_d;         // [μS]
 
+    // Cells are assembled and solved in parts by the thread team.
+    thread_team team;
+    std::vector<index_type> team_cell_divs = {0, 0};
+
+    // True if every cell has exactly one CV. The matrix is then diagonal,
+    // and is assembled and solved in flat loops over the CVs.
+    bool single_cv = false;
+
     matrix_state() = default;
 
     matrix_state(const std::vector<index_type>& p,
@@ -56,6 +67,9 @@ public:
         arb_assert(cond.size() == size());
         arb_assert(cell_cv_divs.back() == (index_type)size());
 
+        team_cell_divs = {0, index_type(cell_cv_divs.size()-1)};
+        single_cv = cell_cv_divs.size()-1==size();
+
         auto n = size();
         invariant_d = array(n, 0);
         for (auto i: util::make_span(1u, n)) {
@@ -83,11 +97,58 @@ public:
     //   current density [A.m^-2]  (per control volume)
     //   conductivity    [kS.m^-2] (per control volume)
     void assemble(const_view dt_intdom, const_view voltage, const_view current, const_view conductivity) {
+        if (single_cv) {
+            team.run(team_cell_divs, [&](index_type first, index_type last) {
+                assemble_diagonal(first, last, dt_intdom, voltage, current, conductivity);
+            });
+            return;
+        }
+        team.run(team_cell_divs, [&](index_type first, index_type last) {
+            assemble(first, last, dt_intdom, voltage, current, conductivity);
+        });
+    }
+
+    void solve() {
+        if (single_cv) {
+            team.run(team_cell_divs, [&](index_type first, index_type last) { solve_diagonal(first, last); });
+            return;
+        }
+        team.run(team_cell_divs, [&](index_type first, index_type last) { solve(first, last); });
+    }
+
+    template<typename VTo>
+    void solve(VTo& to) {
+        solve();
+        memory::copy(rhs, to);
+    }
+
+    // With one CV per cell, assemble and solve the system for the CVs
+    // [first, last) only, and store the solution in voltage.
+    void solve_diagonal(index_type first, index_type last, const_view dt_intdom, array& voltage, const_view current, const_view conductivity) {
+        assemble_diagonal(first, last, dt_intdom, voltage, current, conductivity);
+        solve_diagonal(first, last);
+        std::copy(rhs.begin()+first, rhs.begin()+last, voltage.begin()+first);
+    }
+
+    // Partition cells by CV count over the team.
+    void set_thread_team(const thread_team& t) {
+        team = t;
+        team_cell_divs = team.partition(cell_cv_divs.size()-1, cell_cv_divs, [](auto) { return true; });
+    }
+
+private:
+
+    std::size_t size() const {
+        return parent_index.size();
+    }
+
+    // Assemble and solve the matrices of cells [first_cell, last_cell).
+
+    void assemble(index_type first_cell, index_type last_cell, const_view dt_intdom, const_view voltage, const_view current, const_view conductivity) {
         auto cell_cv_part = util::partition_view(cell_cv_divs);
-        const index_type ncells = cell_cv_part.size();
 
         // loop over submatrices
-        for (auto m: util::make_span(0, ncells)) {
+        for (auto m: util::make_span(first_cell, last_cell)) {
             auto dt = dt_intdom[cell_to_intdom[m]];
 
             if (dt>0) {
@@ -111,9 +172,47 @@ public:
         }
     }
 
-    void solve() {
+    // With one CV per cell, cell m is CV m: assemble the diagonal in a single
+    // flat loop over the CVs, with the arithmetic of assemble().
+    void assemble_diagonal(index_type first, index_type last, const_view dt_intdom, const_view voltage, const_view current, const_view conductivity) {
+        const value_type* dt_ptr = dt_intdom.data();
+        const index_type* intdom_ptr = cell_to_intdom.data();
+        const value_type* cap_ptr = cv_capacitance.data();
+        const value_type* area_ptr = cv_area.data();
+        const value_type* inv_d_ptr = invariant_d.data();
+        const value_type* v_ptr = voltage.data();
+        const value_type* i_ptr = current.data();
+        const value_type* g_ptr = conductivity.data();
+        value_type* d_ptr = d.data();
+        value_type* rhs_ptr = rhs.data();
+
+        for (index_type i = first; i<last; ++i) {
+            auto dt = dt_ptr[intdom_ptr[i]];
+            auto area_factor = 1e-3*area_ptr[i]; // [1e-9·m²]
+            auto gi = (1e-3/dt)*cap_ptr[i] + area_factor*g_ptr[i]; // [μS]
+
+            d_ptr[i] = dt>0? gi + inv_d_ptr[i]: 0;
+            rhs_ptr[i] = dt>0? gi*v_ptr[i] - area_factor*i_ptr[i]: v_ptr[i];
+        }
+    }
+
+    // Solve a diagonal system; as in solve(), a zero diagonal leaves the
+    // right hand side unchanged.
+    void solve_diagonal(index_type first, index_type last) {
+        const value_type* d_ptr = d.data();
+        value_type* rhs_ptr = rhs.data();
+
+        for (index_type i = first; i<last; ++i) {
+            rhs_ptr[i] = d_ptr[i]!=0? rhs_ptr[i]/d_ptr[i]: rhs_ptr[i];
+        }
+    }
+
+    void solve(index_type first_cell, index_type last_cell) {
+        auto cell_cv_part = util::partition_view(cell_cv_divs);
+
         // loop over submatrices
-        for (auto cv_span: util::partition_view(cell_cv_divs)) {
+        for (auto m: util::make_span(first_cell, last_cell)) {
+            auto cv_span = cell_cv_part[m];
             auto first = cv_span.first;
             auto last = cv_span.second; // one past the end
 
@@ -134,18 +233,6 @@ public:
             }
         }
     }
-
-    template<typename VTo>
-    void solve(VTo& to) {
-        solve();
-        memory::copy(rhs, to);
-    }
-
-private:
-
-    std::size_t size() const {
-        return parent_index.size();
-    }
 };
 
 } // namespace multicore
@@ -114,6 +114,8 @@ void mechanism::instantiate(unsigned id, backend::shared_state& shared, const me
     vec_t_ptr_        = &shared.time;
     vec_t_to_ptr_     = &shared.time_to;
     event_stream_ptr_ = &shared.deliverable_events;
+    event_stream_ptr_->add_mechanism(id);
+    team_             = &shared.team;
 
     // If there are no sites (is this ever meaningful?) there is nothing more to do.
     if (width_==0) {
@@ -197,6 +199,42 @@ void mechanism::set_parameter(const std::string& key, const std::vector<fvm_valu
     }
 }
 
+void mechanism::set_global(const std::string& key, fvm_value_type value) {
+    if (auto opt_ptr = value_by_key(global_table(), key)) {
+        // Take reference to corresponding derived (generated) mechanism value member.
+        value_type& global = *opt_ptr.value();
+        global = value;
+    }
+    else {
+        throw arbor_internal_error("multicore/mechanism: no such mechanism global");
+    }
+}
+
+std::vector<fvm_index_type> mechanism::instance_divs(const std::vector<index_type>& cv_divs) const {
+    auto first = node_index_.begin();
+    auto last = first+width_;
+    if (!std::is_sorted(first, last)) return {};
+
+    std::vector<index_type> divs;
+    for (auto cv: cv_divs) {
+        divs.push_back(std::lower_bound(first, last, cv)-first);
+    }
+    return divs;
+}
+
+// Instances at the same CV are kept in the one part, as their contributions
+// accumulate into the same shared state. (Instances are ordered by CV.)
+
+bool mechanism::share_work() {
+    if (!has_range_kernels() || !team_->active() || width_==0) return false;
+
+    if (team_divs_.empty()) {
+        team_divs_ = team_->partition(width_,
+            [this](size_type i) { return node_index_[i]!=node_index_[i-1]; });
+    }
+    return team_divs_.size()>2;
+}
+
 void mechanism::initialize() {
     vec_t_ = vec_t_ptr_->data();
     nrn_init();
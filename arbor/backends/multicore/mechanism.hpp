@@ -14,6 +14,7 @@
 #include "backends/multicore/multicore_common.hpp"
 #include "backends/multicore/partition_by_constraint.hpp"
 #include "backends/multicore/fvm.hpp"
+#include "backends/multicore/thread_team.hpp"
 
 
 namespace arb {
@@ -59,23 +60,63 @@ public:
     void initialize() override;
 
     void deliver_events() override {
-        // Delegate to derived class, passing in event queue state.
-        deliver_events(event_stream_ptr_->marked_events());
+        // Delegate to derived class, passing in the state of the event
+        // queue of this mechanism.
+        deliver_events(event_stream_ptr_->marked_events(mechanism_id_));
     }
     void update_current() override {
         vec_t_ = vec_t_ptr_->data();
-        nrn_current();
+        if (share_work()) {
+            team_->run(team_divs_, [this](size_type b, size_type e) { nrn_current_range(b, e); });
+        }
+        else {
+            nrn_current();
+        }
     }
     void update_state() override {
         vec_t_ = vec_t_ptr_->data();
-        nrn_state();
+        if (share_work()) {
+            team_->run(team_divs_, [this](size_type b, size_type e) { nrn_state_range(b, e); });
+        }
+        else {
+            nrn_state();
+        }
     }
     void update_ions() override {
         vec_t_ = vec_t_ptr_->data();
-        write_ions();
+        if (share_work()) {
+            team_->run(team_divs_, [this](size_type b, size_type e) { write_ions_range(b, e); });
+        }
+        else {
+            write_ions();
+        }
     }
 
+    // Updates of a part of the cell group, for integration in parts: deliver
+    // the marked events of the integration domains [first, last), and update
+    // the currents or state of the instances [begin, end). The instance
+    // updates require range kernels.
+
+    void deliver_events(size_type first, size_type last) {
+        deliver_events(event_stream_ptr_->marked_events(mechanism_id_, first, last));
+    }
+    void update_current(size_type begin, size_type end) {
+        vec_t_ = vec_t_ptr_->data();
+        nrn_current_range(begin, end);
+    }
+    void update_state(size_type begin, size_type end) {
+        vec_t_ = vec_t_ptr_->data();
+        nrn_state_range(begin, end);
+    }
+
+    virtual bool has_range_kernels() const { return false; }
+
+    // Divisions of the instances by the CV divisions cv_divs, or an empty
+    // vector if the instances are not ordered by CV.
+    std::vector<index_type> instance_divs(const std::vector<index_type>& cv_divs) const;
+
     void set_parameter(const std::string& key, const std::vector<fvm_value_type>& values) override;
+    void set_global(const std::string& key, fvm_value_type value) override;
 
     // Peek into mechanism state variable; implements arb::multicore::backend::mechanism_field_data.
     fvm_value_type* field_data(const std::string& state_var);
@@ -101,6 +142,11 @@ protected:
     const array* vec_t_to_ptr_;
     deliverable_event_stream* event_stream_ptr_;
 
+    // Thread team of the shared state, and the partition of instances over
+    // the team, computed on first use.
+    const thread_team* team_ = nullptr;
+    std::vector<index_type> team_divs_;
+
     // Per-mechanism index and weight data, excepting ion indices.
 
     iarray node_index_;
@@ -166,6 +212,19 @@ protected:
     virtual void nrn_current() {};
     virtual void deliver_events(deliverable_event_stream::state) {};
     virtual void write_ions() {};
+
+    // Generated mechanisms may also implement the state, current and ion
+    // updates over a range [begin, end) of instances, allowing the thread
+    // team to update disjoint ranges concurrently; has_range_kernels() above
+    // is then true.
+
+    virtual void nrn_state_range(size_type begin, size_type end) {};
+    virtual void nrn_current_range(size_type begin, size_type end) {};
+    virtual void write_ions_range(size_type begin, size_type end) {};
+
+private:
+    // True if updates are to be split over the thread team.
+    bool share_work();
 };
 
 } // namespace multicore
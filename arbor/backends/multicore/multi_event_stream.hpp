@@ -95,12 +95,44 @@ public:
     // until `event_time(ev)` > `t_until[i]`.
     template <typename TimeSeq>
     void mark_until_after(const TimeSeq& t_until) {
-        using ::arb::event_time;
+        arb_assert(n_streams()==std::size(t_until));
+        mark_until_after(t_until, 0, n_streams());
+    }
 
+    // Designate for processing events `ev` at head of each event stream `i`
+    // while `t_until[i]` > `event_time(ev)`.
+    template <typename TimeSeq>
+    void mark_until(const TimeSeq& t_until) {
         arb_assert(n_streams()==std::size(t_until));
+        mark_until(t_until, 0, n_streams());
+    }
+
+    // Remove marked events from front of each event stream.
+    void drop_marked_events() {
+        drop_marked_events(0, n_streams());
+    }
+
+    // Interface for access to marked events by mechanisms/kernels:
+    state marked_events() const {
+        return marked_events(0, n_streams());
+    }
+
+    // If the head of `i`th event stream exists and has time less than `t_until[i]`, set
+    // `t_until[i]` to the event time.
+    template <typename TimeSeq>
+    void event_time_if_before(TimeSeq& t_until) {
+        event_time_if_before(t_until, 0, n_streams());
+    }
+
+    // As above, restricted to the event streams [first, last); `t_until` is
+    // indexed by stream.
+
+    template <typename TimeSeq>
+    void mark_until_after(const TimeSeq& t_until, size_type first, size_type last) {
+        using ::arb::event_time;
 
         // note: operation on each `i` is independent.
-        for (size_type i = 0; i<n_streams(); ++i) {
+        for (size_type i = first; i<last; ++i) {
             auto end = span_end_[i];
             auto t = t_until[i];
 
@@ -112,16 +144,12 @@ public:
         }
     }
 
-    // Designate for processing events `ev` at head of each event stream `i`
-    // while `t_until[i]` > `event_time(ev)`.
     template <typename TimeSeq>
-    void mark_until(const TimeSeq& t_until) {
+    void mark_until(const TimeSeq& t_until, size_type first, size_type last) {
         using ::arb::event_time;
 
-        arb_assert(n_streams()==std::size(t_until));
-
         // note: operation on each `i` is independent.
-        for (size_type i = 0; i<n_streams(); ++i) {
+        for (size_type i = first; i<last; ++i) {
             auto end = span_end_[i];
             auto t = t_until[i];
 
@@ -133,28 +161,25 @@ public:
         }
     }
 
-    // Remove marked events from front of each event stream.
-    void drop_marked_events() {
+    void drop_marked_events(size_type first, size_type last) {
         // note: operation on each `i` is independent.
-        for (size_type i = 0; i<n_streams(); ++i) {
+        for (size_type i = first; i<last; ++i) {
             remaining_ -= (mark_[i]-span_begin_[i]);
             span_begin_[i] = mark_[i];
         }
     }
 
-    // Interface for access to marked events by mechanisms/kernels:
-    state marked_events() const {
-        return {n_streams(), ev_data_.data(), span_begin_.data(), mark_.data()};
+    // Marked events of streams [first, last), as streams [0, last-first).
+    state marked_events(size_type first, size_type last) const {
+        return {last-first, ev_data_.data(), span_begin_.data()+first, mark_.data()+first};
     }
 
-    // If the head of `i`th event stream exists and has time less than `t_until[i]`, set
-    // `t_until[i]` to the event time.
     template <typename TimeSeq>
-    void event_time_if_before(TimeSeq& t_until) {
+    void event_time_if_before(TimeSeq& t_until, size_type first, size_type last) {
         using ::arb::event_time;
 
         // note: operation on each `i` is independent.
-        for (size_type i = 0; i<n_streams(); ++i) {
+        for (size_type i = first; i<last; ++i) {
             if (span_begin_[i]==span_end_[i]) {
                continue;
             }
@@ -3,7 +3,7 @@
 // Storage classes and other common types across
 // multicore back end implementations.
 //
-// Defines array, iarray, and specialized multi-event stream classes.
+// Defines array, iarray, and specialized event stream classes.
 
 #include <utility>
 #include <vector>
@@ -13,6 +13,7 @@
 #include "backends/event.hpp"
 #include "util/padded_alloc.hpp"
 
+#include "deliverable_event_stream.hpp"
 #include "multi_event_stream.hpp"
 
 namespace arb {
@@ -25,7 +26,6 @@ using array  = padded_vector<fvm_value_type>;
 using iarray = padded_vector<fvm_index_type>;
 using gjarray = padded_vector<fvm_gap_junction>;
 
-using deliverable_event_stream = arb::multicore::multi_event_stream<deliverable_event>;
 using sample_event_stream = arb::multicore::multi_event_stream<sample_event>;
 
 } // namespace multicore
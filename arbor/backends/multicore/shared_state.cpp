@@ -142,6 +142,20 @@ void shared_state::add_ion(
         std::forward_as_tuple(charge, ion_info, alignment));
 }
 
+void shared_state::set_transfer(
+    const std::vector<fvm_index_type>& row_divs,
+    const std::vector<fvm_index_type>& cv,
+    const std::vector<fvm_value_type>& coef)
+{
+    arb_assert(!row_divs.empty() && row_divs.back()==(fvm_index_type)cv.size());
+    arb_assert(cv.size()==coef.size());
+
+    transfer_row_divs = iarray(row_divs.begin(), row_divs.end(), pad(alignment));
+    transfer_cv = iarray(cv.begin(), cv.end(), pad(alignment));
+    transfer_coef = array(coef.begin(), coef.end(), pad(alignment));
+    transfer_value = array(row_divs.size()-1, 0, pad(alignment));
+}
+
 void shared_state::reset() {
     std::copy(init_voltage.begin(), init_voltage.end(), voltage.begin());
     util::fill(current_density, 0);
@@ -225,20 +239,70 @@ std::pair<fvm_value_type, fvm_value_type> shared_state::voltage_bounds() const {
 void shared_state::take_samples(
     const sample_event_stream::state& s,
     array& sample_time,
-    array& sample_value)
+    array& sample_value,
+    fvm_size_type first_intdom)
 {
+    // Evaluate the rows of the transfer map spanned by the sampled rows
+    // before the sample values are copied. Rows are ordered by cell, so
+    // the rows sampled from distinct integration domains of a single-CV
+    // group, which may be sampled concurrently, do not overlap.
+    if (!transfer_value.empty()) {
+        const fvm_value_type* row_begin = transfer_value.data();
+        const fvm_value_type* row_end = row_begin+transfer_value.size();
+
+        fvm_size_type r_begin = transfer_value.size(), r_end = 0;
+        for (fvm_size_type i = 0; i<s.n_streams(); ++i) {
+            for (auto p = s.begin_marked(i); p<s.end_marked(i); ++p) {
+                if (p->handle>=row_begin && p->handle<row_end) {
+                    fvm_size_type r = p->handle-row_begin;
+                    r_begin = std::min(r_begin, r);
+                    r_end = std::max(r_end, r+1);
+                }
+            }
+        }
+        if (r_begin<r_end) transfer_rows(r_begin, r_end);
+    }
+
     for (fvm_size_type i = 0; i<s.n_streams(); ++i) {
         auto begin = s.begin_marked(i);
         auto end = s.end_marked(i);
 
         // (Note: probably not worth explicitly vectorizing this.)
         for (auto p = begin; p<end; ++p) {
-            sample_time[p->offset] = time[i];
+            sample_time[p->offset] = time[first_intdom+i];
             sample_value[p->offset] = *p->handle;
         }
     }
 }
 
+void shared_state::transfer_rows(fvm_size_type r_begin, fvm_size_type r_end) {
+    using simd::assign;
+    using simd::indirect;
+
+    // Rows run over the CVs of a cell, so each row is vectorized over its
+    // coefficients, with a scalar remainder.
+    for (auto r = r_begin; r<r_end; ++r) {
+        fvm_index_type k = transfer_row_divs[r];
+        const fvm_index_type end = transfer_row_divs[r+1];
+
+        simd_value_type acc(0.);
+        for (; k+simd_width<=end; k+=simd_width) {
+            simd_index_type cv;
+            simd_value_type coef, v;
+            assign(cv, indirect(transfer_cv.data()+k, simd_width));
+            assign(coef, indirect(transfer_coef.data()+k, simd_width));
+            assign(v, indirect(voltage.data(), cv, simd_width));
+            acc = fma(coef, v, acc);
+        }
+
+        fvm_value_type x = simd::sum(acc);
+        for (; k<end; ++k) {
+            x += transfer_coef[k]*voltage[transfer_cv[k]];
+        }
+        transfer_value[r] = x;
+    }
+}
+
 // (Debug interface only.)
 std::ostream& operator<<(std::ostream& out, const shared_state& s) {
     using io::csv;
@@ -22,6 +22,7 @@
 
 #include "fvm_layout.hpp"
 #include "multicore_common.hpp"
+#include "thread_team.hpp"
 
 namespace arb {
 namespace multicore {
@@ -98,8 +99,19 @@ struct shared_state {
 
     std::unordered_map<std::string, ion_state> ion_data;
 
+    // Sparse map, in compressed row form, from CV voltages to the values of
+    // probes that are linear in the voltages, such as extracellular potentials.
+    // A row is evaluated when a sample is taken with a handle into
+    // transfer_value.
+    iarray transfer_row_divs; // Partitions transfer_cv and transfer_coef by row.
+    iarray transfer_cv;       // CV index of each coefficient.
+    array transfer_coef;      // Coefficients [mV/mV].
+    array transfer_value;     // Row values at the last sample [mV].
+
     deliverable_event_stream deliverable_events;
 
+    thread_team team;         // Threads sharing the work of mechanism updates.
+
     shared_state() = default;
 
     shared_state(
@@ -117,6 +129,12 @@ struct shared_state {
         int charge,
         const fvm_ion_config& ion_data);
 
+    // Set the sparse transfer map; invalidates handles into transfer_value.
+    void set_transfer(
+        const std::vector<fvm_index_type>& row_divs,
+        const std::vector<fvm_index_type>& cv,
+        const std::vector<fvm_value_type>& coef);
+
     void zero_currents();
 
     void ions_init_concentration();
@@ -140,10 +158,15 @@ struct shared_state {
     std::pair<fvm_value_type, fvm_value_type> voltage_bounds() const;
 
     // Take samples according to marked events in a sample_event_stream.
+    // The streams of s are those of the integration domains from first_intdom.
     void take_samples(
         const sample_event_stream::state& s,
         array& sample_time,
-        array& sample_value);
+        array& sample_value,
+        fvm_size_type first_intdom = 0);
+
+    // Evaluate rows [r_begin, r_end) of the transfer map into transfer_value.
+    void transfer_rows(fvm_size_type r_begin, fvm_size_type r_end);
 
     void reset();
 };
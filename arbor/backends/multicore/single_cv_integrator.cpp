@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <vector>
+
+#include <arbor/fvm_types.hpp>
+#include <arbor/mechanism.hpp>
+
+#include "backends/multicore/mechanism.hpp"
+#include "backends/multicore/single_cv_integrator.hpp"
+#include "util/rangeutil.hpp"
+
+namespace arb {
+namespace multicore {
+
+single_cv_integrator::single_cv_integrator(
+    shared_state& state,
+    matrix_state& matrix,
+    threshold_watcher& watcher,
+    const std::vector<arb::mechanism*>& revpot_mechanisms,
+    const std::vector<arb::mechanism*>& mechanisms):
+    state_(&state),
+    matrix_(&matrix),
+    watcher_(&watcher)
+{
+    if (!matrix.single_cv || state.n_gj || state.team.active()) return;
+
+    // Every CV must be an integration domain of its own.
+    for (size_type i = 0; i<state.n_cv; ++i) {
+        if (state.cv_to_intdom[i]!=(index_type)i) return;
+    }
+
+    for (size_type b = 0; b<state.n_cv; b += block_size) {
+        block_divs_.push_back(b);
+    }
+    block_divs_.push_back(state.n_cv);
+
+    auto add_blocks = [this](std::vector<mechanism_blocks>& blocks, arb::mechanism* m) {
+        auto mech = dynamic_cast<mechanism*>(m);
+        if (!mech || !mech->has_range_kernels()) return false;
+
+        auto divs = mech->instance_divs(block_divs_);
+        if (divs.empty()) return false;
+
+        blocks.push_back({mech, std::move(divs)});
+        return true;
+    };
+
+    for (auto m: revpot_mechanisms) {
+        if (!add_blocks(revpot_, m)) return;
+    }
+    for (auto m: mechanisms) {
+        if (!add_blocks(mechanisms_, m)) return;
+    }
+
+    // Crossings are reported in order of detector, and so must be tested in
+    // that order.
+    const auto& detector_cv = watcher.cv_index();
+    if (!std::is_sorted(detector_cv.begin(), detector_cv.end())) return;
+    for (auto cv: block_divs_) {
+        detector_divs_.push_back(std::lower_bound(detector_cv.begin(), detector_cv.end(), cv)-detector_cv.begin());
+    }
+
+    active_ = true;
+}
+
+// The updates of each block are those of the general loop, in the same order,
+// and give identical results.
+
+void single_cv_integrator::step(
+    value_type dt_step,
+    value_type tmax,
+    sample_event_stream& samples,
+    array& sample_time,
+    array& sample_value)
+{
+    auto& s = *state_;
+
+    for (auto& i: s.ion_data) {
+        i.second.zero_current();
+    }
+
+    size_type n_block = block_divs_.size()-1;
+    for (size_type k = 0; k<n_block; ++k) {
+        index_type b = block_divs_[k];
+        index_type e = block_divs_[k+1];
+
+        // Reversal potentials, event delivery and current contributions.
+
+        for (auto& m: revpot_) {
+            m.mech->update_current(m.divs[k], m.divs[k+1]);
+        }
+
+        s.deliverable_events.mark_until_after(s.time, b, e);
+
+        std::fill(s.current_density.begin()+b, s.current_density.begin()+e, 0);
+        std::fill(s.conductivity.begin()+b, s.conductivity.begin()+e, 0);
+        for (auto& m: mechanisms_) {
+            m.mech->deliver_events(b, e);
+            m.mech->update_current(m.divs[k], m.divs[k+1]);
+        }
+
+        s.deliverable_events.drop_marked_events(b, e);
+
+        // Integration step times; CV, integration domain and cell coincide.
+
+        for (index_type i = b; i<e; ++i) {
+            s.time_to[i] = std::min(s.time[i]+dt_step, tmax);
+        }
+        s.deliverable_events.event_time_if_before(s.time_to, b, e);
+        for (index_type i = b; i<e; ++i) {
+            s.dt_intdom[i] = s.time_to[i]-s.time[i];
+            s.dt_cv[i] = s.dt_intdom[i];
+        }
+
+        // Samples, voltage and mechanism state, threshold crossings.
+
+        samples.mark_until(s.time_to, b, e);
+        s.take_samples(samples.marked_events(b, e), sample_time, sample_value, b);
+        samples.drop_marked_events(b, e);
+
+        matrix_->solve_diagonal(b, e, s.dt_intdom, s.voltage, s.current_density, s.conductivity);
+
+        for (auto& m: mechanisms_) {
+            m.mech->update_state(m.divs[k], m.divs[k+1]);
+        }
+
+        watcher_->test(detector_divs_[k], detector_divs_[k+1]);
+    }
+}
+
+} // namespace multicore
+} // namespace arb
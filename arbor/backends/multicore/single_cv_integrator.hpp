@@ -0,0 +1,85 @@
+#pragma once
+
+// Integration of cell groups in which every cell has a single CV.
+//
+// Each update of the general integration loop in fvm_lowered_cell_impl is a
+// pass over all the CVs of the cell group. When every cell has one CV and
+// there are no gap junctions, each CV is an integration domain of its own,
+// and the updates of a step for a CV depend only on the state of that CV.
+// The step is then taken in one pass over blocks of CVs, with the revpot and
+// current kernels, event delivery, time step computation, sampling, matrix
+// solve, state kernels and threshold tests all applied to a block while its
+// state is in cache.
+
+#include <vector>
+
+#include <arbor/fvm_types.hpp>
+#include <arbor/mechanism.hpp>
+
+#include "backends/multicore/matrix_state.hpp"
+#include "backends/multicore/multicore_common.hpp"
+#include "backends/multicore/shared_state.hpp"
+#include "backends/multicore/threshold_watcher.hpp"
+
+namespace arb {
+namespace multicore {
+
+class mechanism;
+
+class single_cv_integrator {
+public:
+    using value_type = fvm_value_type;
+    using index_type = fvm_index_type;
+    using size_type = fvm_size_type;
+    using matrix_state = arb::multicore::matrix_state<value_type, index_type>;
+
+    // CVs per block.
+    static constexpr size_type block_size = 64;
+
+    single_cv_integrator() = default;
+
+    // The integrator is active only if every cell has one CV, there are no
+    // gap junctions, the work of the cell group is not shared over a thread
+    // team, and every mechanism has range kernels and instances ordered by CV.
+    single_cv_integrator(
+        shared_state& state,
+        matrix_state& matrix,
+        threshold_watcher& watcher,
+        const std::vector<arb::mechanism*>& revpot_mechanisms,
+        const std::vector<arb::mechanism*>& mechanisms);
+
+    bool active() const { return active_; }
+
+    // Take one step of at most dt_step, ending no later than tmax, up to and
+    // including the threshold tests: the caller then updates the ion state
+    // and advances the time, as in the general loop.
+    void step(
+        value_type dt_step,
+        value_type tmax,
+        sample_event_stream& samples,
+        array& sample_time,
+        array& sample_value);
+
+private:
+    bool active_ = false;
+
+    shared_state* state_ = nullptr;
+    matrix_state* matrix_ = nullptr;
+    threshold_watcher* watcher_ = nullptr;
+
+    // A mechanism with the divisions of its instances by block.
+    struct mechanism_blocks {
+        mechanism* mech;
+        std::vector<index_type> divs;
+    };
+
+    std::vector<mechanism_blocks> revpot_;
+    std::vector<mechanism_blocks> mechanisms_;
+
+    // Divisions of the CVs, and of the threshold detectors, by block.
+    std::vector<index_type> block_divs_;
+    std::vector<index_type> detector_divs_;
+};
+
+} // namespace multicore
+} // namespace arb
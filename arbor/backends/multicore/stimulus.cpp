@@ -21,8 +21,14 @@ public:
     void nrn_init() override {}
     void nrn_state() override {}
     void nrn_current() override {
-        size_type n = size();
-        for (size_type i=0; i<n; ++i) {
+        nrn_current_range(0, size());
+    }
+    void write_ions() override {}
+    void deliver_events(deliverable_event_stream::state events) override {}
+
+    bool has_range_kernels() const override { return true; }
+    void nrn_current_range(size_type begin, size_type end) override {
+        for (size_type i=begin; i<end; ++i) {
             auto cv = node_index_[i];
             auto t = vec_t_[vec_ci_[cv]];
 
@@ -32,8 +38,6 @@ public:
             }
         }
     }
-    void write_ions() override {}
-    void deliver_events(deliverable_event_stream::state events) override {}
 
 protected:
     std::size_t object_sizeof() const override { return sizeof(*this); }
@@ -0,0 +1,72 @@
+#pragma once
+
+// A team of threads from the task system that shares the work of updating
+// one cell group. Kernels split their index range into contiguous parts, one
+// per team member, that can be updated concurrently.
+
+#include <algorithm>
+#include <vector>
+
+#include <arbor/fvm_types.hpp>
+
+#include "threading/threading.hpp"
+
+namespace arb {
+namespace multicore {
+
+struct thread_team {
+    threading::task_system* pool = nullptr;
+    unsigned size = 1;
+
+    // Parts smaller than this are not worth the cost of a task.
+    static constexpr unsigned min_part_size = 512;
+
+    bool active() const { return pool && size>1; }
+
+    // Call f(begin, end) for each part [divs[i], divs[i+1]) of a partition.
+    template <typename F>
+    void run(const std::vector<fvm_index_type>& divs, F&& f) const {
+        int n = (int)divs.size()-1;
+        if (n==1 || !active()) {
+            if (n>0) f(divs.front(), divs.back());
+        }
+        else {
+            threading::parallel_for::apply(0, n, pool,
+                [&](int i) { f(divs[i], divs[i+1]); });
+        }
+    }
+
+    // Partition [0, n) into at most size parts of roughly equal weight,
+    // where weight_divs[i] is the total weight of [0, i). A part may only
+    // begin at i if can_split(i).
+    template <typename Divs, typename Pred>
+    std::vector<fvm_index_type> partition(fvm_size_type n, const Divs& weight_divs, Pred&& can_split) const {
+        std::vector<fvm_index_type> divs = {0};
+        if (!n) return divs;
+
+        double total = weight_divs[n]-weight_divs[0];
+        unsigned n_part = active()? std::max(1u, std::min(size, unsigned(total/min_part_size))): 1u;
+
+        fvm_size_type i = 1;
+        for (unsigned p = 1; p<n_part; ++p) {
+            double target = weight_divs[0]+total*p/n_part;
+            while (i<n && (weight_divs[i]<target || !can_split(i))) ++i;
+            if (i==n) break;
+            divs.push_back(i++);
+        }
+        divs.push_back(n);
+        return divs;
+    }
+
+    // Partition [0, n) into at most size parts of roughly equal length.
+    template <typename Pred>
+    std::vector<fvm_index_type> partition(fvm_size_type n, Pred&& can_split) const {
+        struct identity {
+            double operator[](fvm_size_type i) const { return i; }
+        };
+        return partition(n, identity{}, can_split);
+    }
+};
+
+} // namespace multicore
+} // namespace arb
@@ -7,6 +7,7 @@
 #include "backends/threshold_crossing.hpp"
 #include "execution_context.hpp"
 #include "multicore_common.hpp"
+#include "thread_team.hpp"
 
 namespace arb {
 namespace multicore {
@@ -64,9 +65,55 @@ public:
     /// Crossing events are recorded for each threshold that
     /// is crossed since the last call to test
     void test() {
+        if (team_divs_.size()<=2) {
+            test(0, n_cv_, crossings_);
+            return;
+        }
+
+        // Crossings found by each part are appended in order of detector index.
+        auto n_part = team_divs_.size()-1;
+        team_crossings_.resize(n_part);
+        threading::parallel_for::apply(0, n_part, team_.pool,
+            [this](int p) { test(team_divs_[p], team_divs_[p+1], team_crossings_[p]); });
+
+        for (auto& c: team_crossings_) {
+            crossings_.insert(crossings_.end(), c.begin(), c.end());
+            c.clear();
+        }
+    }
+
+    /// Tests the detectors [first, last) only; crossings are recorded as
+    /// for test().
+    void test(fvm_size_type first, fvm_size_type last) {
+        test(first, last, crossings_);
+    }
+
+    // Partition detectors over the team.
+    void set_thread_team(const thread_team& team) {
+        team_ = team;
+        team_divs_ = team_.partition(n_cv_, [](auto) { return true; });
+    }
+
+    bool is_crossed(fvm_size_type i) const {
+        return is_crossed_[i];
+    }
+
+    /// The number of threshold values that are monitored.
+    std::size_t size() const {
+        return n_cv_;
+    }
+
+    /// The CV of each detector.
+    const std::vector<fvm_index_type>& cv_index() const {
+        return cv_index_;
+    }
+
+private:
+    // Test detectors [first, last).
+    void test(fvm_size_type first, fvm_size_type last, std::vector<threshold_crossing>& crossings) {
         const fvm_value_type* t_before = t_before_ptr_->data();
         const fvm_value_type* t_after  = t_after_ptr_->data();
-        for (fvm_size_type i = 0; i<n_cv_; ++i) {
+        for (fvm_size_type i = first; i<last; ++i) {
             auto cv     = cv_index_[i];
             auto cell   = cv_to_intdom_[cv];
             auto v_prev = v_prev_[i];
@@ -79,7 +126,7 @@ public:
                     // linear interpolation.
                     auto pos = (thresh - v_prev)/(v - v_prev);
                     auto crossing_time = math::lerp(t_before[cell], t_after[cell], pos);
-                    crossings_.push_back({i, crossing_time});
+                    crossings.push_back({i, crossing_time});
 
                     is_crossed_[i] = true;
                 }
@@ -94,16 +141,6 @@ public:
         }
     }
 
-    bool is_crossed(fvm_size_type i) const {
-        return is_crossed_[i];
-    }
-
-    /// The number of threshold values that are monitored.
-    std::size_t size() const {
-        return n_cv_;
-    }
-
-private:
     /// Non-owning pointers to cv-to-intdom map,
     /// the values for to test against thresholds,
     /// and pointers to the time arrays
@@ -119,6 +156,11 @@ private:
     std::vector<fvm_value_type> thresholds_;
     std::vector<fvm_value_type> v_prev_;
     std::vector<threshold_crossing> crossings_;
+
+    /// Partition of detectors over the thread team, and per-part crossings.
+    thread_team team_;
+    std::vector<fvm_index_type> team_divs_;
+    std::vector<std::vector<threshold_crossing>> team_crossings_;
 };
 
 } // namespace multicore
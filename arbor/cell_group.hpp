@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <arbor/common_types.hpp>
@@ -28,6 +29,14 @@ public:
     virtual void set_binning_policy(binning_kind policy, time_type bin_interval) = 0;
     virtual void advance(epoch epoch, time_type dt, const event_lane_subrange& events) = 0;
 
+    // Groups that keep their own time-ordered queue of pending events for
+    // each cell take the events of an epoch unsorted: the lane of a cell then
+    // holds only the events that arrived since the previous epoch, in any
+    // order and possibly due in later epochs, and the simulation skips the
+    // per-epoch sort and merge of the lanes. Such groups clear each lane
+    // once they have queued its events.
+    virtual bool queues_events() const { return false; }
+
     virtual const std::vector<spike>& spikes() const = 0;
     virtual void clear_spikes() = 0;
 
@@ -38,6 +47,10 @@ public:
     virtual void remove_sampler(sampler_association_handle) = 0;
     virtual void remove_all_samplers() = 0;
 
+    // Override a parameter or global of a mechanism on the cells of the
+    // group; ignored by groups of cells without mechanisms.
+    virtual void set_mechanism_parameter(const std::string& mechanism, const std::string& parameter, double value) {}
+
     // Probe metadata queries might also be called while a simulation is running, and so should
     // also be thread-safe.
 
@@ -20,14 +20,14 @@ cell_group_ptr make_cell_group(Args&&... args) {
 }
 
 cell_group_factory cell_kind_implementation(
-        cell_kind ck, backend_kind bk, const execution_context& ctx)
+        cell_kind ck, backend_kind bk, const execution_context& ctx, unsigned team_size)
 {
     using gid_vector = std::vector<cell_gid_type>;
 
     switch (ck) {
     case cell_kind::cable:
-        return [bk, ctx](const gid_vector& gids, const recipe& rec) {
-            return make_cell_group<mc_cell_group>(gids, rec, make_fvm_lowered_cell(bk, ctx));
+        return [bk, ctx, team_size](const gid_vector& gids, const recipe& rec) {
+            return make_cell_group<mc_cell_group>(gids, rec, make_fvm_lowered_cell(bk, ctx, team_size));
         };
 
     case cell_kind::spike_source:
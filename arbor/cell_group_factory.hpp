@@ -20,8 +20,10 @@ namespace arb {
 using cell_group_factory = std::function<
         cell_group_ptr(const std::vector<cell_gid_type>&, const recipe&)>;
 
+// Cable cell groups share their work over team_size threads, where supported
+// by the back-end.
 cell_group_factory cell_kind_implementation(
-        cell_kind, backend_kind, const execution_context&);
+        cell_kind, backend_kind, const execution_context&, unsigned team_size = 1);
 
 inline bool cell_kind_supported(
         cell_kind c, backend_kind b, const execution_context& ctx)
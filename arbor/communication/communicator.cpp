@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <atomic>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -23,6 +26,28 @@
 
 namespace arb {
 
+// Fold runs of connections with the same source, destination and delay in a
+// range sorted by these into the first connection of the run, with the sum of
+// their weights. Returns the number of connections that remain.
+template <typename Range>
+static std::size_t fold_connections(Range&& cons) {
+    auto key = [](const connection& c) {
+        return std::make_tuple(c.source(), c.destination(), c.delay());
+    };
+
+    auto out = cons.begin();
+    for (auto i = cons.begin(); i!=cons.end();) {
+        auto weight = i->weight();
+        auto j = std::next(i);
+        for (; j!=cons.end() && key(*j)==key(*i); ++j) {
+            weight += j->weight();
+        }
+        *out++ = connection(i->source(), i->destination(), weight, i->delay(), i->index_on_domain());
+        i = j;
+    }
+    return std::distance(cons.begin(), out);
+}
+
 communicator::communicator(const recipe& rec,
                           const domain_decomposition& dom_dec,
                           execution_context& ctx)
@@ -52,8 +77,9 @@ communicator::communicator(const recipe& rec,
     //   -> n_cons: scalar
     // Calculate and store domain id of the presynaptic cell on each local connection
     //   -> src_domains: array with one entry for every local connection
-    // Also the count of presynaptic sources from each domain
-    //   -> src_counts: array with one entry for each domain
+    // Also the count of presynaptic sources from each domain, for each block
+    // of consecutive local cells
+    //   -> block_counts: array with one entry for each block and domain
 
     // Record all the gid in a flat vector.
     // These are used to map from local index to gid in the parallel loop
@@ -72,49 +98,108 @@ communicator::communicator(const recipe& rec,
             gid_infos[i] = gid_info(gid, i, rec.connections_on(gid));
         });
 
-    cell_local_size_type n_cons =
-        util::sum_by(gid_infos, [](const gid_info& g){ return g.conns.size(); });
-    std::vector<unsigned> src_domains;
-    src_domains.reserve(n_cons);
-    std::vector<cell_size_type> src_counts(num_domains_);
+    // Index of the first connection of each local cell.
+    std::vector<cell_size_type> cell_cons_divs(gid_infos.size()+1, 0);
+    for (auto i: util::count_along(gid_infos)) {
+        cell_cons_divs[i+1] = cell_cons_divs[i] + gid_infos[i].conns.size();
+    }
+    cell_local_size_type n_cons = cell_cons_divs.back();
+
+    // The validation and placement of connections are performed in parallel
+    // over blocks of local cells, a few per thread for load balance.
+    const cell_size_type n_blocks =
+        std::min<cell_size_type>(gid_infos.size(), 4*thread_pool_->get_num_threads());
+    auto block_cells = [&](cell_size_type b) {
+        return util::make_span(b*gid_infos.size()/n_blocks, (b+1)*gid_infos.size()/n_blocks);
+    };
 
-    for (const auto& cell: gid_infos) {
-        auto num_targets = rec.num_targets(cell.gid);
-        for (auto c: cell.conns) {
-            auto num_sources = rec.num_sources(c.source.gid);
-            if (c.source.gid >= num_total_cells) {
-                throw arb::bad_connection_source_gid(cell.gid, c.source.gid, num_total_cells);
-            }
-            if (c.source.index >= num_sources) {
-                throw arb::bad_connection_source_lid(cell.gid, c.source.index, num_sources);
-            }
-            if (c.dest.gid != cell.gid) {
-                throw arb::bad_connection_target_gid(cell.gid, c.dest.gid);
-            }
-            if (c.dest.index >= num_targets) {
-                throw arb::bad_connection_target_lid(cell.gid, c.dest.index, num_targets);
-            }
-            const auto src = dom_dec.gid_domain(c.source.gid);
-            src_domains.push_back(src);
-            src_counts[src]++;
-        }
+    std::vector<unsigned> src_domains(n_cons);
+    std::vector<std::vector<cell_size_type>> block_counts(n_blocks, std::vector<cell_size_type>(num_domains_));
+
+    // Many connections can share a source, and querying the recipe can be
+    // expensive, so the number of sources of each cell is cached by gid.
+    // A cell is on average the source of less than one local connection if
+    // there are more cells than local connections, in which case there is
+    // no cache.
+    constexpr cell_size_type unknown = -1;
+    std::vector<std::atomic<cell_size_type>> num_sources_cache(num_total_cells<=n_cons? num_total_cells: 0);
+    for (auto& n: num_sources_cache) {
+        n.store(unknown, std::memory_order_relaxed);
     }
+    auto num_sources_of = [&](cell_gid_type gid) {
+        if (gid>=num_sources_cache.size()) return rec.num_sources(gid);
+
+        auto n = num_sources_cache[gid].load(std::memory_order_relaxed);
+        if (n==unknown) {
+            n = rec.num_sources(gid);
+            num_sources_cache[gid].store(n, std::memory_order_relaxed);
+        }
+        return n;
+    };
+
+    threading::parallel_for::apply(0, n_blocks, thread_pool_.get(),
+        [&](cell_size_type b) {
+            auto& counts = block_counts[b];
+            for (auto i: block_cells(b)) {
+                const auto& cell = gid_infos[i];
+                auto num_targets = rec.num_targets(cell.gid);
+                auto pos = cell_cons_divs[i];
+                for (const auto& c: cell.conns) {
+                    if (c.source.gid >= num_total_cells) {
+                        throw arb::bad_connection_source_gid(cell.gid, c.source.gid, num_total_cells);
+                    }
+                    auto num_sources = num_sources_of(c.source.gid);
+                    if (c.source.index >= num_sources) {
+                        throw arb::bad_connection_source_lid(cell.gid, c.source.index, num_sources);
+                    }
+                    if (c.dest.gid != cell.gid) {
+                        throw arb::bad_connection_target_gid(cell.gid, c.dest.gid);
+                    }
+                    if (c.dest.index >= num_targets) {
+                        throw arb::bad_connection_target_lid(cell.gid, c.dest.index, num_targets);
+                    }
+                    const auto src = dom_dec.gid_domain(c.source.gid);
+                    src_domains[pos++] = src;
+                    counts[src]++;
+                }
+            }
+        });
 
     // Construct the connections.
-    // The loop above gave the information required to construct in place
-    // the connections as partitioned by the domain of their source gid.
-    connections_.resize(n_cons);
+    // A prefix scan over the counts, by domain and then by block, gives
+    // the position at which each block places its connections from each
+    // domain, such that the connections are partitioned by the domain of
+    // their source gid, in the same order as a serial pass would give.
+    std::vector<cell_size_type> src_counts(num_domains_);
+    for (const auto& counts: block_counts) {
+        for (auto d: util::make_span(num_domains_)) {
+            src_counts[d] += counts[d];
+        }
+    }
     connection_part_ = algorithms::make_index(src_counts);
-    auto offsets = connection_part_;
-    std::size_t pos = 0;
-    for (const auto& cell: gid_infos) {
-        for (auto c: cell.conns) {
-            const auto i = offsets[src_domains[pos]]++;
-            connections_[i] = {c.source, c.dest, c.weight, c.delay, cell.index_on_domain};
-            ++pos;
+    for (auto d: util::make_span(num_domains_)) {
+        auto offset = connection_part_[d];
+        for (auto& counts: block_counts) {
+            auto n = counts[d];
+            counts[d] = offset;
+            offset += n;
         }
     }
 
+    connections_.resize(n_cons);
+    threading::parallel_for::apply(0, n_blocks, thread_pool_.get(),
+        [&](cell_size_type b) {
+            auto& offsets = block_counts[b];
+            for (auto i: block_cells(b)) {
+                const auto& cell = gid_infos[i];
+                auto pos = cell_cons_divs[i];
+                for (const auto& c: cell.conns) {
+                    const auto j = offsets[src_domains[pos++]]++;
+                    connections_[j] = {c.source, c.dest, c.weight, c.delay, cell.index_on_domain};
+                }
+            }
+        });
+
     // Build cell partition by group for passing events to cell groups
     index_part_ = util::make_partition(index_divisions_,
         util::transform_view(
@@ -124,10 +209,37 @@ communicator::communicator(const recipe& rec,
     // Sort the connections for each domain.
     // This is num_domains_ independent sorts, so it can be parallelized trivially.
     const auto& cp = connection_part_;
+    if (!rec.fold_connections()) {
+        threading::parallel_for::apply(0, num_domains_, thread_pool_.get(),
+            [&](cell_size_type i) {
+                util::sort(util::subrange_view(connections_, cp[i], cp[i+1]));
+            });
+        return;
+    }
+
+    // When folding, sort by source, destination, delay and weight, so that
+    // parallel connections are adjacent and are summed in the same order
+    // regardless of the order in which the recipe lists them, then fold each
+    // domain's connections and close the gaps left between domains.
+    std::vector<cell_size_type> folded_counts(num_domains_);
     threading::parallel_for::apply(0, num_domains_, thread_pool_.get(),
         [&](cell_size_type i) {
-            util::sort(util::subrange_view(connections_, cp[i], cp[i+1]));
+            auto cons = util::subrange_view(connections_, cp[i], cp[i+1]);
+            util::sort_by(cons, [](const connection& c) {
+                return std::make_tuple(c.source(), c.destination(), c.delay(), c.weight());
+            });
+            folded_counts[i] = fold_connections(cons);
         });
+
+    cell_size_type n_folded = 0;
+    for (auto d: util::make_span(num_domains_)) {
+        auto first = connections_.begin()+cp[d];
+        std::move(first, first+folded_counts[d], connections_.begin()+n_folded);
+        n_folded += folded_counts[d];
+    }
+    num_folded_connections_ = connections_.size()-n_folded;
+    connections_.resize(n_folded);
+    connection_part_ = algorithms::make_index(folded_counts);
 }
 
 std::pair<cell_size_type, cell_size_type> communicator::group_queue_range(cell_size_type i) {
@@ -146,19 +258,34 @@ time_type communicator::min_delay() {
 
 gathered_vector<spike> communicator::exchange(std::vector<spike> local_spikes) {
     PE(communication_exchange_sort);
-    // sort the spikes in ascending order of source gid
-    util::sort_by(local_spikes, [](spike s){return s.source;});
+    // sort the spikes in ascending order of source gid; the spikes collected
+    // by the simulation are already sorted, in which case this is a check only.
+    auto src = [](const spike& s) { return s.source; };
+    if (!util::is_sorted_by(local_spikes, src)) {
+        util::sort_by(local_spikes, src);
+    }
     PL();
 
     PE(communication_exchange_gather);
     // global all-to-all to gather a local copy of the global spike list on each node.
-    auto global_spikes = distributed_->gather_spikes(local_spikes);
+    auto global_spikes = compact_exchange_?
+        distributed_->gather_spikes_compact(local_spikes, spike_resolution_, node_exchange_):
+        distributed_->gather_spikes(local_spikes, node_exchange_);
     num_spikes_ += global_spikes.size();
     PL();
 
     return global_spikes;
 }
 
+void communicator::set_compact_exchange(bool enable, time_type resolution) {
+    compact_exchange_ = enable;
+    spike_resolution_ = resolution;
+}
+
+void communicator::set_node_exchange(bool enable) {
+    node_exchange_ = enable;
+}
+
 void communicator::make_event_queues(
         const gathered_vector<spike>& global_spikes,
         std::vector<pse_vector>& queues)
@@ -232,6 +359,10 @@ const std::vector<connection>& communicator::connections() const {
     return connections_;
 }
 
+std::size_t communicator::num_folded_connections() const {
+    return num_folded_connections_;
+}
+
 void communicator::reset() {
     num_spikes_ = 0;
 }
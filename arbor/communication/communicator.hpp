@@ -42,9 +42,18 @@ public:
     /// Perform exchange of spikes.
     ///
     /// Takes as input the list of local_spikes that were generated on the calling domain.
+    /// These are sorted by source if they are not sorted already.
     /// Returns the full global set of vectors, along with meta data about their partition
     gathered_vector<spike> exchange(std::vector<spike> local_spikes);
 
+    /// Use the compact wire format of spike_codec.hpp in exchange, with
+    /// spike times rounded to multiples of resolution.
+    void set_compact_exchange(bool enable, time_type resolution);
+
+    /// Pool the spikes of the domains on a node for the exchange between
+    /// nodes, where the distributed context supports it.
+    void set_node_exchange(bool enable);
+
     /// Check each global spike in turn to see it generates local events.
     /// If so, make the events and insert them into the appropriate event list.
     ///
@@ -64,6 +73,10 @@ public:
 
     const std::vector<connection>& connections() const;
 
+    /// The number of local connections removed by folding connections with
+    /// the same source, target and delay, if enabled by the recipe.
+    std::size_t num_folded_connections() const;
+
     void reset();
 
 private:
@@ -78,6 +91,10 @@ private:
     distributed_context_handle distributed_;
     task_system_handle thread_pool_;
     std::uint64_t num_spikes_ = 0u;
+    std::size_t num_folded_connections_ = 0u;
+    bool compact_exchange_ = false;
+    time_type spike_resolution_ = 0;
+    bool node_exchange_ = false;
 };
 
 } // namespace arb
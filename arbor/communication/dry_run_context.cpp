@@ -15,7 +15,7 @@ struct dry_run_context_impl {
         num_ranks_(num_ranks), num_cells_per_tile_(num_cells_per_tile) {};
 
     gathered_vector<arb::spike>
-    gather_spikes(const std::vector<arb::spike>& local_spikes) const {
+    gather_spikes(const std::vector<arb::spike>& local_spikes, bool = false) const {
         using count_type = typename gathered_vector<arb::spike>::count_type;
 
         count_type local_size = local_spikes.size();
@@ -41,6 +41,11 @@ struct dry_run_context_impl {
         return gathered_vector<arb::spike>(std::move(gathered_spikes), std::move(partition));
     }
 
+    gathered_vector<arb::spike>
+    gather_spikes_compact(const std::vector<arb::spike>& local_spikes, time_type resolution, bool = false) const {
+        return gather_spikes(round_spike_times(local_spikes, resolution));
+    }
+
     gathered_vector<cell_gid_type>
     gather_gids(const std::vector<cell_gid_type>& local_gids) const {
         using count_type = typename gathered_vector<cell_gid_type>::count_type;
@@ -81,6 +86,11 @@ struct dry_run_context_impl {
     template <typename T>
     T sum(T value) const { return value * num_ranks_; }
 
+    std::vector<double> sum(std::vector<double> values) const {
+        for (auto& v: values) v *= num_ranks_;
+        return values;
+    }
+
     template <typename T>
     std::vector<T> gather(T value, int) const {
         return std::vector<T>(num_ranks_, value);
@@ -178,6 +178,41 @@ gathered_vector<T> gather_all_with_partition(const std::vector<T>& values, MPI_C
     );
 }
 
+/// Gather a distributed vector on the root rank
+/// Retains the meta data (i.e. vector partition); the other ranks receive
+/// an empty vector.
+template <typename T>
+gathered_vector<T> gather_with_partition(const std::vector<T>& values, int root, MPI_Comm comm) {
+    using gathered_type = gathered_vector<T>;
+    using count_type = typename gathered_vector<T>::count_type;
+    using traits = mpi_traits<T>;
+
+    const bool is_root = rank(comm)==root;
+    auto counts = gather(int(values.size()*traits::count()), root, comm);
+    auto displs = algorithms::make_index(counts);
+
+    std::vector<T> buffer(is_root? displs.back()/traits::count(): 0);
+
+    MPI_OR_THROW(MPI_Gatherv,
+            // const_cast required for MPI implementations that don't use const* in their interfaces
+            const_cast<T*>(values.data()), int(values.size()*traits::count()), traits::mpi_type(), // send buffer
+            buffer.data(), counts.data(), displs.data(), traits::mpi_type(), // receive buffer
+            root, comm);
+
+    if (!is_root) {
+        return gathered_type(std::move(buffer), {0u});
+    }
+
+    for (auto& d : displs) {
+        d /= traits::count();
+    }
+
+    return gathered_type(
+        std::move(buffer),
+        std::vector<count_type>(displs.begin(), displs.end())
+    );
+}
+
 template <typename T>
 T reduce(T value, MPI_Op op, int root, MPI_Comm comm) {
     using traits = mpi_traits<T>;
@@ -205,6 +240,19 @@ T reduce(T value, MPI_Op op, MPI_Comm comm) {
     return result;
 }
 
+// Element-wise reduction of a vector with the same size on every rank.
+template <typename T>
+std::vector<T> reduce(std::vector<T> values, MPI_Op op, MPI_Comm comm) {
+    using traits = mpi_traits<T>;
+    static_assert(traits::is_mpi_native_type(),
+                  "can only perform reductions on MPI native types");
+
+    MPI_OR_THROW(MPI_Allreduce,
+        MPI_IN_PLACE, values.data(), values.size(), traits::mpi_type(), op, comm);
+
+    return values;
+}
+
 template <typename T>
 std::pair<T,T> minmax(T value) {
     return {reduce<T>(value, MPI_MIN), reduce<T>(value, MPI_MAX)};
@@ -242,5 +290,19 @@ T broadcast(int root, MPI_Comm comm) {
     return value;
 }
 
+// Broadcast a vector from the root rank, resizing it on the other ranks.
+template <typename T>
+void broadcast(std::vector<T>& values, int root, MPI_Comm comm) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "broadcast can only be performed on trivally copyable types");
+
+    using traits = mpi_traits<T>;
+
+    values.resize(broadcast(values.size(), root, comm));
+
+    MPI_OR_THROW(MPI_Bcast,
+        values.data(), int(values.size()*traits::count()), traits::mpi_type(), root, comm);
+}
+
 } // namespace mpi
 } // namespace arb
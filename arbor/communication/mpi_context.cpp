@@ -5,6 +5,9 @@
 #error "build only if MPI is enabled"
 #endif
 
+#include <algorithm>
+#include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -13,24 +16,142 @@
 #include <arbor/spike.hpp>
 
 #include "communication/mpi.hpp"
+#include "communication/spike_codec.hpp"
 #include "distributed_context.hpp"
 
 namespace arb {
 
+// Sub-communicators for the two-level exchange of spikes, used on request when
+// ranks share a node: the values of all ranks on a node are pooled on the
+// node's leader (the rank with the lowest id on the node), only the leaders
+// take part in the exchange between nodes, and the leaders then broadcast
+// the global result to the other ranks on their node. Within a node these
+// collectives go through shared memory.
+struct node_topology {
+    // Ranks on the same node.
+    MPI_Comm node = MPI_COMM_NULL;
+    // The node leaders; MPI_COMM_NULL on the other ranks.
+    MPI_Comm leaders = MPI_COMM_NULL;
+    // Ranks in the order in which their values arrive from the leaders,
+    // that is, by node and then by rank, and whether this is the identity.
+    std::vector<int> order;
+    bool in_rank_order;
+
+    explicit node_topology(MPI_Comm comm) {
+        int rank = mpi::rank(comm);
+        MPI_OR_THROW(MPI_Comm_split_type, comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node);
+
+        bool is_leader = mpi::rank(node)==0;
+        MPI_OR_THROW(MPI_Comm_split, comm, is_leader? 0: MPI_UNDEFINED, rank, &leaders);
+
+        // Leaders are ordered by rank in the leader communicator, as are the
+        // ranks in each node communicator.
+        auto leader_of = mpi::gather_all(mpi::broadcast(rank, 0, node), comm);
+        order.resize(leader_of.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+            [&](int a, int b) { return leader_of[a]<leader_of[b]; });
+        in_rank_order = std::is_sorted(order.begin(), order.end());
+    }
+
+    ~node_topology() {
+        // The context may outlive MPI.
+        int finalized;
+        MPI_Finalized(&finalized);
+        if (!finalized) {
+            if (leaders!=MPI_COMM_NULL) MPI_Comm_free(&leaders);
+            MPI_Comm_free(&node);
+        }
+    }
+
+    // Gather a distributed vector on every rank, retaining the partition by rank.
+    template <typename T>
+    gathered_vector<T> gather_all_with_partition(const std::vector<T>& values) const {
+        using count_type = typename gathered_vector<T>::count_type;
+
+        // Pool the values on the node leader.
+        auto pooled = mpi::gather_with_partition(values, 0, node);
+
+        // Exchange the pooled values and the number contributed by each
+        // rank between the leaders.
+        std::vector<T> buffer;
+        std::vector<count_type> counts;
+        if (leaders!=MPI_COMM_NULL) {
+            std::vector<count_type> node_counts;
+            for (std::size_t i = 0; i+1<pooled.partition().size(); ++i) {
+                node_counts.push_back(pooled.count(i));
+            }
+
+            counts = mpi::gather_all(node_counts, leaders);
+            buffer = mpi::gather_all(pooled.values(), leaders);
+        }
+
+        // Share the result with the other ranks on the node.
+        mpi::broadcast(counts, 0, node);
+        mpi::broadcast(buffer, 0, node);
+
+        if (in_rank_order) {
+            return gathered_vector<T>(std::move(buffer), algorithms::make_index(counts));
+        }
+
+        // Permute the blocks of values into rank order.
+        auto offsets = algorithms::make_index(counts);
+        std::vector<count_type> rank_counts(counts.size());
+        for (std::size_t i = 0; i<order.size(); ++i) {
+            rank_counts[order[i]] = counts[i];
+        }
+        auto partition = algorithms::make_index(rank_counts);
+
+        std::vector<T> values_by_rank(buffer.size());
+        for (std::size_t i = 0; i<order.size(); ++i) {
+            std::copy(buffer.begin()+offsets[i], buffer.begin()+offsets[i+1],
+                      values_by_rank.begin()+partition[order[i]]);
+        }
+        return gathered_vector<T>(std::move(values_by_rank), std::move(partition));
+    }
+};
+
 // Throws arb::mpi::mpi_error if MPI calls fail.
 struct mpi_context_impl {
     int size_;
     int rank_;
     MPI_Comm comm_;
+    // Set up by the first gather by node; null if every rank has a node to
+    // itself.
+    mutable std::shared_ptr<const node_topology> nodes_;
+    mutable bool nodes_known_ = false;
 
     explicit mpi_context_impl(MPI_Comm comm): comm_(comm) {
         size_ = mpi::size(comm_);
         rank_ = mpi::rank(comm_);
     }
 
+    // Gather over all ranks, in two levels if by_node is set and ranks share
+    // a node. Setting up the node topology is collective, and so by_node must
+    // be the same on every rank.
+    template <typename T>
+    gathered_vector<T> gather_all_with_partition(const std::vector<T>& values, bool by_node) const {
+        if (by_node && !nodes_known_) {
+            auto nodes = std::make_shared<node_topology>(comm_);
+            if (mpi::reduce(mpi::size(nodes->node), MPI_MAX, comm_)>1) {
+                nodes_ = std::move(nodes);
+            }
+            nodes_known_ = true;
+        }
+
+        return by_node && nodes_?
+            nodes_->gather_all_with_partition(values):
+            mpi::gather_all_with_partition(values, comm_);
+    }
+
+    gathered_vector<arb::spike>
+    gather_spikes(const std::vector<arb::spike>& local_spikes, bool by_node) const {
+        return gather_all_with_partition(local_spikes, by_node);
+    }
+
     gathered_vector<arb::spike>
-    gather_spikes(const std::vector<arb::spike>& local_spikes) const {
-        return mpi::gather_all_with_partition(local_spikes, comm_);
+    gather_spikes_compact(const std::vector<arb::spike>& local_spikes, time_type resolution, bool by_node) const {
+        return decode_spikes(gather_all_with_partition(encode_spikes(local_spikes, resolution), by_node));
     }
 
     gathered_vector<cell_gid_type>
@@ -57,6 +178,14 @@ struct mpi_context_impl {
         return mpi::reduce(value, MPI_SUM, comm_);
     }
 
+    std::vector<double> sum(std::vector<double> values) const {
+        return mpi::reduce(std::move(values), MPI_SUM, comm_);
+    }
+
+    std::vector<unsigned> max(std::vector<unsigned> values) const {
+        return mpi::reduce(std::move(values), MPI_MAX, comm_);
+    }
+
     template <typename T>
     std::vector<T> gather(T value, int root) const {
         return mpi::gather(value, root, comm_);
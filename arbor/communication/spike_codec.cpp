@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <arbor/arbexcept.hpp>
+#include <arbor/common_types.hpp>
+#include <arbor/spike.hpp>
+
+#include "communication/gathered_vector.hpp"
+#include "communication/spike_codec.hpp"
+
+namespace arb {
+
+namespace {
+
+// Flag bits in the block header.
+enum : std::uint8_t {
+    has_lids   = 1,
+    times_u16  = 2,
+    times_u32  = 4,
+};
+
+template <typename T>
+void put(std::vector<char>& buf, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    buf.insert(buf.end(), bytes, bytes+sizeof(T));
+}
+
+void put_varint(std::vector<char>& buf, std::uint64_t value) {
+    while (value>=0x80) {
+        buf.push_back(char(value|0x80));
+        value >>= 7;
+    }
+    buf.push_back(char(value));
+}
+
+struct reader {
+    const char* p;
+    const char* end;
+
+    void check(std::size_t n) const {
+        if (std::size_t(end-p)<n) {
+            throw arbor_internal_error("decode_spikes: truncated spike block");
+        }
+    }
+
+    template <typename T>
+    T get() {
+        check(sizeof(T));
+        T value;
+        std::memcpy(&value, p, sizeof(T));
+        p += sizeof(T);
+        return value;
+    }
+
+    std::uint64_t get_varint() {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0; ; shift += 7) {
+            check(1);
+            auto byte = std::uint8_t(*p++);
+            value |= std::uint64_t(byte&0x7f)<<shift;
+            if (!(byte&0x80)) return value;
+        }
+    }
+};
+
+// Zig-zag mapping of signed gid differences to unsigned values, so that
+// small negative differences in unsorted input also stay short.
+std::uint64_t zigzag(std::int64_t x) {
+    return (std::uint64_t(x)<<1) ^ std::uint64_t(x>>63);
+}
+
+std::int64_t unzigzag(std::uint64_t x) {
+    return std::int64_t(x>>1) ^ -std::int64_t(x&1);
+}
+
+void decode_block(reader& in, std::vector<spike>& out) {
+    auto n = in.get_varint();
+    auto flags = in.get<std::uint8_t>();
+    auto resolution = in.get<time_type>();
+    auto tick0 = flags&(times_u16|times_u32)? in.get<std::int64_t>(): 0;
+
+    auto first = out.size();
+    out.resize(first+n);
+    auto spikes = out.data()+first;
+
+    std::int64_t gid = 0;
+    for (std::size_t i = 0; i<n; ++i) {
+        gid += unzigzag(in.get_varint());
+        spikes[i].source = {cell_gid_type(gid), 0};
+    }
+    if (flags&has_lids) {
+        for (std::size_t i = 0; i<n; ++i) {
+            spikes[i].source.index = cell_lid_type(in.get_varint());
+        }
+    }
+    for (std::size_t i = 0; i<n; ++i) {
+        spikes[i].time =
+            flags&times_u16? (tick0 + in.get<std::uint16_t>())*resolution:
+            flags&times_u32? (tick0 + in.get<std::uint32_t>())*resolution:
+            in.get<time_type>();
+    }
+}
+
+} // anonymous namespace
+
+std::vector<char> encode_spikes(const std::vector<spike>& spikes, time_type resolution) {
+    const auto n = spikes.size();
+
+    std::uint8_t flags = 0;
+    std::int64_t tick0 = 0;
+    if (n) {
+        if (std::any_of(spikes.begin(), spikes.end(), [](auto& s) { return s.source.index; })) {
+            flags |= has_lids;
+        }
+
+        // Times are rounded to the nearest multiple of the resolution, the
+        // same grid on every domain, and sent as offsets from the tick of the
+        // earliest spike.
+        auto tminmax = std::minmax_element(spikes.begin(), spikes.end(),
+            [](auto& a, auto& b) { return a.time<b.time; });
+
+        const time_type max_ticks = std::ldexp(1., 62);
+        if (resolution>0 &&
+            std::abs(tminmax.first->time/resolution)<max_ticks &&
+            std::abs(tminmax.second->time/resolution)<max_ticks)
+        {
+            tick0 = std::llround(tminmax.first->time/resolution);
+            auto range = std::llround(tminmax.second->time/resolution)-tick0;
+            if (range<=std::numeric_limits<std::uint16_t>::max()) {
+                flags |= times_u16;
+            }
+            else if (range<=std::numeric_limits<std::uint32_t>::max()) {
+                flags |= times_u32;
+            }
+        }
+    }
+
+    std::vector<char> buf;
+    buf.reserve(32 + n*(flags&times_u16? 4: 8));
+
+    put_varint(buf, n);
+    put(buf, flags);
+    put(buf, resolution);
+    if (flags&(times_u16|times_u32)) {
+        put(buf, tick0);
+    }
+
+    std::int64_t gid = 0;
+    for (auto& s: spikes) {
+        put_varint(buf, zigzag(std::int64_t(s.source.gid)-gid));
+        gid = s.source.gid;
+    }
+    if (flags&has_lids) {
+        for (auto& s: spikes) {
+            put_varint(buf, s.source.index);
+        }
+    }
+    for (auto& s: spikes) {
+        if (flags&(times_u16|times_u32)) {
+            auto tick = std::llround(s.time/resolution)-tick0;
+            if (flags&times_u16) {
+                put(buf, std::uint16_t(tick));
+            }
+            else {
+                put(buf, std::uint32_t(tick));
+            }
+        }
+        else {
+            put(buf, s.time);
+        }
+    }
+
+    return buf;
+}
+
+gathered_vector<spike> decode_spikes(const gathered_vector<char>& blocks) {
+    using count_type = gathered_vector<spike>::count_type;
+
+    const auto& part = blocks.partition();
+    const char* data = blocks.values().data();
+
+    std::vector<spike> spikes;
+    std::vector<count_type> partition = {0};
+    for (std::size_t i = 0; i+1<part.size(); ++i) {
+        if (blocks.count(i)) {
+            reader in{data+part[i], data+part[i+1]};
+            decode_block(in, spikes);
+        }
+        partition.push_back(spikes.size());
+    }
+
+    return gathered_vector<spike>(std::move(spikes), std::move(partition));
+}
+
+std::vector<spike> round_spike_times(const std::vector<spike>& spikes, time_type resolution) {
+    std::vector<spike> out;
+    out.reserve(spikes.size());
+
+    auto buf = encode_spikes(spikes, resolution);
+    reader in{buf.data(), buf.data()+buf.size()};
+    decode_block(in, out);
+    return out;
+}
+
+} // namespace arb
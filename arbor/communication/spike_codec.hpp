@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+#include <arbor/common_types.hpp>
+#include <arbor/spike.hpp>
+
+#include "communication/gathered_vector.hpp"
+
+// Compact wire format for spikes exchanged between domains.
+//
+// The spikes of one domain are encoded as a single block of bytes:
+//   header:  number of spikes, flags, time resolution and, if times are
+//            rounded, the base tick k0;
+//   gids:    differences between successive source gids, zig-zag and
+//            LEB128 encoded, so that a list sorted by source needs one byte
+//            per spike when sources are dense;
+//   lids:    LEB128 encoded source lids, omitted if all lids are zero;
+//   times:   round(time/resolution)-k0 as a 16 or 32 bit unsigned integer,
+//            where k0 is the rounded tick of the earliest spike in the block,
+//            so that every domain rounds to the same grid of multiples of the
+//            resolution; the times are stored exactly if the resolution is
+//            zero or the rounded values do not fit in 32 bits.
+//
+// Blocks are not portable between hosts of different byte order.
+
+namespace arb {
+
+std::vector<char> encode_spikes(const std::vector<spike>& spikes, time_type resolution);
+
+// Decode the blocks of a gathered vector of encoded spikes, one block per
+// partition, into a gathered vector of spikes with the same partitioning.
+gathered_vector<spike> decode_spikes(const gathered_vector<char>& blocks);
+
+// The spikes as they are after encoding and decoding, that is with times
+// rounded to the given resolution.
+std::vector<spike> round_spike_times(const std::vector<spike>& spikes, time_type resolution);
+
+} // namespace arb
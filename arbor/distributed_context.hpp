@@ -7,6 +7,7 @@
 #include <arbor/util/pp_util.hpp>
 
 #include "communication/gathered_vector.hpp"
+#include "communication/spike_codec.hpp"
 
 namespace arb {
 
@@ -55,8 +56,17 @@ public:
     distributed_context(distributed_context&& other) = default;
     distributed_context& operator=(distributed_context&& other) = default;
 
-    gathered_vector<arb::spike> gather_spikes(const spike_vector& local_spikes) const {
-        return impl_->gather_spikes(local_spikes);
+    // If by_node is set, contexts in which several domains share a node may
+    // pool the spikes of a node on one domain for the exchange between nodes.
+    // The result is the same either way.
+    gathered_vector<arb::spike> gather_spikes(const spike_vector& local_spikes, bool by_node = false) const {
+        return impl_->gather_spikes(local_spikes, by_node);
+    }
+
+    // Gather spikes using the compact wire format of spike_codec.hpp, with
+    // spike times rounded to multiples of resolution.
+    gathered_vector<arb::spike> gather_spikes_compact(const spike_vector& local_spikes, time_type resolution, bool by_node = false) const {
+        return impl_->gather_spikes_compact(local_spikes, resolution, by_node);
     }
 
     gathered_vector<cell_gid_type> gather_gids(const gid_vector& local_gids) const {
@@ -85,10 +95,24 @@ public:
         return impl_->gather(value, root);
     }
 
+    // Element-wise sum over all domains; values must have the same size on
+    // every domain.
+    std::vector<double> sum(std::vector<double> values) const {
+        return impl_->sum(std::move(values));
+    }
+
+    // Element-wise maximum over all domains; values must have the same size
+    // on every domain.
+    std::vector<unsigned> max(std::vector<unsigned> values) const {
+        return impl_->max(std::move(values));
+    }
+
 private:
     struct interface {
         virtual gathered_vector<arb::spike>
-            gather_spikes(const spike_vector& local_spikes) const = 0;
+            gather_spikes(const spike_vector& local_spikes, bool by_node) const = 0;
+        virtual gathered_vector<arb::spike>
+            gather_spikes_compact(const spike_vector& local_spikes, time_type resolution, bool by_node) const = 0;
         virtual gathered_vector<cell_gid_type>
             gather_gids(const gid_vector& local_gids) const = 0;
         virtual int id() const = 0;
@@ -98,6 +122,8 @@ private:
 
         ARB_PP_FOREACH(ARB_INTERFACE_COLLECTIVES_, ARB_COLLECTIVE_TYPES_)
         virtual std::vector<std::string> gather(std::string value, int root) const = 0;
+        virtual std::vector<double> sum(std::vector<double> values) const = 0;
+        virtual std::vector<unsigned> max(std::vector<unsigned> values) const = 0;
 
         virtual ~interface() {}
     };
@@ -108,8 +134,12 @@ private:
         explicit wrap(Impl&& impl): wrapped(std::move(impl)) {}
 
         gathered_vector<arb::spike>
-        gather_spikes(const spike_vector& local_spikes) const override {
-            return wrapped.gather_spikes(local_spikes);
+        gather_spikes(const spike_vector& local_spikes, bool by_node) const override {
+            return wrapped.gather_spikes(local_spikes, by_node);
+        }
+        gathered_vector<arb::spike>
+        gather_spikes_compact(const spike_vector& local_spikes, time_type resolution, bool by_node) const override {
+            return wrapped.gather_spikes_compact(local_spikes, resolution, by_node);
         }
         virtual gathered_vector<cell_gid_type>
         gather_gids(const gid_vector& local_gids) const override {
@@ -133,6 +163,12 @@ private:
         std::vector<std::string> gather(std::string value, int root) const override {
             return wrapped.gather(value, root);
         }
+        std::vector<double> sum(std::vector<double> values) const override {
+            return wrapped.sum(std::move(values));
+        }
+        std::vector<unsigned> max(std::vector<unsigned> values) const override {
+            return wrapped.max(std::move(values));
+        }
 
         Impl wrapped;
     };
@@ -142,13 +178,17 @@ private:
 
 struct local_context {
     gathered_vector<arb::spike>
-    gather_spikes(const std::vector<arb::spike>& local_spikes) const {
+    gather_spikes(const std::vector<arb::spike>& local_spikes, bool = false) const {
         using count_type = typename gathered_vector<arb::spike>::count_type;
         return gathered_vector<arb::spike>(
             std::vector<arb::spike>(local_spikes),
             {0u, static_cast<count_type>(local_spikes.size())}
         );
     }
+    gathered_vector<arb::spike>
+    gather_spikes_compact(const std::vector<arb::spike>& local_spikes, time_type resolution, bool = false) const {
+        return gather_spikes(round_spike_times(local_spikes, resolution));
+    }
     gathered_vector<cell_gid_type>
     gather_gids(const std::vector<cell_gid_type>& local_gids) const {
         using count_type = typename gathered_vector<cell_gid_type>::count_type;
@@ -18,7 +18,8 @@ namespace arb {
  * and either have a public field `time` that returns the time value, or provide an
  * overload of `event_time(const Event&)` which returns this value (see generic_event.hpp).
  *
- * Time values must be well ordered with respect to `operator>`.
+ * Time values must be well ordered with respect to `operator>`. Events that
+ * also provide `operator<` must be ordered by time first, as spike_event is.
  */
 
 template <typename Event>
@@ -93,8 +94,21 @@ public:
     }
 
 private:
+    // Events that define operator< are ordered by it, which must order
+    // first by time: events with equal times are then popped in the same
+    // order however they were pushed. Other events are ordered by time only.
     struct event_greater {
         bool operator()(const Event& a, const Event& b) {
+            return greater(a, b, 0);
+        }
+
+        template <typename E>
+        static auto greater(const E& a, const E& b, int) -> decltype(b<a) {
+            return b<a;
+        }
+
+        template <typename E>
+        static bool greater(const E& a, const E& b, long) {
             using ::arb::event_time;
             return event_time(a) > event_time(b);
         }
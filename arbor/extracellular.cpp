@@ -0,0 +1,40 @@
+#include <algorithm>
+#include <cmath>
+
+#include <arbor/math.hpp>
+#include <arbor/morph/primitives.hpp>
+
+#include "extracellular.hpp"
+
+namespace arb {
+
+double line_source_potential(const msegment& seg, const mpoint& electrode, double sigma) {
+    // Electrode position relative to the proximal end of the segment,
+    // decomposed into components along (h) and orthogonal to (r) the axis.
+    double dx = seg.dist.x-seg.prox.x, dy = seg.dist.y-seg.prox.y, dz = seg.dist.z-seg.prox.z;
+    double ex = electrode.x-seg.prox.x, ey = electrode.y-seg.prox.y, ez = electrode.z-seg.prox.z;
+
+    double length = std::sqrt(dx*dx+dy*dy+dz*dz);         // [µm]
+    double radius = 0.5*(seg.prox.radius+seg.dist.radius); // [µm]
+    double coef = 1/(4*math::pi<double>*sigma);            // [Ω·m]
+
+    double e2 = ex*ex+ey*ey+ez*ez;
+    if (length==0) {
+        // Point source; Ω·m/µm = MΩ, and nA·MΩ = mV.
+        return coef/std::max(std::sqrt(e2), radius);
+    }
+
+    double h = (ex*dx+ey*dy+ez*dz)/length;
+    double r = std::max(std::sqrt(std::max(0., e2-h*h)), radius);
+
+    // Potential is coef/length · [asinh(h/r) - asinh((h-length)/r)], written
+    // as the log of a ratio of terms x + √(x²+r²), evaluated without
+    // cancellation for negative x.
+    auto term = [r](double x) {
+        double s = std::sqrt(x*x+r*r);
+        return x>=0? x+s: r*r/(s-x);
+    };
+    return coef/length*std::log(term(h)/term(h-length));
+}
+
+} // namespace arb
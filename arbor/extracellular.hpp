@@ -0,0 +1,17 @@
+#pragma once
+
+// Extracellular potentials from membrane currents, for the line source
+// approximation in an infinite homogeneous and isotropic medium.
+
+#include <arbor/morph/primitives.hpp>
+
+namespace arb {
+
+// Extracellular potential [mV] at `electrode` due to a current of 1 nA leaving
+// the membrane uniformly along the segment `seg`, in a medium of conductivity
+// `sigma` [S/m]. Distances from the segment axis are bounded below by the
+// segment radius, so that the potential is finite at electrodes inside the
+// cable.
+double line_source_potential(const msegment& seg, const mpoint& electrode, double sigma);
+
+} // namespace arb
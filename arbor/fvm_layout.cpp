@@ -757,9 +757,6 @@ fvm_mechanism_data& append(fvm_mechanism_data& left, const fvm_mechanism_data& r
     return left;
 }
 
-fvm_mechanism_data fvm_build_mechanism_data(const cable_cell_global_properties& gprop,
-    const cable_cell& cell, const fvm_cv_discretization& D, fvm_size_type cell_idx);
-
 fvm_mechanism_data fvm_build_mechanism_data(const cable_cell_global_properties& gprop,
     const std::vector<cable_cell>& cells, const fvm_cv_discretization& D, const execution_context& ctx)
 {
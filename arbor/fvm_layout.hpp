@@ -282,6 +282,12 @@ struct fvm_mechanism_data {
     std::vector<std::size_t> target_divs;
 };
 
+// Combine two fvm_mechanism_data groups in-place. CV indices are not shifted.
+// (Returns reference to first argument.)
+fvm_mechanism_data& append(fvm_mechanism_data&, const fvm_mechanism_data&);
+
+// Construct mechanism data for one cell, or for cells that have been discretized together in D.
+fvm_mechanism_data fvm_build_mechanism_data(const cable_cell_global_properties& gprop, const cable_cell& cell, const fvm_cv_discretization& D, fvm_size_type cell_idx);
 fvm_mechanism_data fvm_build_mechanism_data(const cable_cell_global_properties& gprop, const std::vector<cable_cell>& cells, const fvm_cv_discretization& D, const arb::execution_context& ctx={});
 
 } // namespace arb
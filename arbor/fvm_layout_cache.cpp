@@ -0,0 +1,564 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <arbor/cable_cell.hpp>
+#include <arbor/mechcat.hpp>
+#include <arbor/mechinfo.hpp>
+#include <arbor/morph/locset.hpp>
+#include <arbor/morph/morphology.hpp>
+#include <arbor/morph/primitives.hpp>
+#include <arbor/version.hpp>
+
+#include "execution_context.hpp"
+#include "fvm_layout.hpp"
+#include "fvm_layout_cache.hpp"
+#include "threading/threading.hpp"
+#include "util/piecewise.hpp"
+#include "util/rangeutil.hpp"
+#include "util/strprintf.hpp"
+
+namespace arb {
+
+// Bump on any change to the key contents or the entry layout.
+static constexpr std::uint32_t cache_format_version = 2;
+static const char cache_magic[] = "arbor-fvm-layout";
+
+namespace {
+
+// Bytes are written in native byte order: the magic and format version at the
+// head of each entry will not match on a host of different endianness.
+
+struct cache_format_error {};
+
+std::uint64_t fnv1a(const char* p, std::size_t n) {
+    std::uint64_t h = 0xcbf29ce484222325ull;
+    for (std::size_t i = 0; i<n; ++i) {
+        h ^= (unsigned char)p[i];
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+template <typename Map>
+std::vector<typename Map::key_type> sorted_keys(const Map& map) {
+    std::vector<typename Map::key_type> keys;
+    keys.reserve(map.size());
+    for (auto& kv: map) keys.push_back(kv.first);
+    util::sort(keys);
+    return keys;
+}
+
+struct byte_writer {
+    std::string buf;
+
+    template <typename T>
+    std::enable_if_t<std::is_arithmetic<T>::value> put(T x) {
+        buf.append(reinterpret_cast<const char*>(&x), sizeof(T));
+    }
+
+    void put(const std::string& s) {
+        put<std::uint64_t>(s.size());
+        buf.append(s);
+    }
+
+    template <typename T>
+    void put(const std::vector<T>& v) {
+        put<std::uint64_t>(v.size());
+        if constexpr (std::is_arithmetic<T>::value) {
+            buf.append(reinterpret_cast<const char*>(v.data()), v.size()*sizeof(T));
+        }
+        else {
+            for (const auto& x: v) put(x);
+        }
+    }
+
+    template <typename T>
+    void put(const std::optional<T>& x) {
+        put<std::uint8_t>(!!x);
+        if (x) put(*x);
+    }
+
+    template <typename X>
+    void put(const std::unordered_map<std::string, X>& map) {
+        put<std::uint64_t>(map.size());
+        for (auto& k: sorted_keys(map)) {
+            put(k);
+            put(map.at(k));
+        }
+    }
+
+    template <typename X>
+    void put(const std::pair<std::string, X>& p) {
+        put(p.first);
+        put(p.second);
+    }
+
+    template <typename X>
+    void put(const util::pw_elements<X>& pw) {
+        put(pw.vertices());
+        put(pw.elements());
+    }
+
+    // Morphological primitives and cell descriptions (key only).
+    // Fields are written individually so that padding never reaches the key.
+
+    void put(const mpoint& p) {
+        put(p.x); put(p.y); put(p.z); put(p.radius);
+    }
+
+    void put(const mlocation& loc) {
+        put(loc.branch); put(loc.pos);
+    }
+
+    void put(const mcable& c) {
+        put(c.branch); put(c.prox_pos); put(c.dist_pos);
+    }
+
+    void put(const mechanism_desc& desc) {
+        put(desc.name());
+        put(desc.values());
+    }
+
+    void put(const init_membrane_potential& x) { put(x.value); }
+    void put(const axial_resistivity& x) { put(x.value); }
+    void put(const temperature_K& x) { put(x.value); }
+    void put(const membrane_capacitance& x) { put(x.value); }
+    void put(const init_int_concentration& x) { put(x.ion); put(x.value); }
+    void put(const init_ext_concentration& x) { put(x.ion); put(x.value); }
+    void put(const init_reversal_potential& x) { put(x.ion); put(x.value); }
+
+    void put(const i_clamp& x) {
+        put(x.delay); put(x.duration); put(x.amplitude);
+    }
+
+    template <typename T>
+    void put(const mcable_map<T>& map) {
+        put<std::uint64_t>(map.size());
+        for (const auto& el: map) {
+            put(el.first);
+            put(el.second);
+        }
+    }
+
+    template <typename T>
+    void put(const placed<T>& p) {
+        put(p.loc);
+        put(p.lid);
+        put(p.item);
+    }
+
+    void put(const cable_cell_ion_data& d) {
+        put(d.init_int_concentration);
+        put(d.init_ext_concentration);
+        put(d.init_reversal_potential);
+    }
+
+    // The discretization policy is accounted for by the CV boundary points.
+    void put(const cable_cell_parameter_set& p) {
+        put(p.init_membrane_potential);
+        put(p.temperature_K);
+        put(p.axial_resistivity);
+        put(p.membrane_capacitance);
+        put(p.ion_data);
+        put(p.reversal_potential_method);
+    }
+
+    void put(const mechanism_field_spec& f) {
+        put<int>(f.kind);
+        put(f.default_value);
+        put(f.lower_bound);
+        put(f.upper_bound);
+    }
+
+    void put(const ion_dependency& d) {
+        put(d.write_concentration_int);
+        put(d.write_concentration_ext);
+        put(d.read_reversal_potential);
+        put(d.write_reversal_potential);
+        put(d.read_ion_charge);
+        put(d.verify_ion_charge);
+        put(d.expected_ion_charge);
+    }
+
+    void put(const mechanism_info& info) {
+        put(info.parameters);
+        put(info.ions);
+        put(info.linear);
+        put(info.fingerprint);
+    }
+
+    // Entry payload.
+
+    void put(const cv_geometry& g) {
+        put(g.cv_cables);
+        put(g.cv_cables_divs);
+        put(g.cv_parent);
+        put(g.cv_children);
+        put(g.cv_children_divs);
+        put(g.cv_to_cell);
+        put(g.cell_cv_divs);
+        put(g.branch_cv_map);
+    }
+
+    void put(const fvm_cv_discretization& D) {
+        put(D.geometry);
+        put(D.face_conductance);
+        put(D.cv_area);
+        put(D.cv_capacitance);
+        put(D.init_membrane_potential);
+        put(D.temperature_K);
+        put(D.diam_um);
+        put(D.axial_resistivity);
+    }
+
+    void put(const fvm_mechanism_config& c) {
+        put<int>((int)c.kind);
+        put(c.cv);
+        put(c.multiplicity);
+        put(c.norm_area);
+        put(c.target);
+        put(c.param_values);
+    }
+
+    void put(const fvm_ion_config& c) {
+        put(c.cv);
+        put(c.init_iconc);
+        put(c.init_econc);
+        put(c.reset_iconc);
+        put(c.reset_econc);
+        put(c.init_revpot);
+    }
+
+    void put(const fvm_mechanism_data& M) {
+        put(M.mechanisms);
+        put(M.ions);
+        put<std::uint64_t>(M.n_target);
+        put(M.target_divs);
+    }
+};
+
+struct byte_reader {
+    const char* p;
+    const char* end;
+
+    void take(void* out, std::size_t n) {
+        if ((std::size_t)(end-p)<n) throw cache_format_error{};
+        std::copy(p, p+n, reinterpret_cast<char*>(out));
+        p += n;
+    }
+
+    std::size_t get_size() {
+        std::uint64_t n;
+        take(&n, sizeof(n));
+        if (n>(std::uint64_t)(end-p)) throw cache_format_error{};
+        return n;
+    }
+
+    template <typename T>
+    std::enable_if_t<std::is_arithmetic<T>::value> get(T& x) {
+        take(&x, sizeof(T));
+    }
+
+    void get(std::string& s) {
+        s.resize(get_size());
+        take(&s[0], s.size());
+    }
+
+    template <typename T>
+    void get(std::vector<T>& v) {
+        std::size_t n = get_size();
+        if constexpr (std::is_arithmetic<T>::value) {
+            if (n*sizeof(T)>(std::size_t)(end-p)) throw cache_format_error{};
+            v.resize(n);
+            take(v.data(), n*sizeof(T));
+        }
+        else {
+            v.clear();
+            v.reserve(n);
+            for (std::size_t i = 0; i<n; ++i) {
+                v.emplace_back();
+                get(v.back());
+            }
+        }
+    }
+
+    template <typename X>
+    void get(std::unordered_map<std::string, X>& map) {
+        map.clear();
+        std::size_t n = get_size();
+        for (std::size_t i = 0; i<n; ++i) {
+            std::string k;
+            get(k);
+            get(map[k]);
+        }
+    }
+
+    template <typename X>
+    void get(std::pair<std::string, X>& p) {
+        get(p.first);
+        get(p.second);
+    }
+
+    template <typename X>
+    void get(util::pw_elements<X>& pw) {
+        std::vector<double> vertices;
+        std::vector<X> elements;
+        get(vertices);
+        get(elements);
+        if (elements.empty()? !vertices.empty(): vertices.size()!=elements.size()+1) {
+            throw cache_format_error{};
+        }
+        pw.assign(vertices, elements);
+    }
+
+    void get(mcable& c) {
+        get(c.branch); get(c.prox_pos); get(c.dist_pos);
+    }
+
+    void get(cv_geometry& g) {
+        get(g.cv_cables);
+        get(g.cv_cables_divs);
+        get(g.cv_parent);
+        get(g.cv_children);
+        get(g.cv_children_divs);
+        get(g.cv_to_cell);
+        get(g.cell_cv_divs);
+        get(g.branch_cv_map);
+    }
+
+    void get(fvm_cv_discretization& D) {
+        get(D.geometry);
+        get(D.face_conductance);
+        get(D.cv_area);
+        get(D.cv_capacitance);
+        get(D.init_membrane_potential);
+        get(D.temperature_K);
+        get(D.diam_um);
+        get(D.axial_resistivity);
+    }
+
+    void get(fvm_mechanism_config& c) {
+        int kind;
+        get(kind);
+        c.kind = (mechanismKind)kind;
+        get(c.cv);
+        get(c.multiplicity);
+        get(c.norm_area);
+        get(c.target);
+        get(c.param_values);
+    }
+
+    void get(fvm_ion_config& c) {
+        get(c.cv);
+        get(c.init_iconc);
+        get(c.init_econc);
+        get(c.reset_iconc);
+        get(c.reset_econc);
+        get(c.init_revpot);
+    }
+
+    void get(fvm_mechanism_data& M) {
+        get(M.mechanisms);
+        get(M.ions);
+        std::uint64_t n_target;
+        get(n_target);
+        M.n_target = n_target;
+        get(M.target_divs);
+    }
+};
+
+// Header common to every entry. The header holds the full key, so that an
+// entry for a different key with the same file name is a miss.
+void put_header(byte_writer& w, const std::string& key) {
+    w.buf.append(cache_magic, sizeof(cache_magic));
+    w.put(cache_format_version);
+    w.put(std::string(arb::source_id));
+    w.put(key);
+}
+
+} // anonymous namespace
+
+std::string fvm_layout_cache_key(const cable_cell& cell, const cable_cell_global_properties& gprop) {
+    byte_writer w;
+    w.put(cache_format_version);
+    w.put(std::string(arb::source_id));
+
+    const auto& m = cell.morphology();
+    w.put(m.num_branches());
+    for (msize_t i = 0; i<m.num_branches(); ++i) {
+        w.put(m.branch_parent(i));
+
+        const auto& segs = m.branch_segments(i);
+        w.put<std::uint64_t>(segs.size());
+        for (const auto& s: segs) {
+            w.put(s.prox);
+            w.put(s.dist);
+        }
+    }
+
+    const auto& regions = cell.region_assignments();
+    w.put(regions.get<mechanism_desc>());
+    w.put(regions.get<init_membrane_potential>());
+    w.put(regions.get<axial_resistivity>());
+    w.put(regions.get<temperature_K>());
+    w.put(regions.get<membrane_capacitance>());
+    w.put(regions.get<init_int_concentration>());
+    w.put(regions.get<init_ext_concentration>());
+    w.put(regions.get<init_reversal_potential>());
+
+    w.put(cell.synapses());
+    w.put(cell.stimuli());
+
+    const auto& dflt = cell.default_parameters();
+    const auto& global_dflt = gprop.default_parameters;
+
+    w.put(thingify(
+        dflt.discretization? dflt.discretization->cv_boundary_points(cell):
+        global_dflt.discretization? global_dflt.discretization->cv_boundary_points(cell):
+        default_cv_policy().cv_boundary_points(cell),
+        cell.provider()));
+
+    w.put(dflt);
+    w.put(global_dflt);
+    w.put(gprop.coalesce_synapses);
+    w.put(gprop.ion_species);
+
+    std::set<std::string> mechanisms;
+    for (auto& kv: regions.get<mechanism_desc>()) mechanisms.insert(kv.first);
+    for (auto& kv: cell.synapses()) mechanisms.insert(kv.first);
+    for (auto& kv: dflt.reversal_potential_method) mechanisms.insert(kv.second.name());
+    for (auto& kv: global_dflt.reversal_potential_method) mechanisms.insert(kv.second.name());
+
+    for (auto& name: mechanisms) {
+        w.put(name);
+        w.put((*gprop.catalogue)[name]);
+    }
+
+    return std::move(w.buf);
+}
+
+std::string fvm_layout_cache_path(const std::string& dir, const std::string& key) {
+    auto h = fnv1a(key.data(), key.size());
+    return util::pprintf("{}/{}.fvm", dir, util::strprintf("%016llx", (unsigned long long)h));
+}
+
+std::optional<fvm_layout_cache_entry> fvm_layout_cache_load(const std::string& dir, const std::string& key) {
+    std::ifstream in(fvm_layout_cache_path(dir, key), std::ios::binary);
+    if (!in) return std::nullopt;
+
+    std::string buf{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    if (in.bad()) return std::nullopt;
+
+    byte_writer header;
+    put_header(header, key);
+
+    // Entry is header, payload, and checksum of payload.
+    const std::size_t n_header = header.buf.size();
+    const std::size_t n_check = sizeof(std::uint64_t);
+    if (buf.size()<n_header+n_check || buf.compare(0, n_header, header.buf)) {
+        return std::nullopt;
+    }
+
+    std::uint64_t check;
+    std::copy(buf.end()-n_check, buf.end(), reinterpret_cast<char*>(&check));
+    if (check!=fnv1a(buf.data()+n_header, buf.size()-n_header-n_check)) {
+        return std::nullopt;
+    }
+
+    try {
+        fvm_layout_cache_entry entry;
+        byte_reader r{buf.data()+n_header, buf.data()+buf.size()-n_check};
+        r.get(entry.D);
+        r.get(entry.M);
+        if (r.p!=r.end) return std::nullopt;
+        return entry;
+    }
+    catch (cache_format_error&) {
+        return std::nullopt;
+    }
+}
+
+bool fvm_layout_cache_store(const std::string& dir, const std::string& key, const fvm_layout_cache_entry& entry) {
+    static std::atomic<unsigned> serial{0};
+
+    byte_writer w;
+    put_header(w, key);
+    auto n_header = w.buf.size();
+    w.put(entry.D);
+    w.put(entry.M);
+    w.put(fnv1a(w.buf.data()+n_header, w.buf.size()-n_header));
+
+    // Write to a temporary file unique to this process and thread, then rename
+    // into place: rename is atomic with respect to readers of the entry.
+    std::string path = fvm_layout_cache_path(dir, key);
+    std::string tmp = util::pprintf("{}.{}-{}.tmp",
+        path, util::strprintf("%08x", (unsigned)std::random_device{}()), serial++);
+
+    {
+        std::ofstream out(tmp, std::ios::binary|std::ios::trunc);
+        if (!out.write(w.buf.data(), w.buf.size()).flush()) {
+            out.close();
+            std::remove(tmp.c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(tmp.c_str(), path.c_str())) {
+        std::remove(tmp.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::pair<fvm_cv_discretization, fvm_mechanism_data> fvm_build_layout_cached(
+    const std::string& dir,
+    const cable_cell_global_properties& gprop,
+    const std::vector<cable_cell>& cells,
+    const execution_context& ctx)
+{
+    std::vector<fvm_layout_cache_entry> cell_layout(cells.size());
+    threading::parallel_for::apply(0, cells.size(), ctx.thread_pool.get(),
+        [&](int i) {
+            auto key = fvm_layout_cache_key(cells[i], gprop);
+            if (auto entry = fvm_layout_cache_load(dir, key)) {
+                cell_layout[i] = std::move(*entry);
+            }
+            else {
+                auto& L = cell_layout[i];
+                L.D = fvm_cv_discretize(cells[i], gprop.default_parameters);
+                L.M = fvm_build_mechanism_data(gprop, cells[i], L.D, 0);
+                fvm_layout_cache_store(dir, key, L);
+            }
+        });
+
+    fvm_cv_discretization D;
+    fvm_mechanism_data M;
+    for (auto& L: cell_layout) {
+        // Mechanism data CVs are relative to the cell; shift to the CVs of the
+        // combined discretization.
+        fvm_index_type cv_base = D.size();
+        for (auto& kv: L.M.mechanisms) {
+            for (auto& cv: kv.second.cv) cv += cv_base;
+        }
+        for (auto& kv: L.M.ions) {
+            for (auto& cv: kv.second.cv) cv += cv_base;
+        }
+
+        append(D, L.D);
+        append(M, L.M);
+    }
+    return {std::move(D), std::move(M)};
+}
+
+} // namespace arb
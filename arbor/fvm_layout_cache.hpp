@@ -0,0 +1,64 @@
+#pragma once
+
+// On-disk cache of per-cell discretizations and mechanism data.
+//
+// Each cell is keyed by a serialization of everything that determines its
+// discretization and mechanism data: the morphology, the painted and placed
+// assignments of the cell, the CV boundary points given by its discretization
+// policy, the cell and global default parameters, the ion species, and the
+// descriptions of the mechanisms it uses. The key also covers the cache format
+// version and the arbor source id, so that entries written by a different
+// build are never used.
+//
+// Entries are files in the cache directory named by a hash of the key. Each
+// holds a header with the format version, arbor source id and the full key,
+// and a checksum of the payload; an entry that fails any check, including an
+// entry for a different key with the same hash, is treated as a miss and
+// rewritten.
+// Entries are written to a uniquely named temporary file in the same directory
+// and then renamed, so that concurrent readers and writers (for example,
+// several MPI ranks sharing the one directory) only ever see complete entries.
+// Failure to write an entry is not an error.
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <arbor/cable_cell.hpp>
+
+#include "execution_context.hpp"
+#include "fvm_layout.hpp"
+
+namespace arb {
+
+struct fvm_layout_cache_entry {
+    // Discretization of the one cell.
+    fvm_cv_discretization D;
+
+    // Mechanism data, with CV indices relative to the cell.
+    fvm_mechanism_data M;
+};
+
+// Cache key for a cell: the serialized bytes.
+std::string fvm_layout_cache_key(const cable_cell& cell, const cable_cell_global_properties& gprop);
+
+// Path of the entry for a key in the cache directory dir.
+std::string fvm_layout_cache_path(const std::string& dir, const std::string& key);
+
+// Read and write individual entries; load() returns an empty optional if there
+// is no valid entry for the key.
+std::optional<fvm_layout_cache_entry> fvm_layout_cache_load(const std::string& dir, const std::string& key);
+bool fvm_layout_cache_store(const std::string& dir, const std::string& key, const fvm_layout_cache_entry&);
+
+// Discretize cells and build their mechanism data as fvm_cv_discretize() and
+// fvm_build_mechanism_data() do, using the entries in the cache directory dir
+// where present and adding entries for the remaining cells.
+std::pair<fvm_cv_discretization, fvm_mechanism_data> fvm_build_layout_cached(
+    const std::string& dir,
+    const cable_cell_global_properties& gprop,
+    const std::vector<cable_cell>& cells,
+    const execution_context& ctx={});
+
+} // namespace arb
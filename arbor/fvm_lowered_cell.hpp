@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <variant>
@@ -106,6 +107,31 @@ struct fvm_probe_membrane_currents {
     util::any_ptr get_metadata_ptr() const { return &metadata; }
 };
 
+// Values that are linear in the CV voltages, such as extracellular potentials.
+// Each value is a row of a sparse map from CV voltages to values held by the
+// back-end, which evaluates the row when the value is sampled: there is one
+// raw handle per value.
+struct fvm_probe_transfer {
+    std::vector<probe_handle> raw_handles; // Back-end row of each value.
+    std::vector<mpoint> metadata;          // Electrode positions, one per value.
+
+    // Rows of the map in compressed row form, until they are handed to the
+    // back-end when the cell group is initialized.
+    std::vector<fvm_index_type> row_divs;  // Partitions cv and coef by row.
+    std::vector<fvm_index_type> cv;        // CV index of each coefficient.
+    std::vector<fvm_value_type> coef;      // Coefficients [mV/mV].
+
+    void shrink_to_fit() {
+        raw_handles.shrink_to_fit();
+        metadata.shrink_to_fit();
+        row_divs.shrink_to_fit();
+        cv.shrink_to_fit();
+        coef.shrink_to_fit();
+    }
+
+    util::any_ptr get_metadata_ptr() const { return &metadata; }
+};
+
 struct missing_probe_info {
     // dummy data...
     std::array<probe_handle, 0> raw_handles;
@@ -121,6 +147,7 @@ struct fvm_probe_data {
     fvm_probe_data(fvm_probe_multi p): info(std::move(p)) {}
     fvm_probe_data(fvm_probe_weighted_multi p): info(std::move(p)) {}
     fvm_probe_data(fvm_probe_membrane_currents p): info(std::move(p)) {}
+    fvm_probe_data(fvm_probe_transfer p): info(std::move(p)) {}
 
     std::variant<
         missing_probe_info,
@@ -128,7 +155,8 @@ struct fvm_probe_data {
         fvm_probe_interpolated,
         fvm_probe_multi,
         fvm_probe_weighted_multi,
-        fvm_probe_membrane_currents
+        fvm_probe_membrane_currents,
+        fvm_probe_transfer
     > info = missing_probe_info{};
 
     auto raw_handle_range() const {
@@ -191,11 +219,16 @@ struct fvm_lowered_cell {
 
     virtual fvm_value_type time() const = 0;
 
+    // Set a range parameter of a mechanism to value at every instance, or
+    // set a global of the mechanism. Ignored if the mechanism is not present.
+    virtual void set_mechanism_parameter(const std::string& mechanism, const std::string& parameter, fvm_value_type value) = 0;
+
     virtual ~fvm_lowered_cell() {}
 };
 
 using fvm_lowered_cell_ptr = std::unique_ptr<fvm_lowered_cell>;
 
-fvm_lowered_cell_ptr make_fvm_lowered_cell(backend_kind p, const execution_context& ctx);
+// Work on a multicore back-end cell group is shared over team_size threads.
+fvm_lowered_cell_ptr make_fvm_lowered_cell(backend_kind p, const execution_context& ctx, unsigned team_size = 1);
 
 } // namespace arb
@@ -12,10 +12,10 @@
 
 namespace arb {
 
-fvm_lowered_cell_ptr make_fvm_lowered_cell(backend_kind p, const execution_context& ctx) {
+fvm_lowered_cell_ptr make_fvm_lowered_cell(backend_kind p, const execution_context& ctx, unsigned team_size) {
     switch (p) {
     case backend_kind::multicore:
-        return fvm_lowered_cell_ptr(new fvm_lowered_cell_impl<multicore::backend>(ctx));
+        return fvm_lowered_cell_ptr(new fvm_lowered_cell_impl<multicore::backend>(ctx, team_size));
     case backend_kind::gpu:
 #ifdef ARB_HAVE_GPU
         return fvm_lowered_cell_ptr(new fvm_lowered_cell_impl<gpu::backend>(ctx));
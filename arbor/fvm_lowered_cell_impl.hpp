@@ -7,25 +7,35 @@
 // implementation details may be tested in the unit tests.
 // It should otherwise only be used in `fvm_lowered_cell.cpp`.
 
+#include <algorithm>
 #include <cmath>
 #include <iterator>
 #include <memory>
 #include <optional>
 #include <queue>
+#include <tuple>
 #include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
+#include <unordered_map>
 #include <unordered_set>
 
+#include <arbor/arbexcept.hpp>
 #include <arbor/assert.hpp>
 #include <arbor/common_types.hpp>
 #include <arbor/cable_cell_param.hpp>
+#include <arbor/math.hpp>
+#include <arbor/mechinfo.hpp>
+#include <arbor/morph/place_pwlin.hpp>
 #include <arbor/recipe.hpp>
 #include <arbor/util/any_visitor.hpp>
 
 #include "builtin_mechanisms.hpp"
 #include "execution_context.hpp"
+#include "extracellular.hpp"
 #include "fvm_layout.hpp"
+#include "fvm_layout_cache.hpp"
 #include "fvm_lowered_cell.hpp"
 #include "matrix.hpp"
 #include "profile/profiler_macro.hpp"
@@ -47,7 +57,9 @@ public:
     using index_type = fvm_index_type;
     using size_type = fvm_size_type;
 
-    fvm_lowered_cell_impl(execution_context ctx): context_(ctx), threshold_watcher_(ctx) {};
+    fvm_lowered_cell_impl(execution_context ctx, unsigned team_size = 1):
+        context_(ctx), team_size_(team_size), threshold_watcher_(ctx)
+    {}
 
     void reset() override;
 
@@ -79,20 +91,30 @@ public:
 
     value_type time() const override { return tmin_; }
 
+    void set_mechanism_parameter(const std::string& mechanism, const std::string& parameter, value_type value) override;
+
     //Exposed for testing purposes
     std::vector<mechanism_ptr>& mechanisms() {
         return mechanisms_;
     }
 
+    bool single_cv_integration() const {
+        return single_cv_.active();
+    }
+
 private:
     // Host or GPU-side back-end dependent storage.
     using array = typename backend::array;
     using shared_state = typename backend::shared_state;
     using sample_event_stream = typename backend::sample_event_stream;
     using threshold_watcher = typename backend::threshold_watcher;
+    using single_cv_integrator = typename backend::single_cv_integrator;
 
     execution_context context_;
 
+    // Number of threads that share the work of integration.
+    unsigned team_size_ = 1;
+
     std::unique_ptr<shared_state> state_; // Cell state shared across mechanisms.
 
     // TODO: Can we move the backend-dependent data structures below into state_?
@@ -102,10 +124,16 @@ private:
     matrix<backend> matrix_;
     threshold_watcher threshold_watcher_;
 
+    // Fused integration step for cell groups of single-CV cells.
+    single_cv_integrator single_cv_;
+
     value_type tmin_ = 0;
     std::vector<mechanism_ptr> mechanisms_; // excludes reversal potential calculators.
     std::vector<mechanism_ptr> revpot_mechanisms_;
 
+    // Mechanisms by name, with their catalogue info for parameter lookup.
+    std::unordered_map<std::string, std::pair<mechanism*, mechanism_info>> mechanism_by_name_;
+
     // Non-physical voltage check threshold, 0 => no check.
     value_type check_voltage_mV = 0;
 
@@ -141,7 +169,7 @@ private:
 
     // Translate cell probe descriptions into probe handles etc.
     void resolve_probe_address(
-        std::vector<fvm_probe_data>& probe_data, // out parameter
+        std::vector<fvm_probe_data>& probe_data, // out parameter, appended to
         const std::vector<cable_cell>& cells,
         std::size_t cell_idx,
         const std::any& paddr,
@@ -194,6 +222,23 @@ void fvm_lowered_cell_impl<Backend>::reset() {
     threshold_watcher_.reset();
 }
 
+template <typename Backend>
+void fvm_lowered_cell_impl<Backend>::set_mechanism_parameter(const std::string& name, const std::string& parameter, value_type value) {
+    auto it = mechanism_by_name_.find(name);
+    if (it==mechanism_by_name_.end()) return;
+
+    auto& [mech, info] = it->second;
+    if (info.parameters.count(parameter)) {
+        mech->set_parameter(parameter, std::vector<value_type>(mech->size(), value));
+    }
+    else if (info.globals.count(parameter)) {
+        mech->set_global(parameter, value);
+    }
+    else {
+        throw no_such_parameter(name, parameter);
+    }
+}
+
 template <typename Backend>
 fvm_integration_result fvm_lowered_cell_impl<Backend>::integrate(
     value_type tfinal,
@@ -225,75 +270,91 @@ fvm_integration_result fvm_lowered_cell_impl<Backend>::integrate(
     // complete fvm state into shared state object.
 
     while (remaining_steps) {
-        // Update any required reversal potentials based on ionic concs.
+        if (single_cv_.active()) {
+            // All updates up to the threshold tests in one pass over the CVs.
 
-        for (auto& m: revpot_mechanisms_) {
-            m->update_current();
+            PE(advance_integrate_single_cv);
+            single_cv_.step(dt_max, tfinal, sample_events_, sample_time_, sample_value_);
+            PL();
+
+            PE(advance_integrate_ionupdate);
+            update_ion_state();
+            PL();
         }
+        else {
+            // Update any required reversal potentials based on ionic concs.
 
+            for (auto& m: revpot_mechanisms_) {
+                m->update_current();
+            }
 
-        // Deliver events and accumulate mechanism current contributions.
 
-        PE(advance_integrate_events);
-        state_->deliverable_events.mark_until_after(state_->time);
-        PL();
+            // Deliver events and accumulate mechanism current contributions.
 
-        PE(advance_integrate_current_zero);
-        state_->zero_currents();
-        PL();
-        for (auto& m: mechanisms_) {
-            m->deliver_events();
-            m->update_current();
-        }
+            PE(advance_integrate_events);
+            state_->deliverable_events.mark_until_after(state_->time);
+            PL();
 
-        // Add current contribution from gap_junctions
-        state_->add_gj_current();
+            PE(advance_integrate_current_zero);
+            state_->zero_currents();
+            PL();
+            for (auto& m: mechanisms_) {
+                m->deliver_events();
+                m->update_current();
+            }
 
-        PE(advance_integrate_events);
-        state_->deliverable_events.drop_marked_events();
+            // Add current contribution from gap_junctions
+            state_->add_gj_current();
 
-        // Update event list and integration step times.
+            PE(advance_integrate_events);
+            state_->deliverable_events.drop_marked_events();
 
-        state_->update_time_to(dt_max, tfinal);
-        state_->deliverable_events.event_time_if_before(state_->time_to);
-        state_->set_dt();
-        PL();
+            // Update event list and integration step times.
 
-        // Take samples at cell time if sample time in this step interval.
+            state_->update_time_to(dt_max, tfinal);
+            state_->deliverable_events.event_time_if_before(state_->time_to);
+            state_->set_dt();
+            PL();
 
-        PE(advance_integrate_samples);
-        sample_events_.mark_until(state_->time_to);
-        state_->take_samples(sample_events_.marked_events(), sample_time_, sample_value_);
-        sample_events_.drop_marked_events();
-        PL();
+            // Take samples at cell time if sample time in this step interval.
 
-        // Integrate voltage by matrix solve.
+            PE(advance_integrate_samples);
+            sample_events_.mark_until(state_->time_to);
+            state_->take_samples(sample_events_.marked_events(), sample_time_, sample_value_);
+            sample_events_.drop_marked_events();
+            PL();
 
-        PE(advance_integrate_matrix_build);
-        matrix_.assemble(state_->dt_intdom, state_->voltage, state_->current_density, state_->conductivity);
-        PL();
-        PE(advance_integrate_matrix_solve);
-        matrix_.solve(state_->voltage);
-        PL();
+            // Integrate voltage by matrix solve.
 
-        // Integrate mechanism state.
+            PE(advance_integrate_matrix_build);
+            matrix_.assemble(state_->dt_intdom, state_->voltage, state_->current_density, state_->conductivity);
+            PL();
+            PE(advance_integrate_matrix_solve);
+            matrix_.solve(state_->voltage);
+            PL();
 
-        for (auto& m: mechanisms_) {
-            m->update_state();
-        }
+            // Integrate mechanism state.
 
-        // Update ion concentrations.
+            for (auto& m: mechanisms_) {
+                m->update_state();
+            }
 
-        PE(advance_integrate_ionupdate);
-        update_ion_state();
-        PL();
+            // Update ion concentrations.
 
-        // Update time and test for spike threshold crossings.
+            PE(advance_integrate_ionupdate);
+            update_ion_state();
+            PL();
+
+            // Test for spike threshold crossings.
+
+            PE(advance_integrate_threshold);
+            threshold_watcher_.test();
+            PL();
+        }
+
+        // Update time.
 
-        PE(advance_integrate_threshold);
-        threshold_watcher_.test();
         std::swap(state_->time_to, state_->time);
-        PL();
 
         // Check for non-physical solutions:
 
@@ -401,15 +462,33 @@ void fvm_lowered_cell_impl<Backend>::initialize(
         return cat->instance<backend>(name);
     };
 
+    auto mech_info = [&catalogue](const std::string& name) {
+        auto cat = builtin_mechanisms().has(name)? &builtin_mechanisms(): catalogue;
+        return (*cat)[name];
+    };
+
     // Check for physically reasonable membrane volages?
 
     check_voltage_mV = global_props.membrane_voltage_limit_mV;
 
     auto num_intdoms = fvm_intdom(rec, gids, cell_to_intdom);
 
-    // Discretize cells, build matrix.
+    // Discretize cells and mechanism data, reusing cached results from
+    // earlier runs if a cache directory is given.
+
+    fvm_cv_discretization D;
+    fvm_mechanism_data mech_data;
+
+    if (global_props.discretization_cache_dir.empty()) {
+        D = fvm_cv_discretize(cells, global_props.default_parameters, context_);
+        mech_data = fvm_build_mechanism_data(global_props, cells, D, context_);
+    }
+    else {
+        std::tie(D, mech_data) =
+            fvm_build_layout_cached(global_props.discretization_cache_dir, global_props, cells, context_);
+    }
 
-    fvm_cv_discretization D = fvm_cv_discretize(cells, global_props.default_parameters, context_);
+    // Build matrix.
 
     std::vector<index_type> cv_to_intdom(D.size());
     std::transform(D.geometry.cv_to_cell.begin(), D.geometry.cv_to_cell.end(), cv_to_intdom.begin(),
@@ -420,10 +499,6 @@ void fvm_lowered_cell_impl<Backend>::initialize(
                               D.cv_capacitance, D.face_conductance, D.cv_area, cell_to_intdom);
     sample_events_ = sample_event_stream(num_intdoms);
 
-    // Discretize mechanism data.
-
-    fvm_mechanism_data mech_data = fvm_build_mechanism_data(global_props, cells, D, context_);
-
     // Discretize and build gap junction info.
 
     auto gj_vector = fvm_gap_junctions(cells, gids, rec, D);
@@ -513,6 +588,7 @@ void fvm_lowered_cell_impl<Backend>::initialize(
         auto minst = mech_instance(name);
         minst.mech->instantiate(mech_id++, *state_, minst.overrides, layout);
         mechptr_by_name[name] = minst.mech.get();
+        mechanism_by_name_[name] = {minst.mech.get(), mech_info(name)};
 
         for (auto& pv: config.param_values) {
             minst.mech->set_parameter(pv.first, pv.second);
@@ -529,7 +605,7 @@ void fvm_lowered_cell_impl<Backend>::initialize(
 
     std::vector<index_type> detector_cv;
     std::vector<value_type> detector_threshold;
-    std::vector<fvm_probe_data> probe_data;
+    std::vector<std::vector<probe_info>> cell_probes(ncell);
 
     for (auto cell_idx: make_span(ncell)) {
         cell_gid_type gid = gids[cell_idx];
@@ -550,25 +626,103 @@ void fvm_lowered_cell_impl<Backend>::initialize(
             detector_threshold.push_back(entry.item.threshold);
         }
 
-        std::vector<probe_info> rec_probes = rec.get_probes(gid);
-        for (cell_lid_type i: count_along(rec_probes)) {
-            probe_info& pi = rec_probes[i];
-            resolve_probe_address(probe_data, cells, cell_idx, std::move(pi.address),
-                D, mech_data, target_handles, mechptr_by_name);
+        cell_probes[cell_idx] = rec.get_probes(gid);
+    }
 
-            if (!probe_data.empty()) {
-                cell_member_type probe_id{gid, i};
-                probe_map.tag[probe_id] = pi.tag;
+    // Resolve probe addresses in parallel over the cells, then collate the
+    // results in cell and probe order. The data of the probes of a cell are
+    // held in one vector, partitioned by probe.
+
+    std::vector<std::vector<fvm_probe_data>> cell_probe_data(ncell);
+    std::vector<std::vector<std::size_t>> cell_probe_divs(ncell);
+    threading::parallel_for::apply(0, ncell, context_.thread_pool.get(),
+        [&](cell_size_type cell_idx) {
+            auto& rec_probes = cell_probes[cell_idx];
+            auto& probe_data = cell_probe_data[cell_idx];
+            auto& probe_divs = cell_probe_divs[cell_idx];
+
+            probe_data.reserve(rec_probes.size());
+            probe_divs.reserve(rec_probes.size()+1);
+            probe_divs.push_back(0);
+            for (auto& probe: rec_probes) {
+                resolve_probe_address(probe_data, cells, cell_idx, probe.address,
+                    D, mech_data, target_handles, mechptr_by_name);
+                probe_divs.push_back(probe_data.size());
+            }
+        });
+
+    // Gather the rows of the transfer probes into the one sparse map of the
+    // cell group held by the back-end, and point the raw handles of each
+    // probe at its rows.
+    {
+        std::vector<fvm_probe_transfer*> transfer_probes;
+        std::vector<fvm_index_type> row_divs = {0}, row_cv;
+        std::vector<fvm_value_type> row_coef;
+
+        for (auto& probe_data: cell_probe_data) {
+            for (auto& d: probe_data) {
+                auto t = std::get_if<fvm_probe_transfer>(&d.info);
+                if (!t) continue;
+
+                fvm_index_type base = row_cv.size();
+                for (std::size_t i = 1; i<t->row_divs.size(); ++i) {
+                    row_divs.push_back(base+t->row_divs[i]);
+                }
+                util::append(row_cv, t->cv);
+                util::append(row_coef, t->coef);
+
+                t->row_divs.clear();
+                t->cv.clear();
+                t->coef.clear();
+                transfer_probes.push_back(t);
+            }
+        }
 
-                for (auto& data: probe_data) {
-                    probe_map.data.insert({probe_id, std::move(data)});
+        if (!transfer_probes.empty()) {
+            state_->set_transfer(row_divs, row_cv, row_coef);
+
+            const fvm_value_type* row = state_->transfer_value.data();
+            for (auto t: transfer_probes) {
+                for (std::size_t i = 0; i<t->metadata.size(); ++i) {
+                    t->raw_handles.push_back(row++);
                 }
+                t->shrink_to_fit();
+            }
+        }
+    }
+
+    auto size = [](auto& v) { return v.size(); };
+    probe_map.tag.reserve(probe_map.tag.size()+util::sum_by(cell_probes, size));
+    probe_map.data.reserve(probe_map.data.size()+util::sum_by(cell_probe_data, size));
+
+    for (auto cell_idx: make_span(ncell)) {
+        auto& probe_data = cell_probe_data[cell_idx];
+        auto& probe_divs = cell_probe_divs[cell_idx];
+
+        for (cell_lid_type i = 0; i+1<probe_divs.size(); ++i) {
+            if (probe_divs[i]==probe_divs[i+1]) continue;
+
+            cell_member_type probe_id{gids[cell_idx], i};
+            probe_map.tag[probe_id] = cell_probes[cell_idx][i].tag;
+
+            for (auto j = probe_divs[i]; j<probe_divs[i+1]; ++j) {
+                probe_map.data.insert({probe_id, std::move(probe_data[j])});
             }
         }
     }
 
     threshold_watcher_ = backend::voltage_watcher(*state_, detector_cv, detector_threshold, context_);
 
+    backend::set_thread_team(team_size_, context_, *state_, matrix_.state_, threshold_watcher_);
+
+    single_cv_ = single_cv_integrator{};
+    if (global_props.fuse_single_cv_integration) {
+        std::vector<mechanism*> revpot_mechs, mechs;
+        for (auto& m: revpot_mechanisms_) revpot_mechs.push_back(m.get());
+        for (auto& m: mechanisms_) mechs.push_back(m.get());
+        single_cv_ = single_cv_integrator(*state_, matrix_.state_, threshold_watcher_, revpot_mechs, mechs);
+    }
+
     reset();
 }
 
@@ -698,6 +852,14 @@ struct probe_resolution_data {
         return data;
     }
 
+    // Indices into a sorted vector of CVs of the CVs of the cell.
+    auto cell_cv_indices(const std::vector<fvm_index_type>& cvs) const {
+        auto cell_cv_ival = D.geometry.cell_cv_interval(cell_idx);
+        std::size_t lb = std::lower_bound(cvs.begin(), cvs.end(), cell_cv_ival.first)-cvs.begin();
+        std::size_t ub = std::lower_bound(cvs.begin()+lb, cvs.end(), cell_cv_ival.second)-cvs.begin();
+        return util::make_span(lb, ub);
+    }
+
     // Extent of density mechanism on cell.
     mextent mechanism_support(const std::string& name) const {
         auto& mech_map = cell.region_assignments().template get<mechanism_desc>();
@@ -727,7 +889,6 @@ void fvm_lowered_cell_impl<Backend>::resolve_probe_address(
     const std::vector<target_handle>& handles,
     const std::unordered_map<std::string, mechanism*>& mech_instance_by_name)
 {
-    probe_data.clear();
     probe_resolution_data<Backend> prd{
         probe_data, state_.get(), cells[cell_idx], cell_idx, D, M, handles, mech_instance_by_name};
 
@@ -738,6 +899,7 @@ void fvm_lowered_cell_impl<Backend>::resolve_probe_address(
         cable_probe_total_ion_current_density,
         cable_probe_total_ion_current_cell,
         cable_probe_total_current_cell,
+        cable_probe_extracellular_potential,
         cable_probe_density_state,
         cable_probe_density_state_cell,
         cable_probe_point_state,
@@ -859,6 +1021,79 @@ void resolve_probe(const cable_probe_total_current_cell& p, probe_resolution_dat
     R.result.push_back(std::move(r));
 }
 
+template <typename B>
+void resolve_probe(const cable_probe_extracellular_potential& p, probe_resolution_data<B>& R) {
+    // The membrane current of each CV is a linear function of the CV voltages,
+    // as for cable_probe_total_current_cell, and each electrode potential is a
+    // linear function of the membrane currents: compose the two into a
+    // transfer matrix from CV voltages to electrode potentials.
+
+    auto cell_cv_ival = R.D.geometry.cell_cv_interval(R.cell_idx);
+    auto cv0 = cell_cv_ival.first;
+    auto n_cv = cell_cv_ival.second-cv0;
+    auto n_electrode = p.electrodes.size();
+    if (!n_electrode) return;
+
+    // Potential at each electrode due to a unit current across the membrane of
+    // each CV, distributed over its segments in proportion to their area.
+    place_pwlin placement(R.cell.morphology());
+    std::vector<double> response(n_electrode*n_cv);
+    std::vector<std::pair<msegment, double>> cv_segments;
+
+    for (auto cv: R.D.geometry.cell_cvs(R.cell_idx)) {
+        cv_segments.clear();
+        double cv_area = 0;
+        for (auto cable: R.D.geometry.cables(cv)) {
+            for (auto& seg: placement.segments(mextent(mcable_list{cable}))) {
+                double area = math::area_frustrum(distance(seg.prox, seg.dist), seg.prox.radius, seg.dist.radius);
+                cv_segments.push_back({seg, area});
+                cv_area += area;
+            }
+        }
+        if (cv_area==0) continue;
+
+        for (auto e: util::make_span(n_electrode)) {
+            double& r = response[e*n_cv+cv-cv0];
+            for (auto& [seg, area]: cv_segments) {
+                r += area/cv_area*line_source_potential(seg, p.electrodes[e], p.conductivity);
+            }
+        }
+    }
+
+    std::vector<double> transfer(n_electrode*n_cv);
+    for (auto cv: R.D.geometry.cell_cvs(R.cell_idx)) {
+        auto parent_cv = R.D.geometry.cv_parent[cv];
+        if (parent_cv+1==0) continue;
+
+        // The current cond·(v[cv]-v[parent_cv]) flows out of the membrane of
+        // the parent CV and into that of the CV.
+        double cond = R.D.face_conductance[cv];
+        auto i = cv-cv0, j = parent_cv-cv0;
+        for (auto e: util::make_span(n_electrode)) {
+            double d = cond*(response[e*n_cv+j]-response[e*n_cv+i]);
+            transfer[e*n_cv+i] += d;
+            transfer[e*n_cv+j] -= d;
+        }
+    }
+
+    // One row per electrode over the CVs of the cell; the rows are added to
+    // the map of the cell group, and the raw handles set, on initialization.
+    fvm_probe_transfer r;
+    r.row_divs.push_back(0);
+    for (auto e: util::make_span(n_electrode)) {
+        for (auto i: util::make_span(n_cv)) {
+            if (double c = transfer[e*n_cv+i]) {
+                r.cv.push_back(cv0+i);
+                r.coef.push_back(c);
+            }
+        }
+        r.row_divs.push_back(r.cv.size());
+    }
+    r.metadata = p.electrodes;
+    r.shrink_to_fit();
+    R.result.push_back(std::move(r));
+}
+
 template <typename B>
 void resolve_probe(const cable_probe_density_state& p, probe_resolution_data<B>& R) {
     const fvm_value_type* data = R.mechanism_state(p.mechanism, p.state);
@@ -887,7 +1122,7 @@ void resolve_probe(const cable_probe_density_state_cell& p, probe_resolution_dat
     auto& mech_cvs = R.M.mechanisms.at(p.mechanism).cv;
     mcable_list cables;
 
-    for (auto i: util::count_along(mech_cvs)) {
+    for (auto i: R.cell_cv_indices(mech_cvs)) {
         auto cv = mech_cvs[i];
         auto cv_cables = R.D.geometry.cables(cv);
         mextent cv_extent = mcable_list(cv_cables.begin(), cv_cables.end());
@@ -998,7 +1233,7 @@ void resolve_probe(const cable_probe_ion_current_cell& p, probe_resolution_data<
             }
         }
     }
-    r.metadata.shrink_to_fit();
+    r.shrink_to_fit();
     R.result.push_back(std::move(r));
 }
 
@@ -1028,7 +1263,7 @@ void resolve_ion_conc_common(const std::vector<fvm_index_type>& ion_cvs, const f
     fvm_probe_multi r;
     mcable_list cables;
 
-    for (auto i: util::count_along(ion_cvs)) {
+    for (auto i: R.cell_cv_indices(ion_cvs)) {
         for (auto cable: R.D.geometry.cables(ion_cvs[i])) {
             if (cable.prox_pos!=cable.dist_pos) {
                 r.raw_handles.push_back(src+i);
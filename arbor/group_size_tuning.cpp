@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <arbor/arbexcept.hpp>
+#include <arbor/context.hpp>
+#include <arbor/domain_decomposition.hpp>
+#include <arbor/load_balance.hpp>
+#include <arbor/recipe.hpp>
+#include <arbor/simulation.hpp>
+
+#include "cell_group_factory.hpp"
+#include "distributed_context.hpp"
+#include "execution_context.hpp"
+#include "gpu_context.hpp"
+#include "util/maputil.hpp"
+#include "util/rangeutil.hpp"
+#include "util/span.hpp"
+
+namespace arb {
+
+namespace {
+// A sample of the cells of a recipe, renumbered from zero, without
+// connections, event generators, gap junctions or probes.
+
+struct sample_recipe: public recipe {
+    sample_recipe(const recipe& rec, std::vector<cell_gid_type> gids):
+        rec_(rec), gids_(std::move(gids))
+    {}
+
+    cell_size_type num_cells() const override { return gids_.size(); }
+
+    util::unique_any get_cell_description(cell_gid_type i) const override {
+        return rec_.get_cell_description(gids_[i]);
+    }
+
+    cell_kind get_cell_kind(cell_gid_type i) const override {
+        return rec_.get_cell_kind(gids_[i]);
+    }
+
+    cell_size_type num_sources(cell_gid_type i) const override {
+        return rec_.num_sources(gids_[i]);
+    }
+
+    cell_size_type num_targets(cell_gid_type i) const override {
+        return rec_.num_targets(gids_[i]);
+    }
+
+    std::any get_global_properties(cell_kind k) const override {
+        return rec_.get_global_properties(k);
+    }
+
+private:
+    const recipe& rec_;
+    std::vector<cell_gid_type> gids_;
+};
+} // anonymous namespace
+
+group_size_tuning_result tune_cpu_group_size(
+    const recipe& rec,
+    const context& ctx,
+    partition_hint_map hint_map,
+    const group_size_tuning& opts)
+{
+    using clock = std::chrono::steady_clock;
+
+    if (opts.group_sizes.empty() || util::any_of(opts.group_sizes, [](auto s) { return s==0; })) {
+        throw arbor_exception("group size tuning requires one or more non-zero group sizes");
+    }
+    if (!opts.steps || !(opts.dt>0)) {
+        throw arbor_exception("group size tuning requires a positive number of steps and time step");
+    }
+
+    const auto& dist = *ctx->distributed;
+    const unsigned num_domains = dist.size();
+    const unsigned domain_id = dist.id();
+    const unsigned num_threads = ctx->thread_pool->get_num_threads();
+
+    // Trials are run on the local rank only, with the threads of ctx.
+    context local_ctx(new execution_context(*ctx));
+    local_ctx->distributed = make_local_context();
+
+    // Local cells without gap junctions, by kind, taken from the cells that
+    // partition_load_balance assigns to this rank.
+    const cell_gid_type num_global_cells = rec.num_cells();
+    const cell_gid_type B = num_global_cells/num_domains;
+    const cell_gid_type R = num_global_cells - num_domains*B;
+    const cell_gid_type first = domain_id*B + std::min<cell_gid_type>(domain_id, R);
+    const cell_gid_type last = first + B + (domain_id<R);
+
+    std::unordered_map<cell_kind, std::vector<cell_gid_type>> kind_gids;
+    for (auto gid: util::make_span(first, last)) {
+        if (rec.gap_junctions_on(gid).empty()) {
+            kind_gids[rec.get_cell_kind(gid)].push_back(gid);
+        }
+    }
+
+    group_size_tuning_result result;
+    result.hints = hint_map;
+
+    // Kinds are visited in the same order on every rank, as the choice of
+    // group size is made collectively.
+    for (auto kind: {cell_kind::cable, cell_kind::lif, cell_kind::spike_source, cell_kind::benchmark}) {
+        const auto& gids = kind_gids[kind];
+        if (!dist.sum((unsigned)gids.size())) continue;
+
+        partition_hint hint;
+        if (auto opt_hint = util::value_by_key(hint_map, kind)) {
+            hint = opt_hint.value();
+        }
+        if (hint.prefer_gpu && ctx->gpu->has_gpu() && cell_kind_supported(kind, backend_kind::gpu, *ctx)) {
+            continue;
+        }
+
+        double best = -1;
+        for (auto size: opts.group_sizes) {
+            // One group per thread, or fewer if there are not enough cells.
+            std::size_t n = std::min<std::size_t>(gids.size(), size*num_threads);
+            double throughput = 0;
+
+            if (n) {
+                sample_recipe sample(rec, std::vector<cell_gid_type>(gids.begin(), gids.begin()+n));
+
+                domain_decomposition d;
+                d.num_domains = 1;
+                d.domain_id = 0;
+                d.num_local_cells = n;
+                d.num_global_cells = n;
+                d.gid_domain = [](cell_gid_type) { return 0; };
+                for (std::size_t i = 0; i<n; i += size) {
+                    auto members = util::make_span(i, std::min(i+size, n));
+                    d.groups.push_back({kind, std::vector<cell_gid_type>(members.begin(), members.end()), backend_kind::multicore});
+                }
+
+                // The first step is not timed, as it includes the set up of
+                // the cell groups.
+                simulation sim(sample, d, local_ctx);
+                sim.run(opts.dt, opts.dt);
+
+                auto t0 = clock::now();
+                sim.run(opts.dt*(opts.steps+1), opts.dt);
+                double elapsed = std::chrono::duration<double>(clock::now()-t0).count();
+
+                throughput = n*opts.steps/(std::max(elapsed, 1e-9)*num_threads);
+            }
+
+            // Ranks without cells of this kind count as zero throughput.
+            throughput = dist.sum(throughput)/num_domains;
+            result.trials.push_back({kind, size, throughput});
+
+            if (throughput>best) {
+                best = throughput;
+                hint.cpu_group_size = size;
+            }
+        }
+        result.hints[kind] = hint;
+    }
+
+    return result;
+}
+
+} // namespace arb
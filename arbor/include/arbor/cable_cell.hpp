@@ -101,6 +101,18 @@ struct cable_probe_total_ion_current_cell {};
 // Sample metadata type: `mcable_list`
 struct cable_probe_total_current_cell {};
 
+// Extracellular potential [mV] at each electrode position, from the total
+// membrane currents of the cell treated as line sources in an infinite
+// homogeneous medium of the given conductivity [S/m]. Electrode positions
+// are in the coordinate frame of the cell morphology; the radius of each
+// point is ignored.
+// Sample value type: `cable_sample_range`
+// Sample metadata type: `std::vector<mpoint>`
+struct cable_probe_extracellular_potential {
+    std::vector<mpoint> electrodes;
+    double conductivity = 0.3;
+};
+
 // Value of state variable `state` in density mechanism `mechanism` in CV at `location`.
 // Sample value type: `double`
 // Sample metadata type: `mlocation`
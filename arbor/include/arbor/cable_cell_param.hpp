@@ -253,6 +253,14 @@ struct cable_cell_global_properties {
     // True => combine linear synapses for performance.
     bool coalesce_synapses = true;
 
+    // True => integrate cell groups in which every cell has a single CV in
+    // one fused pass over the CVs, where the back-end supports it.
+    bool fuse_single_cv_integration = false;
+
+    // If non-empty, an existing directory in which the discretization and
+    // mechanism layout of each cell is cached for reuse in later runs.
+    std::string discretization_cache_dir;
+
     // Available ion species, together with charge.
     std::unordered_map<std::string, int> ion_species = {
         {"na", 1},
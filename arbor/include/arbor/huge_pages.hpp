@@ -0,0 +1,27 @@
+#pragma once
+
+// Opt-in backing of large host allocations of simulation state by huge pages.
+
+#include <cstddef>
+
+namespace arb {
+
+// Huge page size, to which allocations backed by huge pages are aligned.
+constexpr std::size_t huge_page_size = std::size_t(1)<<21;
+
+// Host allocations of at least threshold bytes made for simulation state,
+// such as the shared state, mechanism data, matrix and event buffers of the
+// multicore back-end, are aligned and padded to huge_page_size and marked with
+// madvise(MADV_HUGEPAGE), so that the kernel can back them with transparent
+// huge pages and fewer TLB entries are needed to address them.
+//
+// A threshold of zero, the default, disables the use of huge pages. Where
+// transparent huge pages are not available, or on systems other than Linux,
+// the allocations are backed by regular pages as usual.
+//
+// The threshold applies to allocations made after it is set, so it should be
+// set before a simulation is constructed.
+void set_huge_page_threshold(std::size_t threshold);
+std::size_t huge_page_threshold();
+
+} // namespace arb
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <unordered_map>
+#include <vector>
 
 #include <arbor/context.hpp>
 #include <arbor/domain_decomposition.hpp>
@@ -24,4 +25,36 @@ domain_decomposition partition_load_balance(
     const context& ctx,
     partition_hint_map hint_map = {});
 
+// Choice of cpu_group_size by timing trial cell groups of each candidate size.
+
+struct group_size_tuning {
+    // Candidate group sizes.
+    std::vector<std::size_t> group_sizes = {1, 4, 16, 64, 256};
+
+    // Number of timed steps of each trial, and the step size [ms].
+    unsigned steps = 10;
+    time_type dt = 0.025;
+};
+
+struct group_size_trial {
+    cell_kind kind;
+    std::size_t group_size;
+    double throughput;  // Cell steps per second per thread, averaged over ranks.
+};
+
+struct group_size_tuning_result {
+    // The given hints, with cpu_group_size set to the chosen size for each
+    // tuned cell kind.
+    partition_hint_map hints;
+
+    // All trials, in the order they were run.
+    std::vector<group_size_trial> trials;
+};
+
+group_size_tuning_result tune_cpu_group_size(
+    const recipe& rec,
+    const context& ctx,
+    partition_hint_map hint_map = {},
+    const group_size_tuning& opts = {});
+
 } // namespace arb
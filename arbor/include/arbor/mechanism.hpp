@@ -49,6 +49,9 @@ public:
     // Non-global parameters can be set post-instantiation:
     virtual void set_parameter(const std::string& key, const std::vector<fvm_value_type>& values) = 0;
 
+    // As can global parameters, overriding values given at instantiation:
+    virtual void set_global(const std::string& key, fvm_value_type value) = 0;
+
     // Simulation interfaces:
     virtual void initialize() = 0;
     virtual void update_state() {};
@@ -2,8 +2,10 @@
 
 // Embedding of cell morphology as 1-d tree with piecewise linear radius.
 
+#include <memory>
 #include <vector>
 
+#include <arbor/context.hpp>
 #include <arbor/morph/morphology.hpp>
 #include <arbor/morph/primitives.hpp>
 
@@ -19,21 +21,19 @@ template <typename X> struct pw_elements;
 // values defined over contiguous intervals.
 using pw_constant_fn = util::pw_elements<double>;
 
+// The interpolated quantities over each branch are computed when the branch
+// is first queried, unless the embedding is constructed with a context, in
+// which case they are computed for all branches up front, in parallel.
+// Copies of an embedding share this state, and may be queried concurrently.
+
 struct embed_pwlin {
     explicit embed_pwlin(const arb::morphology& m);
+    embed_pwlin(const arb::morphology& m, const context& ctx);
 
     // Segment queries.
-    msize_t num_segments() const {
-        return segment_cables_.size();
-    }
-
-    mcable segment(msize_t seg_id) const {
-        return segment_cables_.at(seg_id);
-    }
-
-    const mlocation_list& segment_ends() const {
-        return all_segment_ends_;
-    }
+    msize_t num_segments() const;
+    mcable segment(msize_t seg_id) const;
+    const mlocation_list& segment_ends() const;
 
     // Interpolated radius at location.
     double radius(mlocation) const;
@@ -68,8 +68,6 @@ struct embed_pwlin {
     }
 
 private:
-    mlocation_list all_segment_ends_;
-    std::vector<mcable> segment_cables_;
     std::shared_ptr<embed_pwlin_data> data_;
 };
 
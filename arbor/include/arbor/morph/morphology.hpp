@@ -17,7 +17,7 @@ class morphology {
     std::shared_ptr<const morphology_impl> impl_;
 
 public:
-    morphology(segment_tree m);
+    morphology(const segment_tree& m);
     morphology();
 
     // Empty/default-constructed morphology?
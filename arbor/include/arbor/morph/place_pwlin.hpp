@@ -5,6 +5,7 @@
 
 #include <cmath>
 #include <utility>
+#include <vector>
 
 #include <arbor/morph/morphology.hpp>
 #include <arbor/morph/primitives.hpp>
@@ -84,6 +85,12 @@ struct place_pwlin {
     // Maximal set of segments or part segments whose union is coterminous with extent.
     std::vector<msegment> all_segments(const mextent& extent) const;
 
+    // All segments, each with the cable on the morphology that it covers.
+    std::vector<std::pair<mcable, msegment>> segment_cables() const;
+
+    // As segments(extent), with the cable covered by each segment or part segment.
+    std::vector<std::pair<mcable, msegment>> segment_cables(const mextent& extent) const;
+
 private:
     std::shared_ptr<place_pwlin_data> data_;
 };
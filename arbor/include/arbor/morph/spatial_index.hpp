@@ -0,0 +1,64 @@
+#pragma once
+
+// Spatial index over the segments of one or more placed morphologies,
+// for proximity queries against points or against another index.
+//
+// Distances are measured between segment axes; segment radii are ignored.
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <arbor/context.hpp>
+#include <arbor/morph/morphology.hpp>
+#include <arbor/morph/place_pwlin.hpp>
+#include <arbor/morph/primitives.hpp>
+
+namespace arb {
+
+// A location on an indexed morphology, with its distance [µm] from the query.
+struct indexed_location {
+    std::size_t item;   // Index of the placement from which the index was built.
+    mlocation loc;
+    double distance;
+};
+
+// Closest locations on a segment from each of two indices.
+struct indexed_location_pair {
+    indexed_location first;
+    indexed_location second;
+};
+
+struct spatial_index_data;
+
+struct spatial_index {
+    // Index all segments of each placed morphology, or only those parts of
+    // the segments that lie in the corresponding extent.
+    explicit spatial_index(const std::vector<place_pwlin>& placements);
+    spatial_index(const std::vector<place_pwlin>& placements, const std::vector<mextent>& extents);
+
+    // As above, but build the index with the threads of the context.
+    spatial_index(const std::vector<place_pwlin>& placements, const context& ctx);
+    spatial_index(const std::vector<place_pwlin>& placements, const std::vector<mextent>& extents, const context& ctx);
+
+    // Number of indexed segments.
+    std::size_t size() const;
+
+    // For each indexed segment within distance r of p, the location on the
+    // segment closest to p.
+    std::vector<indexed_location> within(const mpoint& p, double r) const;
+
+    // The location closest to p over all indexed segments, if any.
+    std::optional<indexed_location> nearest(const mpoint& p) const;
+
+    // For each pair of segments, one from this index and one from other,
+    // within distance r of each other, the closest locations on the two
+    // segments. An index may be queried against itself.
+    std::vector<indexed_location_pair> within(const spatial_index& other, double r) const;
+
+private:
+    std::shared_ptr<const spatial_index_data> data_;
+};
+
+} // namespace arb
@@ -85,6 +85,13 @@ public:
         return {};
     }
 
+    // Fold connections with the same source, target and delay into one
+    // connection with the sum of their weights. This is only valid if the
+    // response of every target is linear in the weight of its events.
+    virtual bool fold_connections() const {
+        return false;
+    }
+
     virtual std::vector<probe_info> get_probes(cell_gid_type gid) const {
         return {};
     }
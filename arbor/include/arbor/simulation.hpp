@@ -1,7 +1,9 @@
 #pragma once
 
 #include <array>
+#include <functional>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -18,6 +20,10 @@ namespace arb {
 
 using spike_export_function = std::function<void(const std::vector<spike>&)>;
 
+// Called with a sample time and the element-wise sum of the sample values
+// taken at that time.
+using summed_sample_function = std::function<void(time_type, const std::vector<double>&)>;
+
 // simulation_state comprises private implementation for simulation class.
 class simulation_state;
 
@@ -39,15 +45,53 @@ public:
 
     void remove_all_samplers();
 
+    // Sum the samples of the matching probes over all cells on all domains.
+    // Probes with several values per sample (for example an extracellular
+    // potential probe with several electrodes) are summed element-wise.
+    // The callback is invoked at the end of each epoch, on the thread that
+    // called `run`, once for each sample time in the epoch.
+    //
+    // Note: this is a collective operation; summed samplers must be added
+    // in the same order on every domain.
+
+    sampler_association_handle add_summed_sampler(cell_member_predicate probe_ids,
+        schedule sched, summed_sample_function f);
+
     // Return probe metadata, one entry per probe associated with supplied probe id,
     // or an empty vector if no local match for probe id.
     std::vector<probe_metadata> get_probe_metadata(cell_member_type probe_id) const;
 
     std::size_t num_spikes() const;
 
+    // Number of connections with targets on this domain that were folded
+    // into parallel connections (see recipe::fold_connections).
+    std::size_t num_folded_connections() const;
+
     // Set event binning policy on all our groups.
     void set_binning_policy(binning_kind policy, time_type bin_interval);
 
+    // Set a parameter or global of the named mechanism to value on every cell
+    // on which the mechanism is present, in place of the values given by the
+    // cell descriptions. Mechanism state is initialized with the new values
+    // on the next reset.
+    void set_mechanism_parameter(const std::string& mechanism, const std::string& parameter, double value);
+
+    // Exchange spikes between domains in a compact wire format. Spike times
+    // are rounded to multiples of resolution [ms], or sent exactly if
+    // resolution is zero. Throws range_check_failure if resolution is
+    // negative or not less than the minimum connection delay.
+    void set_compact_spike_exchange(bool enable, time_type resolution = 0);
+
+    // Exchange spikes in two levels when MPI ranks share a node: the spikes
+    // of a node are pooled on one rank, which alone takes part in the
+    // exchange between nodes. Must be set the same on every rank.
+    void set_node_spike_exchange(bool enable);
+
+    // Pass spikes to the spike callbacks in a canonical order, by time and
+    // then by source, that does not depend on the number of threads, the
+    // cell groups or the number of domains.
+    void set_deterministic(bool enable);
+
     // Register a callback that will perform a export of the global
     // spike vector.
     void set_global_spike_callback(spike_export_function = spike_export_function{});
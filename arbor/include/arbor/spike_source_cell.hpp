@@ -1,6 +1,8 @@
 #pragma once
 
+#include <arbor/common_types.hpp>
 #include <arbor/schedule.hpp>
+#include <arbor/spike_trains.hpp>
 
 namespace arb {
 
@@ -9,6 +11,11 @@ namespace arb {
 
 struct spike_source_cell {
     schedule seq;
+
+    // If trains is set, the spike times are instead those of the given
+    // train, read directly from the mapped spike train file.
+    spike_train_file trains;
+    cell_gid_type train = 0;
 };
 
 } // namespace arb
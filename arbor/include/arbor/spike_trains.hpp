@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <arbor/arbexcept.hpp>
+#include <arbor/common_types.hpp>
+#include <arbor/spike.hpp>
+
+namespace arb {
+
+// Spike trains in a binary file in compressed sparse row format, with one
+// train per index (typically the gid of a spike source cell). Values are
+// stored in native byte order:
+//
+//     char[8]        magic "ARBSPKT1"
+//     std::uint64_t  number of trains n
+//     std::uint64_t  number of spikes m
+//     std::uint64_t  offsets[n+1]: train i comprises times[offsets[i], offsets[i+1])
+//     double         times[m], sorted within each train [ms]
+
+struct bad_spike_train_file: arbor_exception {
+    bad_spike_train_file(const std::string& path, const std::string& reason);
+    std::string path;
+};
+
+// A spike train file mapped read-only into memory. Copies share the mapping,
+// which is released with the last copy.
+class spike_train_file {
+public:
+    spike_train_file() = default;
+
+    // Throws bad_spike_train_file if the file can't be mapped or is not a
+    // consistent spike train file.
+    explicit spike_train_file(const std::string& path);
+
+    std::size_t num_trains() const;
+    std::size_t num_spikes() const;
+
+    // Spike times of train i; empty if i is not less than num_trains().
+    std::pair<const time_type*, const time_type*> train(std::size_t i) const;
+
+    explicit operator bool() const { return bool(impl_); }
+
+    friend bool operator==(const spike_train_file& a, const spike_train_file& b) {
+        return a.impl_==b.impl_;
+    }
+
+private:
+    struct mapping;
+    std::shared_ptr<const mapping> impl_;
+};
+
+// Write the spikes to a spike train file, with the train of each spike given
+// by the gid of its source. The file holds the larger of num_trains and one
+// more than the largest source gid trains.
+void write_spike_train_file(const std::string& path, std::vector<spike> spikes, std::size_t num_trains = 0);
+
+} // namespace arb
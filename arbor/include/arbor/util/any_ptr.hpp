@@ -40,6 +40,8 @@ struct any_ptr {
 
     any_ptr(std::nullptr_t) {}
 
+    any_ptr(const any_ptr&) noexcept = default;
+
     template <typename T>
     any_ptr(T* ptr):
         ptr_((void *)ptr), type_ptr_(&typeid(T*)) {}
@@ -21,6 +21,7 @@ lif_cell_group::lif_cell_group(const std::vector<cell_gid_type>& gids, const rec
 
     cells_.reserve(gids_.size());
     last_time_updated_.resize(gids_.size());
+    event_queues_.resize(gids_.size());
 
     for (auto lid: util::make_span(gids_.size())) {
         cells_.push_back(util::any_cast<lif_cell>(rec.get_cell_description(gids_[lid])));
@@ -62,30 +63,37 @@ void lif_cell_group::set_binning_policy(binning_kind policy, time_type bin_inter
 
 void lif_cell_group::reset() {
     spikes_.clear();
-    last_time_updated_.clear();
+    last_time_updated_.assign(gids_.size(), 0.);
+    for (auto& q: event_queues_) {
+        q.clear();
+    }
 }
 
 // Advances a single cell (lid) with the exact solution (jumps can be arbitrary).
 // Parameter dt is ignored, since we make jumps between two consecutive spikes.
 void lif_cell_group::advance_cell(time_type tfinal, time_type dt, cell_gid_type lid, pse_vector& event_lane) {
+    // Queue the events that arrived since the last epoch; events due after
+    // tfinal stay queued for later epochs.
+    auto& queue = event_queues_[lid];
+    for (auto& ev: event_lane) {
+        queue.push(ev);
+    }
+    event_lane.clear();
+
     // Current time of last update.
     auto t = last_time_updated_[lid];
     auto& cell = cells_[lid];
-    const auto n_events = event_lane.size();
 
     // Integrate until tfinal using the exact solution of membrane voltage differential equation.
-    for (unsigned i=0; i<n_events; ++i ) {
-        auto& ev = event_lane[i];
-        const auto time = ev.time;
-        auto weight = ev.weight;
+    while (auto ev = queue.pop_if_before(tfinal)) {
+        const auto time = ev->time;
+        auto weight = ev->weight;
 
         if (time < t) continue;        // skip event if a neuron is in refactory period
-        if (time >= tfinal) break;     // end of integration interval
 
         // if there are events that happened at the same time as this event, process them as well
-        while (i + 1 < n_events && event_lane[i+1].time <= time) {
-            weight += event_lane[i+1].weight;
-            i++;
+        while (auto next = queue.pop_if_not_after(time)) {
+            weight += next->weight;
         }
 
         // Let the membrane potential decay.
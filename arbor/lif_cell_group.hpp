@@ -9,6 +9,7 @@
 #include <arbor/spike.hpp>
 
 #include "cell_group.hpp"
+#include "event_queue.hpp"
 
 namespace arb {
 
@@ -25,6 +26,7 @@ public:
     virtual void reset() override;
     virtual void set_binning_policy(binning_kind policy, time_type bin_interval) override;
     virtual void advance(epoch epoch, time_type dt, const event_lane_subrange& events) override;
+    virtual bool queues_events() const override { return true; }
 
     virtual const std::vector<spike>& spikes() const override;
     virtual void clear_spikes() override;
@@ -51,6 +53,9 @@ private:
 
     // Time when the cell was last updated.
     std::vector<time_type> last_time_updated_;
+
+    // Pending events of each cell, in order of delivery time.
+    std::vector<event_queue<spike_event>> event_queues_;
 };
 
 } // namespace arb
@@ -303,6 +303,37 @@ void run_samples(
     sc.sampler({sc.probe_id, sc.tag, sc.index, p.get_metadata_ptr()}, n_sample, sample_records.data());
 }
 
+void run_samples(
+    const fvm_probe_transfer& p,
+    const sampler_call_info& sc,
+    const fvm_value_type* raw_times,
+    const fvm_value_type* raw_samples,
+    std::vector<sample_record>& sample_records,
+    fvm_probe_scratch& scratch)
+{
+    // The back-end evaluates the values, one raw sample each.
+    const sample_size_type n_raw_per_sample = p.raw_handles.size();
+    sample_size_type n_sample = (sc.end_offset-sc.begin_offset)/n_raw_per_sample;
+    arb_assert((sc.end_offset-sc.begin_offset)==n_sample*n_raw_per_sample);
+
+    auto& sample_ranges = std::get<std::vector<cable_sample_range>>(scratch);
+    sample_ranges.clear();
+    sample_records.clear();
+
+    for (sample_size_type j = 0; j<n_sample; ++j) {
+        auto offset = j*n_raw_per_sample+sc.begin_offset;
+        sample_ranges.push_back({raw_samples+offset, raw_samples+offset+n_raw_per_sample});
+    }
+
+    const auto& csample_ranges = sample_ranges;
+    for (sample_size_type j = 0; j<n_sample; ++j) {
+        auto offset = j*n_raw_per_sample+sc.begin_offset;
+        sample_records.push_back(sample_record{time_type(raw_times[offset]), &csample_ranges[j]});
+    }
+
+    sc.sampler({sc.probe_id, sc.tag, sc.index, p.get_metadata_ptr()}, n_sample, sample_records.data());
+}
+
 // Generic run_samples dispatches on probe info variant type.
 void run_samples(
     const sampler_call_info& sc,
@@ -504,6 +535,10 @@ void mc_cell_group::remove_all_samplers() {
     sampler_map_.clear();
 }
 
+void mc_cell_group::set_mechanism_parameter(const std::string& mechanism, const std::string& parameter, double value) {
+    lowered_->set_mechanism_parameter(mechanism, parameter, value);
+}
+
 std::vector<probe_metadata> mc_cell_group::get_probe_metadata(cell_member_type probe_id) const {
     // Probe associations are fixed after construction, so we do not need to grab the mutex.
 
@@ -58,6 +58,8 @@ public:
 
     void remove_all_samplers() override;
 
+    void set_mechanism_parameter(const std::string& mechanism, const std::string& parameter, double value) override;
+
     std::vector<probe_metadata> get_probe_metadata(cell_member_type probe_id) const override;
 
 private:
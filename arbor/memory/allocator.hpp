@@ -4,6 +4,7 @@
 
 #include "gpu_wrappers.hpp"
 #include "definitions.hpp"
+#include "huge_pages.hpp"
 #include "util.hpp"
 
 namespace arb {
@@ -52,7 +53,8 @@ namespace impl {
         return remainder ? (alignment - remainder)/sizeof(T) : 0;
     }
 
-    // allocate memory with alignment specified as a template parameter
+    // allocate memory with alignment specified as a template parameter,
+    // backed by huge pages if large enough (see arb::set_huge_page_threshold)
     // returns nullptr on failure
     template <typename T, size_type alignment=minimum_possible_alignment<T>()>
     T* aligned_malloc(size_type size) {
@@ -63,7 +65,7 @@ namespace impl {
         static_assert( is_power_of_two(alignment),
                 "alignment is not a power of two");
         void *ptr;
-        int result = posix_memalign(&ptr, alignment, size*sizeof(T));
+        int result = host_memalign(&ptr, alignment, size*sizeof(T));
         if(result) {
             return nullptr;
         }
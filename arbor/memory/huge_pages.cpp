@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+
+#include <arbor/huge_pages.hpp>
+
+#include "memory/huge_pages.hpp"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace arb {
+
+static std::atomic<std::size_t> huge_page_threshold_{0};
+
+void set_huge_page_threshold(std::size_t threshold) {
+    huge_page_threshold_.store(threshold, std::memory_order_relaxed);
+}
+
+std::size_t huge_page_threshold() {
+    return huge_page_threshold_.load(std::memory_order_relaxed);
+}
+
+namespace memory {
+
+int host_memalign(void** ptr, std::size_t alignment, std::size_t size) noexcept {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    auto threshold = huge_page_threshold();
+    if (threshold && size>=threshold) {
+        std::size_t padded = (size+huge_page_size-1)/huge_page_size*huge_page_size;
+        if (!posix_memalign(ptr, std::max(alignment, huge_page_size), padded)) {
+            // If transparent huge pages are disabled, the advice fails and
+            // the memory is backed by regular pages.
+            madvise(*ptr, padded, MADV_HUGEPAGE);
+            return 0;
+        }
+    }
+#endif
+    return posix_memalign(ptr, alignment, size);
+}
+
+} // namespace memory
+} // namespace arb
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+
+namespace arb {
+namespace memory {
+
+// Allocate size bytes aligned to alignment with posix_memalign(), which it
+// replaces, with the same arguments and return value. If size is at least
+// the huge page threshold (see arb::set_huge_page_threshold), the
+// allocation is aligned and padded to arb::huge_page_size and advised for
+// backing by transparent huge pages. The memory is released with free().
+int host_memalign(void** ptr, std::size_t alignment, std::size_t size) noexcept;
+
+} // namespace memory
+} // namespace arb
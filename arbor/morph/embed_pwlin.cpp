@@ -1,11 +1,17 @@
+#include <atomic>
 #include <cstddef>
+#include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
+#include <arbor/context.hpp>
 #include <arbor/morph/embed_pwlin.hpp>
 #include <arbor/morph/morphology.hpp>
 #include <arbor/morph/primitives.hpp>
 
+#include "execution_context.hpp"
+#include "threading/threading.hpp"
 #include "util/piecewise.hpp"
 #include "util/range.hpp"
 #include "util/rangeutil.hpp"
@@ -19,9 +25,6 @@ using util::rat_element;
 template <unsigned p, unsigned q>
 using pw_ratpoly = util::pw_elements<rat_element<p, q>>;
 
-template <unsigned p, unsigned q>
-using branch_pw_ratpoly = std::vector<pw_ratpoly<p, q>>;
-
 // Special case handling required for degenerate branches of length zero:
 template <typename Elem>
 static bool is_degenerate(const util::pw_elements<Elem>& pw) {
@@ -29,8 +32,7 @@ static bool is_degenerate(const util::pw_elements<Elem>& pw) {
 }
 
 template <unsigned p, unsigned q>
-double interpolate(const branch_pw_ratpoly<p, q>& f, unsigned bid, double pos) {
-    const auto& pw = f.at(bid);
+double interpolate(const pw_ratpoly<p, q>& pw, double pos) {
     if (is_degenerate(pw)) pos = 0;
 
     auto [bounds, element] = pw(pos);
@@ -49,11 +51,11 @@ double interpolate(const branch_pw_ratpoly<p, q>& f, unsigned bid, double pos) {
 // interpolated values at the end points of each constant interval.
 
 template <unsigned p, unsigned q>
-double integrate(const branch_pw_ratpoly<p, q>& f, unsigned bid, const pw_constant_fn& g) {
+double integrate(const pw_ratpoly<p, q>& f, const pw_constant_fn& g) {
     double accum = 0;
     for (msize_t i = 0; i<g.size(); ++i) {
         std::pair<double, double> interval = g.interval(i);
-        accum += g.element(i)*(interpolate(f, bid, interval.second)-interpolate(f, bid, interval.first));
+        accum += g.element(i)*(interpolate(f, interval.second)-interpolate(f, interval.first));
     }
     return accum;
 }
@@ -63,8 +65,7 @@ double integrate(const branch_pw_ratpoly<p, q>& f, unsigned bid, const pw_consta
 // search for a small increase in code complexity.
 
 template <unsigned p, unsigned q>
-double integrate(const branch_pw_ratpoly<p, q>& f, mcable c, const pw_constant_fn& g) {
-    msize_t bid = c.branch;
+double integrate(const pw_ratpoly<p, q>& f, mcable c, const pw_constant_fn& g) {
     double accum = 0;
 
     for (msize_t i = 0; i<g.size(); ++i) {
@@ -81,7 +82,7 @@ double integrate(const branch_pw_ratpoly<p, q>& f, mcable c, const pw_constant_f
             interval.second = std::min(interval.second, c.dist_pos);
 
             if (interval.first<interval.second) {
-                accum += g.element(i)*(interpolate(f, bid, interval.second)-interpolate(f, bid, interval.first));
+                accum += g.element(i)*(interpolate(f, interval.second)-interpolate(f, interval.first));
             }
         }
     }
@@ -89,9 +90,8 @@ double integrate(const branch_pw_ratpoly<p, q>& f, mcable c, const pw_constant_f
 }
 
 template <typename operation>
-mcable_list data_cmp(const branch_pw_ratpoly<1, 0>& f, unsigned bid, double val, operation op) {
+mcable_list data_cmp(const pw_ratpoly<1, 0>& pw, msize_t bid, double val, operation op) {
     mcable_list L;
-    const auto& pw = f.at(bid);
     for (const auto& piece: pw) {
         auto extents = piece.first;
         auto left_val = piece.second(0);
@@ -120,40 +120,241 @@ mcable_list data_cmp(const branch_pw_ratpoly<1, 0>& f, unsigned bid, double val,
     return L;
 }
 
+// The interpolants over each branch are built on first use, after those of
+// the parent branch, which give their values at the start of the branch.
+
 struct embed_pwlin_data {
-    branch_pw_ratpoly<1, 0> length; // [µm]
-    branch_pw_ratpoly<1, 0> directed_projection; // [µm]
-    branch_pw_ratpoly<1, 0> radius; // [µm]
-    branch_pw_ratpoly<2, 0> area; // [µm²]
-    branch_pw_ratpoly<1, 1> ixa;  // [1/µm]
-
-    explicit embed_pwlin_data(msize_t n_branch):
-        length(n_branch),
-        directed_projection(n_branch),
-        radius(n_branch),
-        area(n_branch),
-        ixa(n_branch)
-    {}
+    struct branch_data {
+        pw_ratpoly<1, 0> length; // [µm]
+        pw_ratpoly<1, 0> directed_projection; // [µm]
+        pw_ratpoly<1, 0> radius; // [µm]
+        pw_ratpoly<2, 0> area; // [µm²]
+        pw_ratpoly<1, 1> ixa;  // [1/µm]
+    };
+
+    morphology morph;
+    double proj_shift = 0;
+
+    // Segment ends of branch b are segment_ends[ends_begin[b]] to
+    // segment_ends[ends_begin[b+1]-1].
+    mlocation_list segment_ends;
+    std::vector<std::size_t> ends_begin;
+    std::vector<double> branch_length;  // [µm]
+    std::vector<mcable> segment_cables;
+
+    std::vector<branch_data> branches;
+    std::unique_ptr<std::atomic<bool>[]> built;
+    std::mutex build_mutex;
+
+    explicit embed_pwlin_data(const morphology& m);
+
+    const branch_data& branch(msize_t bid) {
+        if (!built[bid].load(std::memory_order_acquire)) build(bid);
+        return branches[bid];
+    }
+
+    // Build the interpolants of a branch and any of its ancestors that
+    // have not yet been built.
+    void build(msize_t bid);
+
+    // Build the interpolants of every branch, using the threads of ts if not null.
+    void build_all(threading::task_system* ts);
+
+private:
+    void build_branch(msize_t bid);
 };
 
+embed_pwlin_data::embed_pwlin_data(const morphology& m):
+    morph(m),
+    branches(m.num_branches()),
+    built(new std::atomic<bool>[m.num_branches()])
+{
+    msize_t n_branch = m.num_branches();
+    for (msize_t bid = 0; bid<n_branch; ++bid) {
+        built[bid].store(false, std::memory_order_relaxed);
+    }
+    if (!n_branch) return;
+
+    proj_shift = m.branch_segments(0).front().prox.z;
+
+    ends_begin.reserve(n_branch+1);
+    branch_length.reserve(n_branch);
+    for (msize_t bid = 0; bid<n_branch; ++bid) {
+        auto& segments = m.branch_segments(bid);
+        arb_assert(segments.size());
+
+        const auto first = segment_ends.size();
+        ends_begin.push_back(first);
+
+        double length = 0;
+        segment_ends.push_back({bid, 0.});
+        for (const auto &seg: segments) {
+            length += distance(seg.prox, seg.dist);
+            segment_ends.push_back({bid, length});
+        }
+        branch_length.push_back(length);
+
+        if (length!=0) {
+            for (auto i = first; i<segment_ends.size(); ++i) {
+                segment_ends[i].pos /= length;
+            }
+        }
+
+        // Store the cable associated with each segment.
+        for (auto i: util::count_along(segments)) {
+            auto id = segments[i].id;
+            if (id>=segment_cables.size()) {
+                segment_cables.resize(id+1);
+            }
+            segment_cables[id] = mcable{bid, segment_ends[first+i].pos, segment_ends[first+i+1].pos};
+        }
+    }
+    ends_begin.push_back(segment_ends.size());
+}
+
+void embed_pwlin_data::build(msize_t bid) {
+    std::lock_guard<std::mutex> lock(build_mutex);
+
+    std::vector<msize_t> pending;
+    for (auto b = bid; b!=mnpos && !built[b].load(std::memory_order_relaxed); b = morph.branch_parent(b)) {
+        pending.push_back(b);
+    }
+    for (auto b = pending.rbegin(); b!=pending.rend(); ++b) {
+        build_branch(*b);
+        built[*b].store(true, std::memory_order_release);
+    }
+}
+
+void embed_pwlin_data::build_all(threading::task_system* ts) {
+    msize_t n_branch = branches.size();
+
+    // Parent branches have lower indices than their children: group the
+    // branches by depth, and build each level in parallel.
+    std::vector<msize_t> depth(n_branch);
+    msize_t max_depth = 0;
+    for (msize_t bid = 0; bid<n_branch; ++bid) {
+        auto parent = morph.branch_parent(bid);
+        depth[bid] = parent==mnpos? 0: depth[parent]+1;
+        max_depth = std::max(max_depth, depth[bid]);
+    }
+
+    std::vector<std::vector<msize_t>> levels(n_branch? max_depth+1: 0);
+    for (msize_t bid = 0; bid<n_branch; ++bid) {
+        levels[depth[bid]].push_back(bid);
+    }
+
+    for (auto& level: levels) {
+        auto build_one = [&](int i) {
+            auto bid = level[i];
+            if (!built[bid].load(std::memory_order_relaxed)) {
+                build_branch(bid);
+                built[bid].store(true, std::memory_order_release);
+            }
+        };
+
+        if (ts && level.size()>1) {
+            threading::parallel_for::apply(0, level.size(), ts, build_one);
+        }
+        else {
+            for (auto i: util::count_along(level)) build_one(i);
+        }
+    }
+}
+
+void embed_pwlin_data::build_branch(msize_t bid) {
+    constexpr double pi = math::pi<double>;
+
+    auto parent = morph.branch_parent(bid);
+    auto& segments = morph.branch_segments(bid);
+    auto& B = branches[bid];
+
+    const auto n_seg = segments.size();
+    const mlocation* seg_pos = segment_ends.data()+ends_begin[bid];
+    const double length = branch_length[bid];
+
+    const branch_data* P = parent==mnpos? nullptr: &branches[parent];
+
+    double length_0 = P? P->length.back().second[1]: 0;
+    B.length.push_back(0., 1, rat_element<1, 0>(length_0, length_0+length));
+
+    B.directed_projection.reserve(n_seg);
+    B.radius.reserve(n_seg);
+    B.area.reserve(n_seg);
+    B.ixa.reserve(n_seg);
+
+    double area_0 = P? P->area.back().second[2]: 0;
+    double ixa_0 = P? P->ixa.back().second[2]: 0;
+
+    for (std::size_t i = 0; i<n_seg; ++i) {
+        auto prox = segments[i].prox;
+        auto dist = segments[i].dist;
+
+        double p0 = seg_pos[i].pos;
+        double p1 = seg_pos[i+1].pos;
+
+        double z0 = prox.z - proj_shift;
+        double z1 = dist.z - proj_shift;
+        B.directed_projection.push_back(p0, p1, rat_element<1, 0>(z0, z1));
+
+        double r0 = prox.radius;
+        double r1 = dist.radius;
+        B.radius.push_back(p0, p1, rat_element<1, 0>(r0, r1));
+
+        double dx = (p1-p0)*length;
+        double dr = r1-r0;
+        double c = pi*std::sqrt(dr*dr+dx*dx);
+        double area_half = area_0 + (0.75*r0+0.25*r1)*c;
+        double area_1 = area_0 + (r0+r1)*c;
+        B.area.push_back(p0, p1, rat_element<2, 0>(area_0, area_half, area_1));
+        area_0 = area_1;
+
+        // (Test for positive dx explicitly in case r0 is zero.)
+        double ixa_half = ixa_0 + (dx>0? dx/(pi*r0*(r0+r1)): 0);
+        double ixa_1 = ixa_0 + (dx>0? dx/(pi*r0*r1): 0);
+        B.ixa.push_back(p0, p1, rat_element<1, 1>(ixa_0, ixa_half, ixa_1));
+        ixa_0 = ixa_1;
+    }
+
+    arb_assert((B.radius.size()>0));
+    if (length!=0) {
+        arb_assert((B.radius.bounds()==std::pair<double, double>(0., 1.)));
+        arb_assert((B.area.bounds()==std::pair<double, double>(0., 1.)));
+        arb_assert((B.ixa.bounds()==std::pair<double, double>(0., 1.)));
+    }
+}
+
+// Segment queries.
+
+msize_t embed_pwlin::num_segments() const {
+    return data_->segment_cables.size();
+}
+
+mcable embed_pwlin::segment(msize_t seg_id) const {
+    return data_->segment_cables.at(seg_id);
+}
+
+const mlocation_list& embed_pwlin::segment_ends() const {
+    return data_->segment_ends;
+}
+
 double embed_pwlin::radius(mlocation loc) const {
-    return interpolate(data_->radius, loc.branch, loc.pos);
+    return interpolate(data_->branch(loc.branch).radius, loc.pos);
 }
 
 double embed_pwlin::directed_projection(arb::mlocation loc) const {
-    return interpolate(data_->directed_projection, loc.branch, loc.pos);
+    return interpolate(data_->branch(loc.branch).directed_projection, loc.pos);
 }
 
 // Point to point integration:
 
 double embed_pwlin::integrate_length(mlocation proximal, mlocation distal) const {
-    return interpolate(data_->length, distal.branch, distal.pos) -
-           interpolate(data_->length, proximal.branch, proximal.pos);
+    return interpolate(data_->branch(distal.branch).length, distal.pos) -
+           interpolate(data_->branch(proximal.branch).length, proximal.pos);
 }
 
 double embed_pwlin::integrate_area(mlocation proximal, mlocation distal) const {
-    return interpolate(data_->area, distal.branch, distal.pos) -
-           interpolate(data_->area, proximal.branch, proximal.pos);
+    return interpolate(data_->branch(distal.branch).area, distal.pos) -
+           interpolate(data_->branch(proximal.branch).area, proximal.pos);
 }
 
 // Integrate over cable:
@@ -173,144 +374,65 @@ double embed_pwlin::integrate_ixa(mcable c) const {
 // Integrate piecewise function over a branch:
 
 double embed_pwlin::integrate_length(msize_t bid, const pw_constant_fn& g) const {
-    return integrate(data_->length, bid, g);
+    return integrate(data_->branch(bid).length, g);
 }
 
 double embed_pwlin::integrate_area(msize_t bid, const pw_constant_fn& g) const {
-    return integrate(data_->area, bid, g);
+    return integrate(data_->branch(bid).area, g);
 }
 
 double embed_pwlin::integrate_ixa(msize_t bid, const pw_constant_fn& g) const {
-    return integrate(data_->ixa, bid, g);
+    return integrate(data_->branch(bid).ixa, g);
 }
 
 // Integrate piecewise function over a cable:
 
 double embed_pwlin::integrate_length(mcable c, const pw_constant_fn& g) const {
-    return integrate(data_->length, c, g);
+    return integrate(data_->branch(c.branch).length, c, g);
 }
 
 double embed_pwlin::integrate_area(mcable c, const pw_constant_fn& g) const {
-    return integrate(data_->area, c, g);
+    return integrate(data_->branch(c.branch).area, c, g);
 }
 
 double embed_pwlin::integrate_ixa(mcable c, const pw_constant_fn& g) const {
-    return integrate(data_->ixa, c, g);
+    return integrate(data_->branch(c.branch).ixa, c, g);
 }
 
 // Subregions defined by geometric inequalities:
 
 mcable_list embed_pwlin::radius_cmp(msize_t bid, double val, comp_op op) const {
+    const auto& radius = data_->branch(bid).radius;
     switch (op) {
-        case comp_op::lt: return data_cmp(data_->radius, bid, val, [](auto l, auto r){return l <  r;});
-        case comp_op::le: return data_cmp(data_->radius, bid, val, [](auto l, auto r){return l <= r;});
-        case comp_op::gt: return data_cmp(data_->radius, bid, val, [](auto l, auto r){return l >  r;});
-        case comp_op::ge: return data_cmp(data_->radius, bid, val, [](auto l, auto r){return l >= r;});
+        case comp_op::lt: return data_cmp(radius, bid, val, [](auto l, auto r){return l <  r;});
+        case comp_op::le: return data_cmp(radius, bid, val, [](auto l, auto r){return l <= r;});
+        case comp_op::gt: return data_cmp(radius, bid, val, [](auto l, auto r){return l >  r;});
+        case comp_op::ge: return data_cmp(radius, bid, val, [](auto l, auto r){return l >= r;});
         default: return {};
     }
 }
 
 mcable_list embed_pwlin::projection_cmp(msize_t bid, double val, comp_op op) const {
+    const auto& projection = data_->branch(bid).directed_projection;
     switch (op) {
-        case comp_op::lt: return data_cmp(data_->directed_projection, bid, val, [](auto l, auto r){return l <  r;});
-        case comp_op::le: return data_cmp(data_->directed_projection, bid, val, [](auto l, auto r){return l <= r;});
-        case comp_op::gt: return data_cmp(data_->directed_projection, bid, val, [](auto l, auto r){return l >  r;});
-        case comp_op::ge: return data_cmp(data_->directed_projection, bid, val, [](auto l, auto r){return l >= r;});
+        case comp_op::lt: return data_cmp(projection, bid, val, [](auto l, auto r){return l <  r;});
+        case comp_op::le: return data_cmp(projection, bid, val, [](auto l, auto r){return l <= r;});
+        case comp_op::gt: return data_cmp(projection, bid, val, [](auto l, auto r){return l >  r;});
+        case comp_op::ge: return data_cmp(projection, bid, val, [](auto l, auto r){return l >= r;});
         default: return {};
     }
 }
 
 // Initialization, creation of geometric data.
 
-embed_pwlin::embed_pwlin(const arb::morphology& m) {
-    constexpr double pi = math::pi<double>;
-    msize_t n_branch = m.num_branches();
-    data_ = std::make_shared<embed_pwlin_data>(n_branch);
-
-    if (!n_branch) return;
-
-    double proj_shift = m.branch_segments(0).front().prox.z;
+embed_pwlin::embed_pwlin(const arb::morphology& m):
+    data_(std::make_shared<embed_pwlin_data>(m))
+{}
 
-    for (msize_t bid = 0; bid<n_branch; ++bid) {
-        unsigned parent = m.branch_parent(bid);
-        auto& segments = m.branch_segments(bid);
-        arb_assert(segments.size());
-
-        std::vector<double> seg_pos;
-        seg_pos.reserve(segments.size()+1);
-        seg_pos.push_back(0.);
-
-        for (const auto &seg: segments) {
-            double d = distance(seg.prox, seg.dist);
-            seg_pos.push_back(seg_pos.back()+d);
-        }
-
-        double branch_length = seg_pos.back();
-        if (branch_length!=0) {
-            for (auto& d: seg_pos) {
-                d /= branch_length;
-            }
-        }
-
-        for (auto d: seg_pos) {
-            all_segment_ends_.push_back({bid, d});
-        }
-
-        // Second pass over segments to store associated cables.
-        auto pos_iter = seg_pos.begin();
-        for (const auto &seg: segments) {
-            double pos0 = *pos_iter++;
-            double pos1 = *pos_iter;
-
-            if (seg.id>=segment_cables_.size()) {
-                segment_cables_.resize(seg.id+1);
-            }
-            segment_cables_[seg.id] = mcable{bid, pos0, pos1};
-        }
-
-        double length_0 = parent==mnpos? 0: data_->length[parent].back().second[1];
-        data_->length[bid].push_back(0., 1, rat_element<1, 0>(length_0, length_0+branch_length));
-
-        double area_0 = parent==mnpos? 0: data_->area[parent].back().second[2];
-        double ixa_0 = parent==mnpos? 0: data_->ixa[parent].back().second[2];
-
-        for (auto i: util::count_along(segments)) {
-            auto prox = segments[i].prox;
-            auto dist = segments[i].dist;
-
-            double p0 = seg_pos[i];
-            double p1 = seg_pos[i+1];
-
-            double z0 = prox.z - proj_shift;
-            double z1 = dist.z - proj_shift;
-            data_->directed_projection[bid].push_back(p0, p1, rat_element<1, 0>(z0, z1));
-
-            double r0 = prox.radius;
-            double r1 = dist.radius;
-            data_->radius[bid].push_back(p0, p1, rat_element<1, 0>(r0, r1));
-
-            double dx = (p1-p0)*branch_length;
-            double dr = r1-r0;
-            double c = pi*std::sqrt(dr*dr+dx*dx);
-            double area_half = area_0 + (0.75*r0+0.25*r1)*c;
-            double area_1 = area_0 + (r0+r1)*c;
-            data_->area[bid].push_back(p0, p1, rat_element<2, 0>(area_0, area_half, area_1));
-            area_0 = area_1;
-
-            // (Test for positive dx explicitly in case r0 is zero.)
-            double ixa_half = ixa_0 + (dx>0? dx/(pi*r0*(r0+r1)): 0);
-            double ixa_1 = ixa_0 + (dx>0? dx/(pi*r0*r1): 0);
-            data_->ixa[bid].push_back(p0, p1, rat_element<1, 1>(ixa_0, ixa_half, ixa_1));
-            ixa_0 = ixa_1;
-        }
-
-        arb_assert((data_->radius[bid].size()>0));
-        if (branch_length!=0) {
-            arb_assert((data_->radius[bid].bounds()==std::pair<double, double>(0., 1.)));
-            arb_assert((data_->area[bid].bounds()==std::pair<double, double>(0., 1.)));
-            arb_assert((data_->ixa[bid].bounds()==std::pair<double, double>(0., 1.)));
-        }
-    }
-};
+embed_pwlin::embed_pwlin(const arb::morphology& m, const context& ctx):
+    data_(std::make_shared<embed_pwlin_data>(m))
+{
+    data_->build_all(ctx->thread_pool.get());
+}
 
 } // namespace arb
@@ -1,5 +1,12 @@
 #include <any>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <arbor/arbexcept.hpp>
 #include <arbor/morph/region.hpp>
@@ -256,21 +263,44 @@ std::unordered_multimap<std::string, evaluator> eval_map {
                             "'sum' with at least 2 arguments: (locset locset [...locset])")},
 };
 
-parse_hopefully<std::any> eval(const s_expr& e);
+using eval_range = decltype(eval_map.equal_range(std::string()));
 
-parse_hopefully<std::vector<std::any>> eval_args(const s_expr& e) {
-    if (!e) return {std::vector<std::any>{}}; // empty argument list
-    std::vector<std::any> args;
-    for (auto& h: e) {
-        if (auto arg=eval(h)) {
-            args.push_back(std::move(*arg));
+// Evaluation of the expressions in an s_expr_tree.
+// The candidate functions for each symbol are looked up once per tree.
+struct tree_eval {
+    using index_type = s_expr_tree::index_type;
+
+    const s_expr_tree& tree;
+    std::vector<std::optional<eval_range>> candidates; // by symbol id
+
+    tree_eval(const s_expr_tree& tree):
+        tree(tree), candidates(tree.symbols.size())
+    {}
+
+    eval_range functions(const s_expr_tree::node& n) {
+        if (n.symbol==s_expr_tree::npos) {
+            return eval_map.equal_range(std::string(n.spelling));
         }
-        else {
-            return util::unexpected(std::move(arg.error()));
+        auto& c = candidates[n.symbol];
+        if (!c) c = eval_map.equal_range(std::string(n.spelling));
+        return *c;
+    }
+
+    parse_hopefully<std::any> eval(index_type i);
+
+    parse_hopefully<std::vector<std::any>> eval_args(index_type first) {
+        std::vector<std::any> args;
+        for (auto j = first; j!=s_expr_tree::npos; j = tree[j].next) {
+            if (auto arg=eval(j)) {
+                args.push_back(std::move(*arg));
+            }
+            else {
+                return util::unexpected(std::move(arg.error()));
+            }
         }
+        return args;
     }
-    return args;
-}
+};
 
 // Generate a string description of a function evaluation of the form:
 // Example output:
@@ -309,6 +339,25 @@ std::string eval_description(const char* name, const std::vector<std::any>& args
 label_parse_error parse_error(std::string const& msg, src_location loc) {
     return {util::pprintf("error in label description at {}: {}.", loc, msg)};
 }
+// The value of a numeric atom, whose spelling is not null terminated.
+std::optional<int> to_int(std::string_view s) {
+    if (!s.empty() && s.front()=='+') s.remove_prefix(1);
+    int value;
+    auto [end, err] = std::from_chars(s.data(), s.data()+s.size(), value);
+    if (err!=std::errc() || end!=s.data()+s.size()) return std::nullopt;
+    return value;
+}
+
+double to_double(std::string_view s) {
+    char buf[64];
+    if (s.size()<sizeof(buf)) {
+        std::memcpy(buf, s.data(), s.size());
+        buf[s.size()] = 0;
+        return std::strtod(buf, nullptr);
+    }
+    return std::stod(std::string(s));
+}
+
 // Evaluate an s expression.
 // On success the result is wrapped in std::any, where the result is one of:
 //      int         : an integer atom
@@ -321,73 +370,80 @@ label_parse_error parse_error(std::string const& msg, src_location loc) {
 // a label_error_state with an error string and location.
 //
 // If there was an unexpected/fatal error, an exception will be thrown.
-parse_hopefully<std::any> eval(const s_expr& e) {
-    if (e.is_atom()) {
-        auto& t = e.atom();
-        switch (t.kind) {
+parse_hopefully<std::any> tree_eval::eval(index_type i) {
+    auto& e = tree[i];
+    if (e.kind!=tok::lparen) {
+        switch (e.kind) {
             case tok::integer:
-                return {std::stoi(t.spelling)};
+                if (auto v = to_int(e.spelling)) return {*v};
+                return util::unexpected(parse_error(
+                        util::pprintf("Integer '{}' is out of range", e.spelling),
+                        e.loc));
             case tok::real:
-                return {std::stod(t.spelling)};
+                return {to_double(e.spelling)};
             case tok::nil:
                 return {nil_tag()};
             case tok::string:
-                return std::any{std::string(t.spelling)};
+                return std::any{std::string(e.spelling)};
             // An arbitrary symbol in a region/locset expression is an error, and is
             // often a result of not quoting a label correctly.
             case tok::symbol:
                 return util::unexpected(parse_error(
-                        util::pprintf("Unexpected symbol '{}' in a region or locset definition. If '{}' is a label, it must be quoted {}{}{}", e, e, '"', e, '"'),
-                        location(e)));
+                        util::pprintf("Unexpected symbol '{}' in a region or locset definition. If '{}' is a label, it must be quoted {}{}{}", e.spelling, e.spelling, '"', e.spelling, '"'),
+                        e.loc));
             case tok::error:
-                return util::unexpected(parse_error(e.atom().spelling, location(e)));
+                return util::unexpected(parse_error(std::string(e.spelling), e.loc));
             default:
-                return util::unexpected(parse_error(util::pprintf("Unexpected term '{}' in a region or locset definition", e), location(e)));
+                return util::unexpected(parse_error(util::pprintf("Unexpected term '{}' in a region or locset definition", e.spelling), e.loc));
         }
     }
-    if (e.head().is_atom()) {
+    auto& head = tree[e.first];
+    if (head.kind!=tok::lparen) {
         // This must be a function evaluation, where head is the function name, and
         // tail is a list of arguments.
 
         // Evaluate the arguments, and return error state if an error ocurred.
-        auto args = eval_args(e.tail());
+        auto args = eval_args(head.next);
         if (!args) {
             return args.error();
         }
 
         // Find all candidate functions that match the name of the function.
-        auto& name = e.head().atom().spelling;
-        auto matches = eval_map.equal_range(name);
+        auto matches = functions(head);
 
         // Search for a candidate that matches the argument list.
         for (auto i=matches.first; i!=matches.second; ++i) {
             if (i->second.match_args(*args)) { // found a match: evaluate and return.
-                return i->second.eval(*args);
+                return i->second.eval(std::move(*args));
             }
         }
 
         // Unable to find a match: try to return a helpful error message.
         const auto nc = std::distance(matches.first, matches.second);
-        auto msg = util::pprintf("No matches for {}", eval_description(name.c_str(), *args));
+        auto msg = util::pprintf("No matches for {}", eval_description(std::string(head.spelling).c_str(), *args));
         msg += util::pprintf("\n  There are {} potential candiates{}", nc, nc?":":".");
         int count = 0;
         for (auto i=matches.first; i!=matches.second; ++i) {
             msg += util::pprintf("\n  Candidate {}  {}", ++count, i->second.message);
         }
-        return util::unexpected(parse_error(msg, location(e)));
+        return util::unexpected(parse_error(msg, head.loc));
     }
 
     return util::unexpected(parse_error(
-            util::pprintf("'{}' is not either integer, real expression of the form (op <args>)", e),
-            location(e)));
+            util::pprintf("'{}' is not either integer, real expression of the form (op <args>)", tree.to_s_expr(i)),
+            tree.location(i)));
+}
+
+parse_hopefully<std::any> eval(const s_expr_tree& tree) {
+    return tree_eval(tree).eval(tree.roots.front());
 }
 
 parse_hopefully<std::any> parse_label_expression(const std::string& e) {
-    return eval(parse_s_expr(e));
+    return eval(parse_s_expr_tree(e));
 }
 
 parse_hopefully<arb::region> parse_region_expression(const std::string& s) {
-    if (auto e = eval(parse_s_expr(s))) {
+    if (auto e = eval(parse_s_expr_tree(s))) {
         if (e->type() == typeid(region)) {
             return {std::move(std::any_cast<region&>(*e))};
         }
@@ -404,7 +460,7 @@ parse_hopefully<arb::region> parse_region_expression(const std::string& s) {
 }
 
 parse_hopefully<arb::locset> parse_locset_expression(const std::string& s) {
-    if (auto e = eval(parse_s_expr(s))) {
+    if (auto e = eval(parse_s_expr_tree(s))) {
         if (e->type() == typeid(locset)) {
             return {std::move(std::any_cast<locset&>(*e))};
         }
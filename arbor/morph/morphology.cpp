@@ -47,21 +47,26 @@ auto branches_from_segment_tree(const segment_tree& tree) {
         }
     }
 
-    // A working vector used to track whether the first segment in a branch has been visited.
-    std::vector<char> visited(nbranches);
-
-    branch_segs.resize(nbranches);
+    // Count the segments in each branch, so that the branches can be
+    // filled without reallocation, and set the parent of each branch
+    // from its first segment.
+    std::vector<msize_t> counts(nbranches);
     branch_parents.resize(nbranches);
-    // Construct all of the cable segments for all of the branches.
     for (auto i: make_span(nsegs)) {
         auto p = seg_parents[i];
         auto b = bids[i];
-        // If this is the first sample in the branch, set the branch's parent branch.
-        if (!visited[b]) {
+        if (!counts[b]++) {
             branch_parents[b] = p==mnpos? mnpos: bids[p];
-            visited[b] = 1;
         }
-        branch_segs[b].push_back(segs[i]);
+    }
+
+    // Construct all of the cable segments for all of the branches.
+    branch_segs.resize(nbranches);
+    for (auto b: make_span(nbranches)) {
+        branch_segs[b].reserve(counts[b]);
+    }
+    for (auto i: make_span(nsegs)) {
+        branch_segs[bids[i]].push_back(segs[i]);
     }
 
     return branches;
@@ -139,8 +144,8 @@ std::ostream& operator<<(std::ostream& o, const morphology_impl& m) {
 // morphology implementation
 //
 
-morphology::morphology(segment_tree m):
-    impl_(std::make_shared<const morphology_impl>(std::move(m)))
+morphology::morphology(const segment_tree& m):
+    impl_(std::make_shared<const morphology_impl>(m))
 {}
 
 morphology::morphology():
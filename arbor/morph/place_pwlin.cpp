@@ -67,9 +67,9 @@ std::vector<mpoint> place_pwlin::all_at(mlocation loc) const {
     return result;
 }
 
-template <bool exclude_trivial>
-static std::vector<msegment> extent_segments_impl(const place_pwlin_data& data, const mextent& extent) {
-    std::vector<msegment> result;
+// Call out(cable, segment) for each segment or part segment covering extent.
+template <bool exclude_trivial, typename Out>
+static void extent_segments_impl(const place_pwlin_data& data, const mextent& extent, Out&& out) {
 
     for (mcable c: extent) {
         const auto& pw_index = data.segment_index.at(c.branch);
@@ -102,7 +102,7 @@ static std::vector<msegment> extent_segments_impl(const place_pwlin_data& data,
                 continue;
             }
 
-            result.push_back(partial);
+            out(mcable{c.branch, partial_bounds.first, partial_bounds.second}, partial);
 
             // With exclude_trivial set, keep only one zero-length (partial) segment if cable is trivial.
             if (exclude_trivial && c.prox_pos==c.dist_pos) {
@@ -110,16 +110,35 @@ static std::vector<msegment> extent_segments_impl(const place_pwlin_data& data,
             }
         }
     }
-
-    return result;
 }
 
 std::vector<msegment> place_pwlin::all_segments(const mextent& extent) const {
-    return extent_segments_impl<false>(*data_, extent);
+    std::vector<msegment> result;
+    extent_segments_impl<false>(*data_, extent, [&](const mcable&, const msegment& s) { result.push_back(s); });
+    return result;
 }
 
 std::vector<msegment> place_pwlin::segments(const mextent& extent) const {
-    return extent_segments_impl<true>(*data_, extent);
+    std::vector<msegment> result;
+    extent_segments_impl<true>(*data_, extent, [&](const mcable&, const msegment& s) { result.push_back(s); });
+    return result;
+}
+
+std::vector<std::pair<mcable, msegment>> place_pwlin::segment_cables(const mextent& extent) const {
+    std::vector<std::pair<mcable, msegment>> result;
+    extent_segments_impl<true>(*data_, extent, [&](const mcable& c, const msegment& s) { result.push_back({c, s}); });
+    return result;
+}
+
+std::vector<std::pair<mcable, msegment>> place_pwlin::segment_cables() const {
+    std::vector<std::pair<mcable, msegment>> result;
+    result.reserve(data_->segments.size());
+    for (auto bid: util::count_along(data_->segment_index)) {
+        for (auto [bounds, index]: data_->segment_index[bid]) {
+            result.push_back({mcable{msize_t(bid), bounds.first, bounds.second}, data_->segments[index]});
+        }
+    }
+    return result;
 }
 
 place_pwlin::place_pwlin(const arb::morphology& m, const isometry& iso) {
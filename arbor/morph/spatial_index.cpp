@@ -0,0 +1,453 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <arbor/context.hpp>
+#include <arbor/morph/morphexcept.hpp>
+#include <arbor/morph/morphology.hpp>
+#include <arbor/morph/place_pwlin.hpp>
+#include <arbor/morph/primitives.hpp>
+#include <arbor/morph/spatial_index.hpp>
+
+#include "execution_context.hpp"
+#include "threading/threading.hpp"
+#include "util/span.hpp"
+
+// The index is a bounding volume hierarchy over segments sorted along a
+// Morton (Z-order) curve through their midpoints. Consecutive runs of
+// leaf_size segments form the leaves, stored as structures of arrays so that
+// the distance tests within a leaf vectorise; the tree above is built by
+// merging pairs of adjacent boxes, level by level.
+
+namespace arb {
+
+namespace {
+
+constexpr unsigned leaf_size = 8;
+
+struct box {
+    double lo[3] = {INFINITY, INFINITY, INFINITY};
+    double hi[3] = {-INFINITY, -INFINITY, -INFINITY};
+
+    void extend(const box& b) {
+        for (int k = 0; k<3; ++k) {
+            lo[k] = std::min(lo[k], b.lo[k]);
+            hi[k] = std::max(hi[k], b.hi[k]);
+        }
+    }
+
+    void extend(double x, double y, double z) {
+        lo[0] = std::min(lo[0], x); hi[0] = std::max(hi[0], x);
+        lo[1] = std::min(lo[1], y); hi[1] = std::max(hi[1], y);
+        lo[2] = std::min(lo[2], z); hi[2] = std::max(hi[2], z);
+    }
+};
+
+double distance2(const box& b, const mpoint& p) {
+    double q[3] = {p.x, p.y, p.z};
+    double d2 = 0;
+    for (int k = 0; k<3; ++k) {
+        double g = std::max({0., b.lo[k]-q[k], q[k]-b.hi[k]});
+        d2 += g*g;
+    }
+    return d2;
+}
+
+double distance2(const box& a, const box& b) {
+    double d2 = 0;
+    for (int k = 0; k<3; ++k) {
+        double g = std::max({0., b.lo[k]-a.hi[k], a.lo[k]-b.hi[k]});
+        d2 += g*g;
+    }
+    return d2;
+}
+
+double clamp01(double x) {
+    return std::min(1., std::max(0., x));
+}
+
+// Run f(begin, end) over blocks partitioning [0, n), in parallel if a
+// task system is given.
+template <typename F>
+void for_blocks(threading::task_system* ts, std::size_t n, std::size_t grain, F&& f) {
+    std::size_t n_block = ts? std::min<std::size_t>((n+grain-1)/grain, 4*ts->get_num_threads()): 1;
+    if (n_block<=1) {
+        f(std::size_t(0), n);
+        return;
+    }
+
+    threading::parallel_for::apply(0, n_block, ts,
+        [&](int i) { f(n*i/n_block, n*(i+1)/n_block); });
+}
+
+// Spread the low 21 bits of x so that there are two zero bits between each.
+std::uint64_t spread_bits(std::uint64_t x) {
+    x &= 0x1fffff;
+    x = (x|x<<32) & 0x1f00000000ffff;
+    x = (x|x<<16) & 0x1f0000ff0000ff;
+    x = (x|x<<8)  & 0x100f00f00f00f00f;
+    x = (x|x<<4)  & 0x10c30c30c30c30c3;
+    x = (x|x<<2)  & 0x1249249249249249;
+    return x;
+}
+
+} // anonymous namespace
+
+struct spatial_index_data {
+    // Segment axes in leaf order, from the proximal point p to p+d. The
+    // arrays are padded to a whole number of leaves.
+    std::vector<double> px, py, pz, dx, dy, dz;
+    std::vector<std::size_t> item;
+    std::vector<mcable> cable;
+    std::size_t size = 0;
+
+    // Bounding boxes by level; levels[0] holds the leaves, levels.back()
+    // the root.
+    std::vector<std::vector<box>> levels;
+
+    indexed_location location(std::size_t i, double t, double distance) const {
+        const mcable& c = cable[i];
+        return {item[i], mlocation{c.branch, c.prox_pos+t*(c.dist_pos-c.prox_pos)}, distance};
+    }
+
+    // Squared distance from q to each segment in leaf, with the position t
+    // of the closest point along the segment axis.
+    void leaf_distance2(std::size_t leaf, const mpoint& q, double* d2, double* t) const {
+        const std::size_t o = leaf*leaf_size;
+        for (unsigned i = 0; i<leaf_size; ++i) {
+            double rx = q.x-px[o+i], ry = q.y-py[o+i], rz = q.z-pz[o+i];
+            double dd = dx[o+i]*dx[o+i]+dy[o+i]*dy[o+i]+dz[o+i]*dz[o+i];
+            double u = dd>0? clamp01((rx*dx[o+i]+ry*dy[o+i]+rz*dz[o+i])/dd): 0.;
+            rx -= u*dx[o+i];
+            ry -= u*dy[o+i];
+            rz -= u*dz[o+i];
+            d2[i] = rx*rx+ry*ry+rz*rz;
+            t[i] = u;
+        }
+    }
+
+    // Squared distances between segment j of other and each segment in leaf,
+    // with the positions s and t of the closest points along the two axes.
+    void leaf_distance2(std::size_t leaf, const spatial_index_data& other, std::size_t j, double* d2, double* s, double* t) const {
+        const std::size_t o = leaf*leaf_size;
+        const double qx = other.px[j], qy = other.py[j], qz = other.pz[j];
+        const double ex = other.dx[j], ey = other.dy[j], ez = other.dz[j];
+        const double e = ex*ex+ey*ey+ez*ez;
+
+        for (unsigned i = 0; i<leaf_size; ++i) {
+            double rx = px[o+i]-qx, ry = py[o+i]-qy, rz = pz[o+i]-qz;
+            double a = dx[o+i]*dx[o+i]+dy[o+i]*dy[o+i]+dz[o+i]*dz[o+i];
+            double b = dx[o+i]*ex+dy[o+i]*ey+dz[o+i]*ez;
+            double c = dx[o+i]*rx+dy[o+i]*ry+dz[o+i]*rz;
+            double f = ex*rx+ey*ry+ez*rz;
+            double denom = a*e-b*b;
+
+            // Closest points of the lines, clamped to the segments: see
+            // Ericson, Real-Time Collision Detection, §5.1.9.
+            double si_lo = a>0? clamp01(-c/a): 0.;
+            double si_hi = a>0? clamp01((b-c)/a): 0.;
+            double si = denom>0? clamp01((b*f-c*e)/denom): e>0? 0.: si_lo;
+            double ti = e>0? (b*si+f)/e: 0.;
+            si = ti<0? si_lo: ti>1? si_hi: si;
+            ti = clamp01(ti);
+
+            rx += si*dx[o+i]-ti*ex;
+            ry += si*dy[o+i]-ti*ey;
+            rz += si*dz[o+i]-ti*ez;
+            d2[i] = rx*rx+ry*ry+rz*rz;
+            s[i] = si;
+            t[i] = ti;
+        }
+    }
+
+    spatial_index_data(const std::vector<place_pwlin>& placements, const std::vector<mextent>* extents, threading::task_system* ts);
+};
+
+spatial_index_data::spatial_index_data(const std::vector<place_pwlin>& placements, const std::vector<mextent>* extents, threading::task_system* ts) {
+    if (extents && extents->size()!=placements.size()) {
+        throw morphology_error("spatial_index: number of extents differs from number of placements");
+    }
+
+    // Collect the placed segments of each morphology.
+
+    const std::size_t n_item = placements.size();
+    std::vector<std::vector<std::pair<mcable, msegment>>> parts(n_item);
+    for_blocks(ts, n_item, 16,
+        [&](std::size_t b, std::size_t e) {
+            for (auto i: util::make_span(b, e)) {
+                parts[i] = extents? placements[i].segment_cables((*extents)[i]): placements[i].segment_cables();
+            }
+        });
+
+    std::vector<std::size_t> offset = {0};
+    for (auto& p: parts) {
+        offset.push_back(offset.back()+p.size());
+    }
+    size = offset.back();
+    if (!size) return;
+
+    auto segment = [&](std::size_t k) -> const std::pair<mcable, msegment>& {
+        std::size_t i = std::upper_bound(offset.begin(), offset.end(), k)-offset.begin()-1;
+        return parts[i][k-offset[i]];
+    };
+
+    // Sort segments by the Morton code of their midpoints, quantised to 21
+    // bits per axis over the bounding box of all midpoints.
+
+    box centres;
+    for (auto& p: parts) {
+        for (auto& [c, seg]: p) {
+            centres.extend(0.5*(seg.prox.x+seg.dist.x), 0.5*(seg.prox.y+seg.dist.y), 0.5*(seg.prox.z+seg.dist.z));
+        }
+    }
+
+    double scale[3];
+    for (int k = 0; k<3; ++k) {
+        double w = centres.hi[k]-centres.lo[k];
+        scale[k] = w>0? ((1<<21)-1)/w: 0;
+    }
+
+    std::vector<std::pair<std::uint64_t, std::size_t>> order(size);
+    for_blocks(ts, n_item, 16,
+        [&](std::size_t b, std::size_t e) {
+            for (auto i: util::make_span(b, e)) {
+                for (auto j: util::count_along(parts[i])) {
+                    const msegment& seg = parts[i][j].second;
+                    double x[3] = {
+                        0.5*(seg.prox.x+seg.dist.x),
+                        0.5*(seg.prox.y+seg.dist.y),
+                        0.5*(seg.prox.z+seg.dist.z)};
+
+                    std::uint64_t code = 0;
+                    for (int k = 0; k<3; ++k) {
+                        code |= spread_bits(std::uint64_t((x[k]-centres.lo[k])*scale[k]))<<k;
+                    }
+                    order[offset[i]+j] = {code, offset[i]+j};
+                }
+            }
+        });
+
+    // Sort runs in parallel, then merge adjacent sorted runs pairwise.
+    {
+        const std::size_t n_run = ts? std::min<std::size_t>((size+4095)/4096, 4*ts->get_num_threads()): 1;
+        std::vector<std::size_t> runs;
+        for (auto i: util::make_span(n_run+1)) {
+            runs.push_back(size*i/n_run);
+        }
+
+        for_blocks(ts, n_run, 1,
+            [&](std::size_t b, std::size_t e) {
+                for (auto i: util::make_span(b, e)) {
+                    std::sort(order.begin()+runs[i], order.begin()+runs[i+1]);
+                }
+            });
+
+        while (runs.size()>2) {
+            std::size_t n_merge = (runs.size()-1)/2;
+            threading::parallel_for::apply(0, n_merge, ts,
+                [&](int i) {
+                    std::inplace_merge(order.begin()+runs[2*i], order.begin()+runs[2*i+1], order.begin()+runs[2*i+2]);
+                });
+
+            std::vector<std::size_t> merged;
+            for (std::size_t i = 0; i<runs.size(); i += 2) {
+                merged.push_back(runs[i]);
+            }
+            if (merged.back()!=size) merged.push_back(size);
+            runs = std::move(merged);
+        }
+    }
+
+    // Fill the leaves, padding the last with copies of the final segment.
+
+    const std::size_t n_leaf = (size+leaf_size-1)/leaf_size;
+    const std::size_t padded = n_leaf*leaf_size;
+    for (auto v: {&px, &py, &pz, &dx, &dy, &dz}) {
+        v->resize(padded);
+    }
+    item.resize(padded);
+    cable.resize(padded);
+
+    for_blocks(ts, padded, 4096,
+        [&](std::size_t b, std::size_t e) {
+            for (auto k: util::make_span(b, e)) {
+                auto src = order[std::min(k, size-1)].second;
+                auto& [c, seg] = segment(src);
+                px[k] = seg.prox.x;
+                py[k] = seg.prox.y;
+                pz[k] = seg.prox.z;
+                dx[k] = seg.dist.x-seg.prox.x;
+                dy[k] = seg.dist.y-seg.prox.y;
+                dz[k] = seg.dist.z-seg.prox.z;
+                item[k] = std::upper_bound(offset.begin(), offset.end(), src)-offset.begin()-1;
+                cable[k] = c;
+            }
+        });
+
+    // Build the tree bottom up.
+
+    levels.emplace_back(n_leaf);
+    for_blocks(ts, n_leaf, 512,
+        [&](std::size_t b, std::size_t e) {
+            for (auto l: util::make_span(b, e)) {
+                box& bx = levels[0][l];
+                for (auto k: util::make_span(l*leaf_size, (l+1)*leaf_size)) {
+                    bx.extend(px[k], py[k], pz[k]);
+                    bx.extend(px[k]+dx[k], py[k]+dy[k], pz[k]+dz[k]);
+                }
+            }
+        });
+
+    while (levels.back().size()>1) {
+        const auto& below = levels.back();
+        std::vector<box> above((below.size()+1)/2);
+        for_blocks(ts, above.size(), 1024,
+            [&](std::size_t b, std::size_t e) {
+                for (auto i: util::make_span(b, e)) {
+                    above[i] = below[2*i];
+                    if (2*i+1<below.size()) above[i].extend(below[2*i+1]);
+                }
+            });
+        levels.push_back(std::move(above));
+    }
+}
+
+spatial_index::spatial_index(const std::vector<place_pwlin>& placements):
+    data_(std::make_shared<spatial_index_data>(placements, nullptr, nullptr))
+{}
+
+spatial_index::spatial_index(const std::vector<place_pwlin>& placements, const std::vector<mextent>& extents):
+    data_(std::make_shared<spatial_index_data>(placements, &extents, nullptr))
+{}
+
+spatial_index::spatial_index(const std::vector<place_pwlin>& placements, const context& ctx):
+    data_(std::make_shared<spatial_index_data>(placements, nullptr, ctx->thread_pool.get()))
+{}
+
+spatial_index::spatial_index(const std::vector<place_pwlin>& placements, const std::vector<mextent>& extents, const context& ctx):
+    data_(std::make_shared<spatial_index_data>(placements, &extents, ctx->thread_pool.get()))
+{}
+
+std::size_t spatial_index::size() const {
+    return data_->size;
+}
+
+std::vector<indexed_location> spatial_index::within(const mpoint& p, double r) const {
+    const auto& D = *data_;
+    std::vector<indexed_location> result;
+    if (!D.size) return result;
+
+    const double r2 = r*r;
+    std::vector<std::pair<unsigned, std::size_t>> stack = {{unsigned(D.levels.size()-1), 0}};
+    while (!stack.empty()) {
+        auto [level, i] = stack.back();
+        stack.pop_back();
+        if (distance2(D.levels[level][i], p)>r2) continue;
+
+        if (level) {
+            for (auto c: {2*i, 2*i+1}) {
+                if (c<D.levels[level-1].size()) stack.push_back({level-1, c});
+            }
+        }
+        else {
+            double d2[leaf_size], t[leaf_size];
+            D.leaf_distance2(i, p, d2, t);
+            for (unsigned k = 0; k<leaf_size && i*leaf_size+k<D.size; ++k) {
+                if (d2[k]<=r2) result.push_back(D.location(i*leaf_size+k, t[k], std::sqrt(d2[k])));
+            }
+        }
+    }
+    return result;
+}
+
+std::optional<indexed_location> spatial_index::nearest(const mpoint& p) const {
+    const auto& D = *data_;
+    if (!D.size) return std::nullopt;
+
+    double best2 = INFINITY;
+    std::size_t best = 0;
+    double best_t = 0;
+
+    std::vector<std::pair<unsigned, std::size_t>> stack = {{unsigned(D.levels.size()-1), 0}};
+    while (!stack.empty()) {
+        auto [level, i] = stack.back();
+        stack.pop_back();
+        if (distance2(D.levels[level][i], p)>=best2) continue;
+
+        if (level) {
+            // Visit the nearer child first.
+            const auto& below = D.levels[level-1];
+            std::size_t c0 = 2*i, c1 = 2*i+1;
+            if (c1>=below.size()) {
+                stack.push_back({level-1, c0});
+            }
+            else {
+                if (distance2(below[c0], p)<distance2(below[c1], p)) std::swap(c0, c1);
+                stack.push_back({level-1, c0});
+                stack.push_back({level-1, c1});
+            }
+        }
+        else {
+            double d2[leaf_size], t[leaf_size];
+            D.leaf_distance2(i, p, d2, t);
+            for (unsigned k = 0; k<leaf_size && i*leaf_size+k<D.size; ++k) {
+                if (d2[k]<best2) {
+                    best2 = d2[k];
+                    best = i*leaf_size+k;
+                    best_t = t[k];
+                }
+            }
+        }
+    }
+    return D.location(best, best_t, std::sqrt(best2));
+}
+
+std::vector<indexed_location_pair> spatial_index::within(const spatial_index& other, double r) const {
+    const auto& A = *data_;
+    const auto& B = *other.data_;
+    std::vector<indexed_location_pair> result;
+    if (!A.size || !B.size) return result;
+
+    // Traverse both trees together, descending first in the one further
+    // from its leaves.
+    struct node_pair { unsigned la; std::size_t a; unsigned lb; std::size_t b; };
+
+    const double r2 = r*r;
+    std::vector<node_pair> stack = {{unsigned(A.levels.size()-1), 0, unsigned(B.levels.size()-1), 0}};
+    while (!stack.empty()) {
+        auto [la, a, lb, b] = stack.back();
+        stack.pop_back();
+        if (distance2(A.levels[la][a], B.levels[lb][b])>r2) continue;
+
+        if (la && la>=lb) {
+            for (auto c: {2*a, 2*a+1}) {
+                if (c<A.levels[la-1].size()) stack.push_back({la-1, c, lb, b});
+            }
+        }
+        else if (lb) {
+            for (auto c: {2*b, 2*b+1}) {
+                if (c<B.levels[lb-1].size()) stack.push_back({la, a, lb-1, c});
+            }
+        }
+        else {
+            double d2[leaf_size], s[leaf_size], t[leaf_size];
+            for (std::size_t j = b*leaf_size; j<std::min((b+1)*leaf_size, B.size); ++j) {
+                A.leaf_distance2(a, B, j, d2, s, t);
+                for (unsigned k = 0; k<leaf_size && a*leaf_size+k<A.size; ++k) {
+                    if (d2[k]<=r2) {
+                        double d = std::sqrt(d2[k]);
+                        result.push_back({A.location(a*leaf_size+k, s[k], d), B.location(j, t[k], d)});
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace arb
@@ -146,14 +146,10 @@ domain_decomposition partition_load_balance(
 
     // Create a flat vector of the cell kinds present on this node,
     // partitioned such that kinds for which GPU implementation are
-    // listed before the others. This is a very primitive attempt at
-    // scheduling; the cell_groups that run on the GPU will be executed
-    // before other cell_groups, which is likely to be more efficient.
-    //
-    // TODO: This creates an dependency between the load balancer and
-    // the threading internals. We need support for setting the priority
-    // of cell group updates according to rules such as the back end on
-    // which the cell group is running.
+    // listed before the others. The cell_groups that run on the GPU will
+    // then be started before other cell_groups in the first epoch of a
+    // simulation, which is likely to be more efficient; in later epochs,
+    // the simulation starts groups in order of their measured advance time.
 
     auto has_gpu_backend = [&ctx](cell_kind c) {
         return cell_kind_supported(c, backend_kind::gpu, *ctx);
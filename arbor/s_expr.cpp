@@ -1,6 +1,7 @@
 #include <cctype>
 #include <cstring>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <unordered_map>
 #include <ostream>
@@ -340,6 +341,186 @@ private:
     }
 };
 
+// Lexer over a contiguous input, with the same tokens as lexer, whose
+// spellings are views of the input instead of copies.
+
+struct view_token {
+    src_location loc;
+    tok kind;
+    std::string_view spelling;
+};
+
+std::ostream& operator<<(std::ostream& o, const view_token& t) {
+    if (t.kind==tok::string) {
+        return o << util::pprintf("\"{}\"", t.spelling);
+    }
+    return o << util::pprintf("{}", t.spelling);
+}
+
+class view_lexer {
+    const char* pos_;
+    const char* end_;
+    const char* line_start_;
+    unsigned line_ = 0;
+    view_token token_;
+    std::string message_; // Storage for the spelling of an error token.
+
+public:
+
+    view_lexer(std::string_view in):
+        pos_(in.data()), end_(in.data()+in.size()), line_start_(pos_)
+    {
+        parse();
+    }
+
+    const view_token& current() const {
+        return token_;
+    }
+
+    const view_token& next() {
+        parse();
+        return token_;
+    }
+
+private:
+
+    src_location loc() const {
+        return src_location(line_+1, pos_-line_start_+1);
+    }
+
+    // The character i places ahead, or '\0' past the end of the input.
+    char peek(unsigned i=0) const {
+        return i<unsigned(end_-pos_)? pos_[i]: '\0';
+    }
+
+    static bool is_digit(char c) {
+        return c>='0' && c<='9';
+    }
+
+    view_token error(src_location l, std::string msg) {
+        message_ = std::move(msg);
+        return {l, tok::error, message_};
+    }
+
+    view_token spelled(src_location l, tok kind, const char* begin) const {
+        return {l, kind, std::string_view(begin, pos_-begin)};
+    }
+
+    void parse() {
+        while (char c = peek()) {
+            switch (c) {
+                case '\n':
+                    line_++;
+                    line_start_ = ++pos_;
+                    continue;
+                case ' ':
+                case '\t':
+                case '\v':
+                case '\f':
+                    ++pos_;
+                    continue;
+                case ';':
+                    while (peek() && peek()!='\n') ++pos_;
+                    continue;
+                case '(':
+                    token_ = {loc(), tok::lparen, std::string_view(pos_++, 1)};
+                    return;
+                case ')':
+                    token_ = {loc(), tok::rparen, std::string_view(pos_++, 1)};
+                    return;
+                case 'a' ... 'z':
+                case 'A' ... 'Z':
+                    token_ = symbol();
+                    return;
+                case '0' ... '9':
+                    token_ = number();
+                    return;
+                case '"':
+                    token_ = string();
+                    return;
+                case '-':
+                case '+':
+                case '.':
+                    if (is_digit(peek(1)) || peek(1)=='.') {
+                        token_ = number();
+                        return;
+                    }
+                    [[fallthrough]];
+                default: {
+                    auto l = loc();
+                    token_ = error(l, util::pprintf("Unexpected character '{}'.", *pos_++));
+                    return;
+                }
+            }
+        }
+        token_ = {loc(), tok::eof, "eof"};
+    }
+
+    // See lexer::symbol.
+    view_token symbol() {
+        auto start = loc();
+        auto begin = pos_++;
+        while (is_valid_symbol_char(peek())) ++pos_;
+
+        auto t = spelled(start, tok::symbol, begin);
+        if (t.spelling=="nil") t.kind = tok::nil;
+        return t;
+    }
+
+    view_token string() {
+        auto start = loc();
+        auto begin = ++pos_;
+        while (peek() && peek()!='"') ++pos_;
+        if (!peek()) return error(start, "string missing closing \"");
+
+        auto t = spelled(start, tok::string, begin);
+        ++pos_; // gobble the closing "
+        return t;
+    }
+
+    view_token number() {
+        auto start = loc();
+        auto begin = pos_;
+
+        // Start counting the number of points in the number.
+        auto num_point = (*pos_=='.'? 1: 0);
+        bool uses_scientific_notation = false;
+
+        ++pos_;
+        while (true) {
+            char c = peek();
+            if (is_digit(c)) {
+                ++pos_;
+            }
+            else if (c=='.') {
+                // Can't have more than one '.' in a number, or a '.' in the exponent.
+                if (++num_point>1) return error(start, "unexpected '.'");
+                ++pos_;
+                if (uses_scientific_notation) return error(start, "unexpected '.'");
+            }
+            else if (!uses_scientific_notation && (c=='e' || c=='E')) {
+                if (is_digit(peek(1))) {
+                    pos_ += 1;
+                }
+                else if (is_plusminus(peek(1)) && is_digit(peek(2))) {
+                    pos_ += 2;
+                }
+                else {
+                    // the 'e' or 'E' is the beginning of a new token
+                    break;
+                }
+                uses_scientific_notation = true;
+            }
+            else {
+                break;
+            }
+        }
+
+        const bool is_real = uses_scientific_notation || num_point>0;
+        return spelled(start, is_real? tok::real: tok::integer, begin);
+    }
+};
+
 //
 // s expression members
 //
@@ -480,7 +661,8 @@ s_expr parse_s_expr(transmogrifier begin) {
 }
 
 s_expr parse_s_expr(const std::string& in) {
-    return parse_s_expr(transmogrifier{in});
+    auto tree = parse_s_expr_tree(in);
+    return tree.to_s_expr(tree.roots.front());
 }
 
 // For parsing a file with multiple high level s expressions.
@@ -499,5 +681,157 @@ std::vector<s_expr> parse_multi_s_expr(transmogrifier begin) {
     return result;
 }
 
+//
+// s expression trees
+//
+
+src_location s_expr_tree::location(index_type i) const {
+    while (nodes[i].kind==tok::lparen) i = nodes[i].first;
+    return nodes[i].loc;
+}
+
+s_expr s_expr_tree::to_s_expr(index_type i) const {
+    auto& n = nodes[i];
+    if (n.kind!=tok::lparen) {
+        return token{n.loc, n.kind, std::string(n.spelling)};
+    }
+
+    std::vector<index_type> elements;
+    elements.reserve(n.length);
+    for (auto j = n.first; j!=npos; j = nodes[j].next) {
+        elements.push_back(j);
+    }
+
+    s_expr list;
+    for (auto j = elements.rbegin(); j!=elements.rend(); ++j) {
+        list = s_expr(to_s_expr(*j), std::move(list));
+    }
+    return list;
+}
+
+namespace impl {
+
+class tree_parser {
+    using index_type = s_expr_tree::index_type;
+    static constexpr index_type npos = s_expr_tree::npos;
+
+    view_lexer L;
+    s_expr_tree& tree;
+    std::unordered_map<std::string_view, index_type> symbol_ids;
+
+public:
+    tree_parser(std::string_view in, s_expr_tree& tree): L(in), tree(tree) {}
+
+    const view_token& current() const {
+        return L.current();
+    }
+
+    // Parse an expression into the tree, and return the index of its root.
+    // As for impl::parse, an expression with an error is replaced by an
+    // error atom.
+    index_type parse() {
+        auto t = L.current();
+
+        if (t.kind==tok::lparen) {
+            const auto root = index_type(tree.nodes.size());
+            tree.nodes.push_back({tok::lparen, t.loc, {}, npos, npos, npos, 0});
+
+            index_type last = npos;
+            t = L.next();
+            while (t.kind!=tok::rparen) {
+                index_type e;
+                if (t.kind==tok::eof) {
+                    return error(root, t.loc, "Unexpected end of input. Missing a closing parenthesis ')'.");
+                }
+                else if (t.kind==tok::error) {
+                    return error(root, t.loc, t.spelling);
+                }
+                else if (t.kind==tok::lparen) {
+                    e = parse();
+                    if (tree.nodes[e].kind==tok::error) {
+                        auto err = tree.nodes[e];
+                        tree.nodes.resize(root);
+                        tree.nodes.push_back(err);
+                        return root;
+                    }
+                }
+                else {
+                    e = atom(t);
+                }
+
+                (last==npos? tree.nodes[root].first: tree.nodes[last].next) = e;
+                tree.nodes[root].length++;
+                last = e;
+                t = L.current();
+            }
+
+            if (last==npos) {
+                tree.nodes[root] = {tok::nil, t.loc, "nil"};
+            }
+            L.next();
+            return root;
+        }
+        else if (t.kind==tok::eof) {
+            return error(tree.nodes.size(), t.loc, "Empty expression.");
+        }
+        else if (t.kind==tok::rparen) {
+            return error(tree.nodes.size(), t.loc, "Missing opening parenthesis'('.");
+        }
+        else if (t.kind==tok::error) {
+            return error(tree.nodes.size(), t.loc, t.spelling);
+        }
+        return atom(t);
+    }
+
+    // Replace the nodes from root onwards with an error atom.
+    index_type error(std::size_t root, src_location loc, std::string_view msg) {
+        tree.message = std::make_unique<std::string>(msg);
+        tree.nodes.resize(root);
+        tree.nodes.push_back({tok::error, loc, *tree.message, npos, npos, npos, 0});
+        return index_type(root);
+    }
+
+private:
+    // Append an atom, and advance the lexer past it.
+    index_type atom(const view_token& t) {
+        s_expr_tree::node n{t.kind, t.loc, t.spelling, npos, npos, npos, 0};
+        if (t.kind==tok::symbol) {
+            auto [it, inserted] = symbol_ids.insert({t.spelling, index_type(tree.symbols.size())});
+            if (inserted) tree.symbols.push_back(t.spelling);
+            n.symbol = it->second;
+        }
+        tree.nodes.push_back(n);
+        L.next();
+        return index_type(tree.nodes.size()-1);
+    }
+};
+
+} // namespace impl
+
+s_expr_tree parse_s_expr_tree(std::string_view in) {
+    s_expr_tree tree;
+    impl::tree_parser p(in, tree);
+
+    auto root = p.parse();
+    if (tree[root].kind!=tok::error) {
+        auto& t = p.current();
+        if (t.kind!=tok::eof) {
+            root = p.error(0, t.loc, util::pprintf("Unexpected '{}' at the end of input.", t));
+        }
+    }
+    tree.roots.push_back(root);
+    return tree;
+}
+
+s_expr_tree parse_multi_s_expr_tree(std::string_view in) {
+    s_expr_tree tree;
+    impl::tree_parser p(in, tree);
+
+    while (p.current().kind!=tok::eof) {
+        tree.roots.push_back(p.parse());
+        if (tree[tree.roots.back()].kind==tok::error) break;
+    }
+    return tree;
+}
 
 } // namespace arb
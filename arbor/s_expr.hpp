@@ -1,10 +1,12 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <iterator>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
@@ -317,7 +319,8 @@ struct s_expr {
     using pair_type = s_pair<value_wrapper<s_expr>>;
     std::variant<token, pair_type> state = token{{0,0}, tok::nil, "nil"};
 
-    s_expr(const s_expr& s): state(s.state) {}
+    s_expr(const s_expr&) = default;
+    s_expr& operator=(const s_expr&) = default;
     s_expr() = default;
     s_expr(token t): state(std::move(t)) {}
     s_expr(s_expr l, s_expr r):
@@ -350,7 +353,53 @@ src_location location(const s_expr& l);
 
 s_expr parse_s_expr(const std::string& line);
 s_expr parse_s_expr(transmogrifier begin);
-std::vector<s_expr> parse_multi(transmogrifier begin);
+std::vector<s_expr> parse_multi_s_expr(transmogrifier begin);
+
+// Compact representation of s-expressions, for parsing large inputs such as
+// label dictionaries or files that describe many cells.
+//
+// The nodes of all expressions parsed from one input are stored in a single
+// vector, atoms refer to their spelling in the input, which must outlive the
+// tree, and symbols are interned, so that equal symbols have the same id.
+//
+// A non-empty list is a node of kind tok::lparen, with its elements linked
+// from first through next. As for s_expr, the empty list is an atom of kind
+// tok::nil, and an expression with a syntax error is replaced by a single
+// atom of kind tok::error that has the error message as its spelling.
+struct s_expr_tree {
+    using index_type = std::uint32_t;
+    static constexpr index_type npos = index_type(-1);
+
+    struct node {
+        tok kind;
+        src_location loc;
+        std::string_view spelling;  // Atoms only.
+        index_type symbol = npos;   // Interned id of a symbol.
+        index_type first = npos;    // First element of a list.
+        index_type next = npos;     // Next element of the enclosing list.
+        index_type length = 0;      // Number of elements of a list.
+    };
+
+    std::vector<node> nodes;
+    std::vector<index_type> roots;          // Top level expressions.
+    std::vector<std::string_view> symbols;  // Spelling of symbols by id.
+    std::unique_ptr<std::string> message;   // Spelling of an error atom.
+
+    const node& operator[](index_type i) const { return nodes[i]; }
+
+    // Location of the first atom of an expression.
+    src_location location(index_type i) const;
+
+    // Copy of an expression as an s_expr.
+    s_expr to_s_expr(index_type i) const;
+};
+
+// Parse a single expression, like parse_s_expr.
+s_expr_tree parse_s_expr_tree(std::string_view in);
+
+// Parse all expressions in the input, like parse_multi_s_expr: if there is an
+// error, the last expression is an error atom.
+s_expr_tree parse_multi_s_expr_tree(std::string_view in);
 
 } // namespace arb
 
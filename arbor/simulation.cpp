@@ -1,8 +1,14 @@
+#include <algorithm>
+#include <chrono>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <set>
+#include <tuple>
 #include <vector>
 
 #include <arbor/arbexcept.hpp>
+#include <arbor/cable_cell.hpp>
 #include <arbor/context.hpp>
 #include <arbor/domain_decomposition.hpp>
 #include <arbor/generic_event.hpp>
@@ -21,6 +27,7 @@
 #include "util/filter.hpp"
 #include "util/maputil.hpp"
 #include "util/partition.hpp"
+#include "util/rangeutil.hpp"
 #include "util/span.hpp"
 #include "profile/profiler_macro.hpp"
 
@@ -65,14 +72,43 @@ public:
 
     void remove_all_samplers();
 
+    sampler_association_handle add_summed_sampler(cell_member_predicate probe_ids,
+        schedule sched, summed_sample_function f);
+
     std::vector<probe_metadata> get_probe_metadata(cell_member_type) const;
 
     std::size_t num_spikes() const {
         return communicator_.num_spikes();
     }
 
+    std::size_t num_folded_connections() const {
+        return communicator_.num_folded_connections();
+    }
+
     void set_binning_policy(binning_kind policy, time_type bin_interval);
 
+    void set_compact_spike_exchange(bool enable, time_type resolution) {
+        // Rounding moves a spike by at most half the resolution, which must
+        // not take its events into an epoch that has already been set up.
+        if (enable && !(resolution>=0 && resolution<min_delay_)) {
+            throw range_check_failure("compact spike exchange resolution must be non-negative and less than the minimum delay", resolution);
+        }
+        communicator_.set_compact_exchange(enable, resolution);
+    }
+
+    void set_node_spike_exchange(bool enable) {
+        communicator_.set_node_exchange(enable);
+    }
+
+    void set_deterministic(bool enable) {
+        deterministic_ = enable;
+    }
+
+    void set_mechanism_parameter(const std::string& mechanism, const std::string& parameter, double value) {
+        foreach_group(
+            [&](cell_group_ptr& group) { group->set_mechanism_parameter(mechanism, parameter, value); });
+    }
+
     void inject_events(const pse_vector& events);
 
     spike_export_function global_export_callback_;
@@ -94,6 +130,11 @@ private:
     time_type min_delay_;
     std::vector<cell_group_ptr> cell_groups_;
 
+    // Wall time [s] taken by each cell group to advance over the last epoch,
+    // and the order in which groups are scheduled: longest first.
+    std::vector<double> group_time_;
+    std::vector<int> group_order_;
+
     // one set of event_generators for each local cell
     std::vector<std::vector<event_generator>> event_generators_;
 
@@ -110,13 +151,43 @@ private:
 
     task_system_handle task_system_;
 
+    // Sort exported spikes by time and source.
+    bool deterministic_ = false;
+
     // Pending events to be delivered.
     std::array<std::vector<pse_vector>, 2> event_lanes_;
     std::vector<pse_vector> pending_events_;
 
+    // For each local cell, whether its group queues its own events
+    // (see cell_group::queues_events).
+    std::vector<char> queues_events_;
+
     // Sampler associations handles are managed by a helper class.
     util::handle_set<sampler_association_handle> sassoc_handles_;
 
+    // Summed samplers collect the local samples taken in an epoch. At the
+    // end of the epoch these are summed in probe id order, and the sums of
+    // all summed samplers are reduced over all domains together. Each cell
+    // group writes the samples of its probes to its own slot.
+    struct summed_probe_samples {
+        cell_member_type id;
+        unsigned index;
+        std::vector<time_type> time;    // Sample times, in increasing order.
+        std::vector<std::size_t> divs;  // Partitions values by sample.
+        std::vector<double> values;
+    };
+    struct summed_sampler {
+        schedule sched;
+        summed_sample_function callback;
+        unsigned width = 0; // Values per sample time, agreed over all domains.
+        std::vector<std::vector<summed_probe_samples>> group_samples;
+    };
+    std::map<sampler_association_handle, std::unique_ptr<summed_sampler>> summed_samplers_;
+
+    void reduce_summed_samples(time_type t_from, time_type t_to);
+
+    distributed_context_handle distributed_;
+
     // Apply a functional to each cell group in parallel.
     template <typename L>
     void foreach_group(L&& fn) {
@@ -141,7 +212,8 @@ simulation_state::simulation_state(
     local_spikes_(new spike_double_buffer(thread_private_spike_store(ctx.thread_pool),
                                           thread_private_spike_store(ctx.thread_pool))),
     communicator_(rec, decomp, ctx),
-    task_system_(ctx.thread_pool)
+    task_system_(ctx.thread_pool),
+    distributed_(ctx.distributed)
 {
     const auto num_local_cells = communicator_.num_local_cells();
 
@@ -166,15 +238,33 @@ simulation_state::simulation_state(
         ++grpidx;
     }
 
+    // Cable cell groups on the multicore back-end share any threads in excess
+    // of one per group.
+    unsigned n_shared_groups = std::count_if(decomp.groups.begin(), decomp.groups.end(),
+        [](const group_description& g) {
+            return g.kind==cell_kind::cable && g.backend==backend_kind::multicore;
+        });
+    unsigned team_size = n_shared_groups? std::max(1u, ctx.thread_pool->get_num_threads()/n_shared_groups): 1u;
+
     // Generate the cell groups in parallel, with one task per cell group.
     cell_groups_.resize(decomp.groups.size());
     foreach_group_index(
         [&](cell_group_ptr& group, int i) {
             const auto& group_info = decomp.groups[i];
-            auto factory = cell_kind_implementation(group_info.kind, group_info.backend, ctx);
+            auto factory = cell_kind_implementation(group_info.kind, group_info.backend, ctx, team_size);
             group = factory(group_info.gids, rec);
         });
 
+    for (auto i: util::count_along(cell_groups_)) {
+        queues_events_.insert(queues_events_.end(), decomp.groups[i].gids.size(), cell_groups_[i]->queues_events());
+    }
+
+    // Until advance times are measured, schedule groups in the order of the
+    // domain decomposition.
+    group_time_.assign(cell_groups_.size(), 0.);
+    group_order_.resize(cell_groups_.size());
+    std::iota(group_order_.begin(), group_order_.end(), 0);
+
     // Create event lane buffers.
     // There is one set for each epoch: current (0) and next (1).
     // For each epoch there is one lane for each cell in the cell group.
@@ -211,6 +301,13 @@ void simulation_state::reset() {
 
     local_spikes_->current().clear();
     local_spikes_->previous().clear();
+
+    for (auto& entry: summed_samplers_) {
+        entry.second->sched.reset();
+        for (auto& slot: entry.second->group_samples) {
+            slot.clear();
+        }
+    }
 }
 
 time_type simulation_state::run(time_type tfinal, time_type dt) {
@@ -221,10 +318,19 @@ time_type simulation_state::run(time_type tfinal, time_type dt) {
     // to overlap communication and computation.
     const time_type t_interval = min_delay_/2;
 
-    // task that updates cell state in parallel.
+    // task that updates cell state in parallel. Groups are started in order
+    // of their advance time over the previous epoch, longest first, so that
+    // the most expensive group does not set the length of the epoch by
+    // starting last.
     auto update_cells = [&] () {
-        foreach_group_index(
-            [&](cell_group_ptr& group, int i) {
+        using clock = std::chrono::steady_clock;
+
+        threading::parallel_for::apply(0, cell_groups_.size(), task_system_.get(),
+            [&](int k) {
+                int i = group_order_[k];
+                auto& group = cell_groups_[i];
+                auto t0 = clock::now();
+
                 auto queues = util::subrange_view(event_lanes(epoch_.id), communicator_.group_queue_range(i));
                 group->advance(epoch_, dt, queues);
 
@@ -232,7 +338,12 @@ time_type simulation_state::run(time_type tfinal, time_type dt) {
                 local_spikes_->current().insert(group->spikes());
                 group->clear_spikes();
                 PL();
+
+                group_time_[i] = std::chrono::duration<double>(clock::now()-t0).count();
             });
+
+        std::stable_sort(group_order_.begin(), group_order_.end(),
+            [&](int a, int b) { return group_time_[a]>group_time_[b]; });
     };
 
     // task that performs spike exchange with the spikes generated in
@@ -246,11 +357,30 @@ time_type simulation_state::run(time_type tfinal, time_type dt) {
         auto global_spikes = communicator_.exchange(local_spikes);
 
         PE(communication_spikeio);
-        if (local_export_callback_) {
-            local_export_callback_(local_spikes);
+        if (deterministic_) {
+            // The gathered spikes are ordered by source within each domain;
+            // the global spikes are also needed in that order below, so are
+            // sorted in a copy.
+            auto canonical = [](const spike& a, const spike& b) {
+                return std::tie(a.time, a.source)<std::tie(b.time, b.source);
+            };
+            if (local_export_callback_) {
+                util::sort(local_spikes, canonical);
+                local_export_callback_(local_spikes);
+            }
+            if (global_export_callback_) {
+                std::vector<spike> spikes(global_spikes.values());
+                util::sort(spikes, canonical);
+                global_export_callback_(spikes);
+            }
         }
-        if (global_export_callback_) {
-            global_export_callback_(global_spikes.values());
+        else {
+            if (local_export_callback_) {
+                local_export_callback_(local_spikes);
+            }
+            if (global_export_callback_) {
+                global_export_callback_(global_spikes.values());
+            }
         }
         PL();
 
@@ -274,12 +404,15 @@ time_type simulation_state::run(time_type tfinal, time_type dt) {
         local_spikes_->current().clear();
 
         // run the tasks, overlapping if the threading model and number of
-        // available threads permits it.
+        // available threads permits it. The exchange is run ahead of any
+        // waiting cell group updates, to hide its communication latency.
         threading::task_group g(task_system_.get());
-        g.run(exchange);
+        g.run(exchange, threading::high_priority);
         g.run(update_cells);
         g.wait();
 
+        reduce_summed_samples(t_, tuntil);
+
         t_ = tuntil;
 
         tuntil = std::min(t_+t_interval, tfinal);
@@ -310,6 +443,11 @@ auto split_sorted_range(Seq&& seq, const Value& v, Less cmp = Less{}) {
 //      event_lanes[epoch]: take all events ≥ t_from
 //      event_generators  : take all events < t_to
 //      pending_events    : take all events
+//
+// Cells of groups that queue their own events instead receive only the
+// pending and generated events, unsorted. The group empties the lane when it
+// takes the events, so the pending events can usually be moved rather than
+// copied into the lane.
 
 // merge_cell_events() is a separate function for unit testing purposes.
 void merge_cell_events(
@@ -366,6 +504,23 @@ void simulation_state::setup_events(time_type t_from, time_type t_to, std::size_
     const auto n = communicator_.num_local_cells();
     threading::parallel_for::apply(0, n, task_system_.get(),
         [&](cell_size_type i) {
+            if (queues_events_[i]) {
+                auto& lane = event_lanes(epoch+1)[i];
+                if (lane.empty()) {
+                    std::swap(lane, pending_events_[i]);
+                }
+                else {
+                    lane.insert(lane.end(), pending_events_[i].begin(), pending_events_[i].end());
+                    pending_events_[i].clear();
+                }
+
+                for (auto& g: event_generators_[i]) {
+                    event_span evs = g.events(t_from, t_to);
+                    lane.insert(lane.end(), evs.begin(), evs.end());
+                }
+                return;
+            }
+
             PE(communication_enqueue_sort);
             util::sort(pending_events_[i]);
             PL();
@@ -396,6 +551,7 @@ void simulation_state::remove_sampler(sampler_association_handle h) {
     foreach_group(
         [h](cell_group_ptr& group) { group->remove_sampler(h); });
 
+    summed_samplers_.erase(h);
     sassoc_handles_.release(h);
 }
 
@@ -403,9 +559,158 @@ void simulation_state::remove_all_samplers() {
     foreach_group(
         [](cell_group_ptr& group) { group->remove_all_samplers(); });
 
+    summed_samplers_.clear();
     sassoc_handles_.clear();
 }
 
+sampler_association_handle simulation_state::add_summed_sampler(
+        cell_member_predicate probe_ids,
+        schedule sched,
+        summed_sample_function f)
+{
+    auto s = std::make_unique<summed_sampler>();
+    s->sched = sched;
+    s->callback = std::move(f);
+    s->group_samples.resize(cell_groups_.size());
+
+    // A cell group passes the samples of a probe in time order, and calls
+    // the sampler from one thread at a time.
+    auto collect = [this, s = s.get()](probe_metadata pm, std::size_t n, const sample_record* records) {
+        auto& slot = s->group_samples[gid_to_local_.at(pm.id.gid).group_index];
+        if (slot.empty() || slot.back().id!=pm.id || slot.back().index!=pm.index) {
+            slot.push_back({pm.id, pm.index, {}, {0}, {}});
+        }
+        auto& samples = slot.back();
+
+        for (std::size_t i = 0; i<n; ++i) {
+            if (auto p = util::any_cast<const double*>(records[i].data)) {
+                samples.values.push_back(*p);
+            }
+            else if (auto p = util::any_cast<const cable_sample_range*>(records[i].data)) {
+                samples.values.insert(samples.values.end(), p->first, p->second);
+            }
+            else {
+                continue;
+            }
+            samples.time.push_back(records[i].time);
+            samples.divs.push_back(samples.values.size());
+        }
+    };
+
+    auto h = add_sampler(std::move(probe_ids), std::move(sched), collect, sampling_policy::lax);
+    summed_samplers_[h] = std::move(s);
+    return h;
+}
+
+// Sum the samples collected by the summed samplers over [t_from, t_to), reduce
+// the sums across all domains, and pass them to the callbacks.
+void simulation_state::reduce_summed_samples(time_type t_from, time_type t_to) {
+    using time_range = std::pair<const time_type*, const time_type*>;
+
+    // Summed samplers with sample times in the epoch; schedules are the same
+    // on every domain, so these are too.
+    std::vector<std::pair<summed_sampler*, time_range>> due;
+    for (auto& entry: summed_samplers_) {
+        auto times = entry.second->sched.events(t_from, t_to);
+        if (times.first!=times.second) {
+            due.push_back({entry.second.get(), times});
+        }
+    }
+    if (due.empty()) return;
+
+    // Agree on the width of the samplers that have not yet seen a sample on
+    // any domain, with one reduction for all of them.
+    std::vector<unsigned> widths;
+    for (auto& [s, times]: due) {
+        if (s->width) continue;
+
+        unsigned local_width = 0;
+        for (auto& slot: s->group_samples) {
+            for (auto& samples: slot) {
+                for (std::size_t i = 0; i+1<samples.divs.size(); ++i) {
+                    local_width = std::max<unsigned>(local_width, samples.divs[i+1]-samples.divs[i]);
+                }
+            }
+        }
+        widths.push_back(local_width);
+    }
+    if (!widths.empty()) {
+        widths = distributed_->max(std::move(widths));
+        auto w = widths.begin();
+        for (auto& [s, times]: due) {
+            if (!s->width) s->width = *w++;
+        }
+    }
+
+    // Sum the local samples of each sampler, by sample time and in probe id
+    // order, into its block of one buffer for all samplers.
+    std::vector<std::size_t> offset = {0};
+    for (auto& [s, times]: due) {
+        offset.push_back(offset.back()+(times.second-times.first)*s->width);
+    }
+    std::vector<double> flat(offset.back(), 0.);
+
+    std::vector<const summed_probe_samples*> by_id;
+    for (auto k: util::count_along(due)) {
+        auto& [s, times] = due[k];
+
+        by_id.clear();
+        for (auto& slot: s->group_samples) {
+            for (auto& samples: slot) {
+                by_id.push_back(&samples);
+            }
+        }
+        std::stable_sort(by_id.begin(), by_id.end(),
+            [](auto a, auto b) { return std::tie(a->id, a->index)<std::tie(b->id, b->index); });
+
+        // With lax sampling a sample is taken no later than its scheduled
+        // time, so each sample is matched to the first unmatched sample time
+        // not before it.
+        const summed_probe_samples* prev = nullptr;
+        const time_type* t = times.first;
+        for (auto samples: by_id) {
+            if (!prev || prev->id!=samples->id || prev->index!=samples->index) {
+                t = times.first;
+            }
+            prev = samples;
+
+            for (auto i: util::count_along(samples->time)) {
+                t = std::lower_bound(t, times.second, samples->time[i]);
+                if (t==times.second) {
+                    throw arbor_internal_error("summed sampler: sample does not match a sample time");
+                }
+
+                auto b = samples->divs[i], e = samples->divs[i+1];
+                if (e-b>s->width) {
+                    throw arbor_internal_error("summed sampler: sample width differs from first sample");
+                }
+
+                double* sum = flat.data()+offset[k]+(t-times.first)*s->width;
+                for (auto j = b; j<e; ++j) {
+                    *sum++ += samples->values[j];
+                }
+                ++t;
+            }
+        }
+
+        for (auto& slot: s->group_samples) {
+            slot.clear();
+        }
+    }
+
+    flat = distributed_->sum(std::move(flat));
+
+    for (auto k: util::count_along(due)) {
+        auto& [s, times] = due[k];
+        std::vector<double> row(s->width);
+        for (auto t = times.first; t!=times.second; ++t) {
+            auto b = flat.begin()+offset[k]+(t-times.first)*s->width;
+            std::copy(b, b+s->width, row.begin());
+            s->callback(*t, row);
+        }
+    }
+}
+
 std::vector<probe_metadata> simulation_state::get_probe_metadata(cell_member_type probe_id) const {
     if (auto linfo = util::value_by_key(gid_to_local_, probe_id.gid)) {
         return cell_groups_.at(linfo->group_index)->get_probe_metadata(probe_id);
@@ -469,6 +774,14 @@ void simulation::remove_all_samplers() {
     impl_->remove_all_samplers();
 }
 
+sampler_association_handle simulation::add_summed_sampler(
+    cell_member_predicate probe_ids,
+    schedule sched,
+    summed_sample_function f)
+{
+    return impl_->add_summed_sampler(std::move(probe_ids), std::move(sched), std::move(f));
+}
+
 std::vector<probe_metadata> simulation::get_probe_metadata(cell_member_type probe_id) const {
     return impl_->get_probe_metadata(probe_id);
 }
@@ -477,10 +790,30 @@ std::size_t simulation::num_spikes() const {
     return impl_->num_spikes();
 }
 
+std::size_t simulation::num_folded_connections() const {
+    return impl_->num_folded_connections();
+}
+
 void simulation::set_binning_policy(binning_kind policy, time_type bin_interval) {
     impl_->set_binning_policy(policy, bin_interval);
 }
 
+void simulation::set_mechanism_parameter(const std::string& mechanism, const std::string& parameter, double value) {
+    impl_->set_mechanism_parameter(mechanism, parameter, value);
+}
+
+void simulation::set_compact_spike_exchange(bool enable, time_type resolution) {
+    impl_->set_compact_spike_exchange(enable, resolution);
+}
+
+void simulation::set_node_spike_exchange(bool enable) {
+    impl_->set_node_spike_exchange(enable);
+}
+
+void simulation::set_deterministic(bool enable) {
+    impl_->set_deterministic(enable);
+}
+
 void simulation::set_global_spike_callback(spike_export_function export_callback) {
     impl_->global_export_callback_ = std::move(export_callback);
 }
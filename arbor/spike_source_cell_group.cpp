@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <exception>
 
 #include <arbor/arbexcept.hpp>
@@ -21,11 +22,21 @@ spike_source_cell_group::spike_source_cell_group(const std::vector<cell_gid_type
         }
     }
 
-    time_sequences_.reserve(gids_.size());
-    for (auto gid: gids_) {
+    for (auto i: util::count_along(gids_)) {
+        auto gid = gids_[i];
         try {
             auto cell = util::any_cast<spike_source_cell>(rec.get_cell_description(gid));
-            time_sequences_.push_back(std::move(cell.seq));
+            if (cell.trains) {
+                if (std::find(files_.begin(), files_.end(), cell.trains)==files_.end()) {
+                    files_.push_back(cell.trains);
+                }
+                replayed_.push_back(i);
+                trains_.push_back(cell.trains.train(cell.train));
+            }
+            else {
+                scheduled_.push_back(i);
+                time_sequences_.push_back(std::move(cell.seq));
+            }
         }
         catch (std::bad_any_cast& e) {
             throw bad_cell_description(cell_kind::spike_source, gid);
@@ -40,13 +51,24 @@ cell_kind spike_source_cell_group::get_cell_kind() const {
 void spike_source_cell_group::advance(epoch ep, time_type dt, const event_lane_subrange& event_lanes) {
     PE(advance_sscell);
 
-    for (auto i: util::count_along(gids_)) {
-        const auto gid = gids_[i];
+    for (auto i: util::count_along(scheduled_)) {
+        const auto gid = gids_[scheduled_[i]];
 
         for (auto t: util::make_range(time_sequences_[i].events(t_, ep.tfinal))) {
             spikes_.push_back({{gid, 0u}, t});
         }
     }
+
+    for (auto i: util::count_along(replayed_)) {
+        const auto gid = gids_[replayed_[i]];
+        auto [first, last] = trains_[i];
+
+        first = std::lower_bound(first, last, t_);
+        last = std::lower_bound(first, last, ep.tfinal);
+        for (auto t: util::make_range(first, last)) {
+            spikes_.push_back({{gid, 0u}, t});
+        }
+    }
     t_ = ep.tfinal;
 
     PL();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include <arbor/common_types.hpp>
@@ -7,6 +8,7 @@
 #include <arbor/sampling.hpp>
 #include <arbor/schedule.hpp>
 #include <arbor/spike.hpp>
+#include <arbor/spike_trains.hpp>
 
 #include "cell_group.hpp"
 #include "epoch.hpp"
@@ -39,7 +41,16 @@ private:
     time_type t_ = 0;
     std::vector<spike> spikes_;
     std::vector<cell_gid_type> gids_;
+
+    // Cells with a schedule: index in gids_ and time sequence.
+    std::vector<cell_size_type> scheduled_;
     std::vector<schedule> time_sequences_;
+
+    // Cells replaying a spike train: index in gids_ and the spike times in
+    // the mapped file, which is kept open by files_.
+    std::vector<cell_size_type> replayed_;
+    std::vector<std::pair<const time_type*, const time_type*>> trains_;
+    std::vector<spike_train_file> files_;
 };
 
 } // namespace arb
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <arbor/spike_trains.hpp>
+
+#include "util/strprintf.hpp"
+
+namespace arb {
+
+static const char spike_train_magic[8] = {'A', 'R', 'B', 'S', 'P', 'K', 'T', '1'};
+static constexpr std::size_t header_size = sizeof(spike_train_magic)+2*sizeof(std::uint64_t);
+
+bad_spike_train_file::bad_spike_train_file(const std::string& path, const std::string& reason):
+    arbor_exception(util::pprintf("bad spike train file '{}': {}", path, reason)),
+    path(path)
+{}
+
+struct spike_train_file::mapping {
+    void* addr = nullptr;
+    std::size_t length = 0;
+
+    std::size_t num_trains = 0;
+    std::size_t num_spikes = 0;
+    const std::uint64_t* offsets = nullptr;
+    const time_type* times = nullptr;
+
+    ~mapping() {
+        if (addr) munmap(addr, length);
+    }
+};
+
+spike_train_file::spike_train_file(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd<0) {
+        throw bad_spike_train_file(path, std::strerror(errno));
+    }
+
+    struct stat st;
+    if (fstat(fd, &st)) {
+        int err = errno;
+        close(fd);
+        throw bad_spike_train_file(path, std::strerror(err));
+    }
+
+    std::size_t length = st.st_size;
+    if (length<header_size) {
+        close(fd);
+        throw bad_spike_train_file(path, "truncated header");
+    }
+
+    void* addr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    int err = errno;
+    close(fd);
+    if (addr==MAP_FAILED) {
+        throw bad_spike_train_file(path, std::strerror(err));
+    }
+
+    // The mapping is released if the contents are rejected below.
+    auto m = std::make_shared<mapping>();
+    m->addr = addr;
+    m->length = length;
+
+    const char* p = static_cast<const char*>(addr);
+    if (std::memcmp(p, spike_train_magic, sizeof(spike_train_magic))) {
+        throw bad_spike_train_file(path, "not a spike train file");
+    }
+
+    std::uint64_t n, s;
+    std::memcpy(&n, p+sizeof(spike_train_magic), sizeof(n));
+    std::memcpy(&s, p+sizeof(spike_train_magic)+sizeof(n), sizeof(s));
+
+    constexpr std::size_t w = sizeof(std::uint64_t);
+    if (n>=length/w || s>=length/w || length!=header_size+w*(n+1)+sizeof(time_type)*s) {
+        throw bad_spike_train_file(path, "inconsistent size");
+    }
+
+    m->num_trains = n;
+    m->num_spikes = s;
+    m->offsets = reinterpret_cast<const std::uint64_t*>(p+header_size);
+    m->times = reinterpret_cast<const time_type*>(p+header_size+w*(n+1));
+
+    // Check the offsets, but not the order of the times: that would read the
+    // whole file.
+    if (m->offsets[0]!=0 || m->offsets[n]!=s ||
+        !std::is_sorted(m->offsets, m->offsets+n+1))
+    {
+        throw bad_spike_train_file(path, "inconsistent offsets");
+    }
+
+    impl_ = std::move(m);
+}
+
+std::size_t spike_train_file::num_trains() const {
+    return impl_? impl_->num_trains: 0;
+}
+
+std::size_t spike_train_file::num_spikes() const {
+    return impl_? impl_->num_spikes: 0;
+}
+
+std::pair<const time_type*, const time_type*> spike_train_file::train(std::size_t i) const {
+    if (i>=num_trains()) return {nullptr, nullptr};
+    return {impl_->times+impl_->offsets[i], impl_->times+impl_->offsets[i+1]};
+}
+
+void write_spike_train_file(const std::string& path, std::vector<spike> spikes, std::size_t num_trains) {
+    std::sort(spikes.begin(), spikes.end(),
+        [](const spike& a, const spike& b) {
+            return std::tie(a.source.gid, a.time)<std::tie(b.source.gid, b.time);
+        });
+
+    if (!spikes.empty()) {
+        num_trains = std::max<std::size_t>(num_trains, spikes.back().source.gid+1);
+    }
+
+    std::vector<std::uint64_t> offsets(num_trains+1, 0);
+    std::vector<time_type> times;
+    times.reserve(spikes.size());
+    for (auto& s: spikes) {
+        ++offsets[s.source.gid+1];
+        times.push_back(s.time);
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        throw bad_spike_train_file(path, "unable to open for writing");
+    }
+
+    std::uint64_t header[2] = {num_trains, times.size()};
+    out.write(spike_train_magic, sizeof(spike_train_magic));
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(offsets.data()), offsets.size()*sizeof(std::uint64_t));
+    out.write(reinterpret_cast<const char*>(times.data()), times.size()*sizeof(time_type));
+
+    if (!out.flush()) {
+        throw bad_spike_train_file(path, "write failed");
+    }
+}
+
+} // namespace arb
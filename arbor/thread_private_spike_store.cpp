@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <vector>
 
 #include <arbor/common_types.hpp>
@@ -6,13 +7,20 @@
 #include "threading/enumerable_thread_specific.hpp"
 #include "threading/threading.hpp"
 #include "thread_private_spike_store.hpp"
+#include "util/range.hpp"
+#include "util/rangeutil.hpp"
 
 namespace arb {
 
 struct local_spike_store_type {
     threading::enumerable_thread_specific<std::vector<spike>> buffers_;
 
-    local_spike_store_type(const task_system_handle& ts): buffers_(ts) {};
+    // End offsets of the sorted runs in the corresponding buffer.
+    threading::enumerable_thread_specific<std::vector<std::size_t>> run_ends_;
+
+    task_system_handle thread_pool_;
+
+    local_spike_store_type(const task_system_handle& ts): buffers_(ts), run_ends_(ts), thread_pool_(ts) {};
 };
 
 thread_private_spike_store::thread_private_spike_store(thread_private_spike_store&& t):
@@ -25,28 +33,138 @@ thread_private_spike_store::thread_private_spike_store(const task_system_handle&
 
 thread_private_spike_store::~thread_private_spike_store() {}
 
+static bool source_less(const spike& a, const spike& b) {
+    return a.source<b.source;
+}
+
+static cell_member_type source_of(const spike& s) {
+    return s.source;
+}
+
 std::vector<spike> thread_private_spike_store::gather() const {
-    std::vector<spike> spikes;
-    unsigned num_spikes = 0u;
+    using run = util::range<const spike*>;
+
+    // Collect the sorted runs of every buffer. Anything appended through
+    // get() after the last insert() forms one more run, which must be sorted
+    // here; this is rare, so it is sorted into a temporary copy.
+    std::vector<run> runs;
+    std::vector<std::vector<spike>> tails;
+    std::size_t num_spikes = 0;
+
+    auto ends_it = impl_->run_ends_.begin();
     for (auto& b: impl_->buffers_) {
+        auto& ends = *ends_it++;
+        std::size_t begin = 0;
+        for (auto end: ends) {
+            if (end>begin) runs.emplace_back(b.data()+begin, b.data()+end);
+            begin = end;
+        }
+        if (begin<b.size()) {
+            tails.emplace_back(b.begin()+begin, b.end());
+        }
         num_spikes += b.size();
     }
-    spikes.reserve(num_spikes);
+    for (auto& t: tails) {
+        util::stable_sort_by(t, source_of);
+        runs.emplace_back(t.data(), t.data()+t.size());
+    }
 
-    for (auto& b: impl_->buffers_) {
-        spikes.insert(spikes.begin(), b.begin(), b.end());
+    if (runs.empty()) return {};
+
+    // Merge pairs of runs in parallel, halving the number of runs in each
+    // round, ping-ponging between two buffers. The first round reads directly
+    // from the thread private buffers.
+    std::vector<spike> merged(num_spikes), scratch;
+    std::vector<std::size_t> offsets(1, 0);
+    for (auto& r: runs) {
+        offsets.push_back(offsets.back()+r.size());
     }
 
-    return spikes;
+    auto merge_round = [&](std::vector<spike>& out) {
+        auto n_pair = (runs.size()+1)/2;
+        threading::parallel_for::apply(0, n_pair, impl_->thread_pool_.get(),
+            [&](std::size_t i) {
+                auto dest = out.data()+offsets[2*i];
+                if (2*i+1<runs.size()) {
+                    const auto& l = runs[2*i];
+                    const auto& r = runs[2*i+1];
+                    std::merge(l.begin(), l.end(), r.begin(), r.end(), dest, source_less);
+                }
+                else {
+                    std::copy(runs[2*i].begin(), runs[2*i].end(), dest);
+                }
+            });
+
+        std::vector<run> next_runs;
+        std::vector<std::size_t> next_offsets;
+        for (std::size_t i = 0; i<runs.size(); i += 2) {
+            next_offsets.push_back(offsets[i]);
+        }
+        next_offsets.push_back(offsets.back());
+        for (std::size_t i = 0; i+1<next_offsets.size(); ++i) {
+            next_runs.emplace_back(out.data()+next_offsets[i], out.data()+next_offsets[i+1]);
+        }
+        runs = std::move(next_runs);
+        offsets = std::move(next_offsets);
+    };
+
+    merge_round(merged);
+    if (runs.size()>1) {
+        scratch.resize(num_spikes);
+        while (runs.size()>1) {
+            merge_round(scratch);
+            std::swap(merged, scratch);
+        }
+    }
+
+    return merged;
 }
 
 std::vector<spike>& thread_private_spike_store::get() {
     return impl_->buffers_.local();
 }
 
+void thread_private_spike_store::insert(const std::vector<spike>& spikes) {
+    if (spikes.empty()) return;
+
+    auto& buff = get();
+    auto& ends = impl_->run_ends_.local();
+
+    // Any spikes appended through get() since the last insert form a run
+    // of their own, which must be sorted first.
+    auto n = ends.empty()? 0: ends.back();
+    if (n<buff.size()) {
+        util::stable_sort_by(util::subrange_view(buff, n, buff.size()), source_of);
+        ends.push_back(buff.size());
+    }
+
+    n = buff.size();
+    buff.insert(buff.end(), spikes.begin(), spikes.end());
+    util::stable_sort_by(util::subrange_view(buff, n, buff.size()), source_of);
+    ends.push_back(buff.size());
+
+    // Merge the last two runs while the last is at least as long as the one
+    // before it. As with a binary counter, this keeps the number of runs
+    // logarithmic in the number of spikes, and each spike takes part in a
+    // logarithmic number of merges, performed by the inserting thread.
+    while (ends.size()>1) {
+        auto k = ends.size();
+        auto b = k>2? ends[k-3]: 0;
+        auto m = ends[k-2];
+        auto e = ends[k-1];
+        if (e-m<m-b) break;
+
+        std::inplace_merge(buff.begin()+b, buff.begin()+m, buff.begin()+e, source_less);
+        ends.erase(ends.end()-2);
+    }
+}
+
 void thread_private_spike_store::clear() {
     for (auto& b: impl_->buffers_) {
         b.clear();
     }
+    for (auto& e: impl_->run_ends_) {
+        e.clear();
+    }
 }
 } // namespace arb
@@ -18,6 +18,12 @@ struct local_spike_store_type;
 /// The thread private buffer of the calling thread.
 /// The insert() and gather() methods add a vector of spikes to the buffer,
 /// and collate all of the buffers into a single vector respectively.
+///
+/// Each thread private buffer is kept as a sequence of runs of spikes sorted
+/// by source: insert() sorts the spikes it appends, so that the sorting cost
+/// is borne by the threads producing the spikes; runs are merged as they are
+/// inserted so that each buffer holds few of them, and gather() merges the runs
+/// of all buffers in parallel.
 class thread_private_spike_store {
 public :
     thread_private_spike_store();
@@ -26,22 +32,23 @@ public :
     thread_private_spike_store(thread_private_spike_store&& t);
     thread_private_spike_store(const task_system_handle& ts);
 
-    /// Collate all of the individual buffers into a single vector of spikes.
+    /// Collate all of the individual buffers into a single vector of spikes,
+    /// sorted by source. Spikes with the same source keep the order in which
+    /// they were inserted by a given thread.
     /// Does not modify the buffer contents.
     std::vector<spike> gather() const;
 
-    /// Return a reference to the thread private buffer of the calling thread
+    /// Return a reference to the thread private buffer of the calling thread.
+    /// Spikes appended directly to this buffer are treated as one unsorted
+    /// run by gather().
     std::vector<spike>& get();
 
     /// Clear all of the thread private buffers
     void clear();
 
     /// Append the passed spikes to the end of the thread private buffer of the
-    /// calling thread
-    void insert(const std::vector<spike>& spikes) {
-        auto& buff = get();
-        buff.insert(buff.end(), spikes.begin(), spikes.end());
-    }
+    /// calling thread as a new run, sorted by source.
+    void insert(const std::vector<spike>& spikes);
 
 private :
     /// thread private storage for accumulating spikes
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <atomic>
 
 #include "threading.hpp"
@@ -6,12 +7,42 @@ using namespace arb::threading::impl;
 using namespace arb::threading;
 using namespace arb;
 
+namespace {
+// Pop the front task of the highest priority non-empty queue.
+template <typename Queues>
+task pop_highest(Queues& q) {
+    task tsk;
+    for (int p = n_priority-1; p>=0; --p) {
+        if (!q[p].empty()) {
+            tsk = std::move(q[p].front());
+            q[p].pop_front();
+            break;
+        }
+    }
+    return tsk;
+}
+
+template <typename Queues>
+bool all_empty(const Queues& q) {
+    return std::all_of(q.begin(), q.end(), [](auto& d) { return d.empty(); });
+}
+} // anonymous namespace
+
 task notification_queue::try_pop() {
     task tsk;
     lock q_lock{q_mutex_, std::try_to_lock};
-    if (q_lock && !q_tasks_.empty()) {
-        tsk = std::move(q_tasks_.front());
-        q_tasks_.pop_front();
+    if (q_lock) {
+        tsk = pop_highest(q_tasks_);
+    }
+    return tsk;
+}
+
+task notification_queue::try_pop(int priority) {
+    task tsk;
+    lock q_lock{q_mutex_, std::try_to_lock};
+    if (q_lock && !q_tasks_[priority].empty()) {
+        tsk = std::move(q_tasks_[priority].front());
+        q_tasks_[priority].pop_front();
     }
     return tsk;
 }
@@ -19,31 +50,27 @@ task notification_queue::try_pop() {
 task notification_queue::pop() {
     task tsk;
     lock q_lock{q_mutex_};
-    while (q_tasks_.empty() && !quit_) {
+    while (all_empty(q_tasks_) && !quit_) {
         q_tasks_available_.wait(q_lock);
     }
-    if (!q_tasks_.empty()) {
-        tsk = std::move(q_tasks_.front());
-        q_tasks_.pop_front();
-    }
-    return tsk;
+    return pop_highest(q_tasks_);
 }
 
-bool notification_queue::try_push(task& tsk) {
+bool notification_queue::try_push(task& tsk, int priority) {
     {
         lock q_lock{q_mutex_, std::try_to_lock};
         if (!q_lock) return false;
-        q_tasks_.push_back(std::move(tsk));
+        q_tasks_[priority].push_back(std::move(tsk));
         tsk = 0;
     }
     q_tasks_available_.notify_all();
     return true;
 }
 
-void notification_queue::push(task&& tsk) {
+void notification_queue::push(task&& tsk, int priority) {
     {
         lock q_lock{q_mutex_};
-        q_tasks_.push_back(std::move(tsk));
+        q_tasks_[priority].push_back(std::move(tsk));
     }
     q_tasks_available_.notify_all();
 }
@@ -56,12 +83,17 @@ void notification_queue::quit() {
     q_tasks_available_.notify_all();
 }
 
+// Look in every queue for a task of one priority before trying the next
+// lower priority.
+
 void task_system::run_tasks_loop(int i){
     while (true) {
         task tsk;
-        for (unsigned n = 0; n != count_; n++) {
-            tsk = q_[(i + n) % count_].try_pop();
-            if (tsk) break;
+        for (int p = n_priority-1; p>=0 && !tsk; --p) {
+            for (unsigned n = 0; n != count_; n++) {
+                tsk = q_[(i + n) % count_].try_pop(p);
+                if (tsk) break;
+            }
         }
         if (!tsk) tsk = q_[i].pop();
         if (!tsk) break;
@@ -72,11 +104,13 @@ void task_system::run_tasks_loop(int i){
 void task_system::try_run_task() {
     auto nthreads = get_num_threads();
     task tsk;
-    for (int n = 0; n != nthreads; n++) {
-        tsk = q_[n % nthreads].try_pop();
-        if (tsk) {
-            tsk();
-            break;
+    for (int p = n_priority-1; p>=0; --p) {
+        for (int n = 0; n != nthreads; n++) {
+            tsk = q_[n % nthreads].try_pop(p);
+            if (tsk) {
+                tsk();
+                return;
+            }
         }
     }
 }
@@ -104,13 +138,13 @@ task_system::~task_system() {
     for (auto& e: threads_) e.join();
 }
 
-void task_system::async(task tsk) {
+void task_system::async(task tsk, int priority) {
     auto i = index_++;
 
     for (unsigned n = 0; n != count_; n++) {
-        if (q_[(i + n) % count_].try_push(tsk)) return;
+        if (q_[(i + n) % count_].try_push(tsk, priority)) return;
     }
-    q_[i % count_].push(std::move(tsk));
+    q_[i % count_].push(std::move(tsk), priority);
 }
 
 int task_system::get_num_threads() const {
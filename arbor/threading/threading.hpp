@@ -25,11 +25,16 @@ using lock = std::unique_lock<mutex>;
 using std::condition_variable;
 using task = std::function<void()>;
 
+// Waiting tasks of higher priority are run before those of lower priority.
+constexpr int normal_priority = 0;
+constexpr int high_priority = 1;
+constexpr int n_priority = 2;
+
 namespace impl {
 class notification_queue {
 private:
-    // FIFO of pending tasks.
-    std::deque<task> q_tasks_;
+    // FIFO of pending tasks for each priority.
+    std::array<std::deque<task>, n_priority> q_tasks_;
 
     // Lock and signal on task availability change this is the crucial bit.
     mutex q_mutex_;
@@ -40,12 +45,15 @@ private:
 
 public:
     // Pops a task from the task queue returns false when queue is empty.
+    // Tasks of the highest priority are popped first, unless a priority
+    // is given.
     task try_pop();
+    task try_pop(int priority);
     task pop();
 
     // Pushes a task into the task queue and increases task group counter.
-    void push(task&& tsk); // TODO: need to use value?
-    bool try_push(task& tsk);
+    void push(task&& tsk, int priority = normal_priority); // TODO: need to use value?
+    bool try_push(task& tsk, int priority = normal_priority);
 
     // Finish popping all waiting tasks on queue then stop trying to pop new tasks
     void quit();
@@ -79,12 +87,13 @@ public:
     ~task_system();
 
     // Pushes tasks into notification queue.
-    void async(task tsk);
+    void async(task tsk, int priority = normal_priority);
 
     // Runs tasks until quit is true.
     void run_tasks_loop(int i);
 
-    // Request that the task_system attempts to find and run a _single_ task.
+    // Request that the task_system attempts to find and run a _single_ task,
+    // of the highest priority available in any queue.
     // Will return without executing a task if no tasks available.
     void try_run_task();
 
@@ -193,10 +202,10 @@ public:
     }
 
     template<typename F>
-    void run(F&& f) {
+    void run(F&& f, int priority = normal_priority) {
         running_ = true;
         ++in_flight_;
-        task_system_->async(make_wrapped_function(std::forward<F>(f), in_flight_, exception_status_));
+        task_system_->async(make_wrapped_function(std::forward<F>(f), in_flight_, exception_status_), priority);
     }
 
     // Wait till all tasks in this group are done.
@@ -6,6 +6,8 @@
 
 #include <iostream>
 
+#include "memory/huge_pages.hpp"
+
 // Allocator with run-time alignment and padding guarantees.
 //
 // With an alignment value of `n`, any allocations will be
@@ -25,6 +27,9 @@
 // will pass, and the vector `a` will require reallocation.
 // Correspondingly, we have to return `false`
 // for the allocator equality test if the alignments differ.
+//
+// Large allocations may be backed by huge pages, see
+// arb::set_huge_page_threshold().
 
 namespace arb {
 namespace util {
@@ -62,7 +67,7 @@ struct padded_allocator {
         std::size_t size = round_up(n*sizeof(T), alignment_);
         std::size_t pm_align = std::max(alignment_, sizeof(void*));
 
-        if (auto err = posix_memalign(&mem, pm_align, size)) {
+        if (auto err = memory::host_memalign(&mem, pm_align, size)) {
             throw std::system_error(err, std::generic_category(), "posix_memalign");
         }
         return static_cast<pointer>(mem);
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace arbenv {
+
+// Description of the processors and caches of a node, as reported by the
+// Linux sysfs interface in /sys/devices/system/{cpu,node}.
+
+// A logical processor, i.e. a hardware thread.
+struct processor_info {
+    int id = -1;        // Logical processor id, as used in affinity masks.
+    int core = -1;      // Index of the physical core in hardware_topology::cores.
+    int socket = -1;    // Physical package id.
+    int numa_node = -1; // NUMA node, or -1 if unknown.
+};
+
+// A cache instance, shared by one or more logical processors.
+struct cache_info {
+    unsigned level = 0;
+    std::string type;       // "Data", "Instruction" or "Unified".
+    std::size_t size = 0;   // Size in bytes.
+    std::vector<int> processors;
+};
+
+struct hardware_topology {
+    // Online logical processors, in order of id.
+    std::vector<processor_info> processors;
+
+    // Logical processor ids of the SMT siblings of each physical core,
+    // ordered by socket and then by the first sibling.
+    std::vector<std::vector<int>> cores;
+
+    std::vector<cache_info> caches;
+
+    unsigned num_sockets = 0;
+    unsigned num_numa_nodes = 0;
+
+    // Size in bytes of the level 2 data or unified cache of a logical
+    // processor, or 0 if unknown.
+    std::size_t l2_cache_size(int processor) const;
+};
+
+// Read the topology of the node from the sysfs tree under root.
+// Returns an empty topology if the information is not available, for
+// example on non-Linux systems.
+hardware_topology get_topology(const std::string& root = "/sys/devices/system");
+
+// Parse a sysfs cpu list such as "0-3,8,10-11".
+std::vector<int> parse_cpu_list(const std::string& list);
+
+// A suggested thread configuration for a simulation on the node.
+struct resource_allocation {
+    // Number of threads, one per entry in pinning.
+    unsigned num_threads = 1;
+
+    // Number of threads placed on each physical core.
+    unsigned threads_per_core = 1;
+
+    // Logical processor for each thread, ordered by socket and core, so that
+    // consecutive threads share caches where possible.
+    std::vector<int> pinning;
+
+    // Suggested size in bytes of the working set of a cell group, such that
+    // the state of the groups advanced by the threads on a core fit together
+    // in its L2 cache; 0 if the cache size is unknown.
+    std::size_t group_working_set = 0;
+};
+
+// Pick a thread configuration on the available logical processors, placing
+// at most threads_per_core threads on each physical core. Arbor's kernels
+// rarely benefit from simultaneous multithreading, and running more threads
+// than there are available hardware threads is always slower, so by default
+// one thread is used per available physical core.
+//
+// If available is empty, all processors of the topology are used.
+resource_allocation default_allocation(const hardware_topology& topo, const std::vector<int>& available, unsigned threads_per_core = 1);
+
+// As above, for the topology of this node and the processors in the affinity
+// mask of the calling thread (see get_affinity()).
+resource_allocation default_allocation(unsigned threads_per_core = 1);
+
+} // namespace arbenv
@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <arborenv/concurrency.hpp>
+#include <arborenv/topology.hpp>
+
+namespace arbenv {
+
+namespace {
+// First line of a sysfs file, or nothing if it can't be read.
+std::optional<std::string> read_line(const std::string& path) {
+    std::ifstream f(path);
+    std::string line;
+    if (!f || !std::getline(f, line)) return std::nullopt;
+    return line;
+}
+
+int read_int(const std::string& path, int fallback) {
+    auto line = read_line(path);
+    if (!line) return fallback;
+    try {
+        return std::stoi(*line);
+    }
+    catch (...) {
+        return fallback;
+    }
+}
+
+// Cache sizes are given with a unit suffix, e.g. "32K" or "8M".
+std::size_t parse_size(const std::string& s) {
+    std::size_t pos = 0;
+    std::size_t n = 0;
+    try {
+        n = std::stoull(s, &pos);
+    }
+    catch (...) {
+        return 0;
+    }
+    switch (pos<s.size()? s[pos]: ' ') {
+        case 'K': return n<<10;
+        case 'M': return n<<20;
+        case 'G': return n<<30;
+        default:  return n;
+    }
+}
+} // namespace
+
+std::vector<int> parse_cpu_list(const std::string& list) {
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        try {
+            std::size_t pos = 0;
+            int first = std::stoi(range, &pos);
+            int last = first;
+            if (pos<range.size() && range[pos]=='-') {
+                last = std::stoi(range.substr(pos+1));
+            }
+            for (int i = first; i<=last; ++i) {
+                cpus.push_back(i);
+            }
+        }
+        catch (...) {
+            // Skip malformed or empty entries.
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+std::size_t hardware_topology::l2_cache_size(int processor) const {
+    for (auto& c: caches) {
+        if (c.level==2 && c.type!="Instruction" &&
+            std::binary_search(c.processors.begin(), c.processors.end(), processor))
+        {
+            return c.size;
+        }
+    }
+    return 0;
+}
+
+hardware_topology get_topology(const std::string& root) {
+    hardware_topology topo;
+
+    auto online = read_line(root+"/cpu/online");
+    if (!online) return topo;
+
+    const auto cpus = parse_cpu_list(*online);
+    const std::set<int> online_set(cpus.begin(), cpus.end());
+
+    // Physical cores are identified by the socket and the first online SMT
+    // sibling, as core ids are only unique within a socket.
+    std::map<std::pair<int, int>, std::vector<int>> cores;
+    std::map<int, std::pair<int, int>> core_of;
+
+    // Caches are identified by level, type and the processors sharing them.
+    std::set<std::tuple<unsigned, std::string, std::vector<int>>> seen_caches;
+
+    std::set<int> sockets;
+    for (int id: cpus) {
+        const auto dir = root+"/cpu/cpu"+std::to_string(id);
+
+        processor_info p;
+        p.id = id;
+        p.socket = read_int(dir+"/topology/physical_package_id", 0);
+        sockets.insert(p.socket);
+
+        std::vector<int> siblings;
+        if (auto s = read_line(dir+"/topology/thread_siblings_list")) {
+            for (int c: parse_cpu_list(*s)) {
+                if (online_set.count(c)) siblings.push_back(c);
+            }
+        }
+        if (siblings.empty()) siblings = {id};
+
+        auto key = std::make_pair(p.socket, siblings.front());
+        cores[key].push_back(id);
+        core_of[id] = key;
+
+        for (unsigned index = 0;; ++index) {
+            const auto cdir = dir+"/cache/index"+std::to_string(index);
+            int level = read_int(cdir+"/level", -1);
+            if (level<0) break;
+
+            cache_info c;
+            c.level = level;
+            c.type = read_line(cdir+"/type").value_or("Unified");
+            c.size = parse_size(read_line(cdir+"/size").value_or("0"));
+            if (auto s = read_line(cdir+"/shared_cpu_list")) {
+                c.processors = parse_cpu_list(*s);
+            }
+            if (c.processors.empty()) c.processors = {id};
+
+            if (seen_caches.insert({c.level, c.type, c.processors}).second) {
+                topo.caches.push_back(std::move(c));
+            }
+        }
+
+        topo.processors.push_back(p);
+    }
+
+    for (auto& [key, ids]: cores) {
+        topo.cores.push_back(ids);
+    }
+    for (auto& p: topo.processors) {
+        auto it = cores.find(core_of[p.id]);
+        p.core = std::distance(cores.begin(), it);
+    }
+    topo.num_sockets = sockets.size();
+
+    if (auto nodes = read_line(root+"/node/online")) {
+        for (int node: parse_cpu_list(*nodes)) {
+            auto list = read_line(root+"/node/node"+std::to_string(node)+"/cpulist");
+            if (!list) continue;
+
+            ++topo.num_numa_nodes;
+            for (int id: parse_cpu_list(*list)) {
+                for (auto& p: topo.processors) {
+                    if (p.id==id) p.numa_node = node;
+                }
+            }
+        }
+    }
+
+    std::sort(topo.caches.begin(), topo.caches.end(),
+        [](const cache_info& a, const cache_info& b) {
+            return std::tie(a.level, a.processors, a.type)<std::tie(b.level, b.processors, b.type);
+        });
+
+    return topo;
+}
+
+resource_allocation default_allocation(const hardware_topology& topo, const std::vector<int>& available, unsigned threads_per_core) {
+    resource_allocation alloc;
+    threads_per_core = std::max(1u, threads_per_core);
+
+    const std::set<int> avail(available.begin(), available.end());
+    auto is_available = [&](int id) { return avail.empty() || avail.count(id); };
+
+    unsigned max_per_core = 0;
+    for (auto& core: topo.cores) {
+        unsigned n = 0;
+        for (int id: core) {
+            if (n==threads_per_core) break;
+            if (is_available(id)) {
+                alloc.pinning.push_back(id);
+                ++n;
+            }
+        }
+        max_per_core = std::max(max_per_core, n);
+    }
+
+    // Without topology information, use every available processor.
+    if (alloc.pinning.empty()) {
+        alloc.pinning = available;
+        max_per_core = 1;
+    }
+
+    alloc.num_threads = std::max<std::size_t>(1, alloc.pinning.size());
+    alloc.threads_per_core = std::max(1u, max_per_core);
+
+    // The L2 cache of the first thread is shared by the threads pinned to
+    // the processors that share it.
+    if (!alloc.pinning.empty()) {
+        int first = alloc.pinning.front();
+        for (auto& c: topo.caches) {
+            if (c.level!=2 || c.type=="Instruction") continue;
+            if (!std::binary_search(c.processors.begin(), c.processors.end(), first)) continue;
+
+            auto n = std::count_if(alloc.pinning.begin(), alloc.pinning.end(),
+                [&](int id) { return std::binary_search(c.processors.begin(), c.processors.end(), id); });
+            alloc.group_working_set = c.size/n;
+            break;
+        }
+    }
+
+    return alloc;
+}
+
+resource_allocation default_allocation(unsigned threads_per_core) {
+    auto alloc = default_allocation(get_topology(), get_affinity(), threads_per_core);
+    if (alloc.pinning.empty()) {
+        alloc.num_threads = thread_concurrency();
+    }
+    return alloc;
+}
+
+} // namespace arbenv
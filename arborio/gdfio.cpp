@@ -0,0 +1,40 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <arbor/spike.hpp>
+
+#include <arborio/gdfio.hpp>
+
+namespace arborio {
+
+gdf_error::gdf_error(const std::string& msg, unsigned line_number):
+    arbor_exception(msg+": line "+std::to_string(line_number)),
+    line_number(line_number)
+{}
+
+std::vector<arb::spike> parse_gdf(std::istream& in) {
+    std::vector<arb::spike> spikes;
+    std::string line;
+    unsigned line_number = 0;
+
+    while (std::getline(in, line)) {
+        ++line_number;
+
+        auto first = line.find_first_not_of(" \t\r");
+        if (first==std::string::npos || line[first]=='#') continue;
+
+        std::istringstream fields(line);
+        long long gid;
+        double time;
+        if (!(fields >> gid >> time) || gid<0) {
+            throw gdf_error("expected a gid and a spike time", line_number);
+        }
+        spikes.push_back({{arb::cell_gid_type(gid), 0u}, time});
+    }
+
+    return spikes;
+}
+
+} // namespace arborio
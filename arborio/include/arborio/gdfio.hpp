@@ -0,0 +1,24 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <arbor/arbexcept.hpp>
+#include <arbor/spike.hpp>
+
+namespace arborio {
+
+// Spike files in the text format written by the examples, e.g. spikes.gdf:
+// one spike per line, the gid of the source followed by the spike time [ms].
+// Blank lines and lines starting with '#' are ignored.
+
+struct gdf_error: public arb::arbor_exception {
+    gdf_error(const std::string& msg, unsigned line_number);
+    unsigned line_number;
+};
+
+// Spikes are attributed to the source index 0 of their cell.
+std::vector<arb::spike> parse_gdf(std::istream&);
+
+} // namespace arborio
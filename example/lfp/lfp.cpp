@@ -23,11 +23,12 @@ using arb::util::unique_any;
 using arb::cell_gid_type;
 using arb::cell_member_type;
 
-// Recipe represents one cable cell with one synapse, together with probes for total trans-membrane current, membrane voltage,
+// Recipe represents one cable cell with one synapse, together with probes for extracellular potential, membrane voltage,
 // ionic current density, and synaptic conductance. A sequence of spikes are presented to the one synapse on the cell.
 
 struct lfp_demo_recipe: public arb::recipe {
-    explicit lfp_demo_recipe(arb::event_generator events): events_(std::move(events))
+    lfp_demo_recipe(arb::event_generator events, std::vector<arb::mpoint> electrodes, double sigma):
+        events_(std::move(events)), electrodes_(std::move(electrodes)), sigma_(sigma)
     {
         make_cell(); // initializes cell_ and synapse_location_.
     }
@@ -37,12 +38,12 @@ struct lfp_demo_recipe: public arb::recipe {
 
     std::vector<arb::probe_info> get_probes(cell_gid_type) const override {
         // Four probes:
-        //   0. Total membrane current across cell.
+        //   0. Extracellular potential at each electrode.
         //   1. Voltage at synapse location.
         //   2. Total ionic current density at synapse location.
         //   3. Expsyn synapse conductance value.
         return {
-            arb::cable_probe_total_current_cell{},
+            arb::cable_probe_extracellular_potential{electrodes_, sigma_},
             arb::cable_probe_membrane_voltage{synapse_location_},
             arb::cable_probe_total_ion_current_density{synapse_location_},
             arb::cable_probe_point_state{0, "expsyn", "g"}};
@@ -70,6 +71,8 @@ private:
     arb::cable_cell cell_;
     arb::locset synapse_location_;
     arb::event_generator events_;
+    std::vector<arb::mpoint> electrodes_;
+    double sigma_;
 
     void make_cell() {
         using namespace arb;
@@ -101,38 +104,13 @@ private:
     }
 };
 
-struct position { double x, y, z; };
-
 struct lfp_sampler {
-    lfp_sampler(const arb::place_pwlin& placement, const arb::mcable_list& cables, const std::vector<position>& electrodes, double sigma) {
-        // Compute response coefficients for each electrode, given a set of cable-like sources.
-        const unsigned n_electrode = electrodes.size();
-        response.assign(n_electrode, std::vector<double>(cables.size()));
-
-        std::vector<arb::mpoint> midpoints;
-        std::transform(cables.begin(), cables.end(), std::back_inserter(midpoints),
-            [&placement](const auto& c) { return placement.at({c.branch, 0.5*(c.prox_pos+c.dist_pos)}); });
-
-        const double coef = 1/(4*M_PI*sigma); // [Ω·m]
-        for (unsigned i = 0; i<n_electrode; ++i) {
-            const position& e = electrodes[i];
-
-            std::transform(midpoints.begin(), midpoints.end(), response[i].begin(),
-                [coef, &e](auto p) {
-                    p.x -= e.x;
-                    p.y -= e.y;
-                    p.z -= e.z;
-                    double r = std::sqrt(p.x*p.x+p.y*p.y+p.z*p.z); // [μm]
-                    return coef/r; // [MΩ]
-                });
-        }
-    }
-
-    // On receipt of a sequence of cell-wide current samples, apply response matrix and save results to lfp_voltage.
+    // On receipt of a sequence of extracellular potential samples, save results to lfp_voltage.
     arb::sampler_function callback() {
         return [this](arb::probe_metadata pm, std::size_t n, const arb::sample_record* samples) {
-            std::vector<double> currents;
-            lfp_voltage.resize(response.size());
+            auto electrodes = any_cast<const std::vector<arb::mpoint>*>(pm.meta);
+            assert(electrodes);
+            lfp_voltage.resize(electrodes->size());
 
             for (std::size_t i = 0; i<n; ++i) {
                 lfp_time.push_back(samples[i].time);
@@ -140,8 +118,8 @@ struct lfp_sampler {
                 auto data_ptr = any_cast<const arb::cable_sample_range*>(samples[i].data);
                 assert(data_ptr);
 
-                for (unsigned j = 0; j<response.size(); ++j) {
-                    lfp_voltage[j].push_back(std::inner_product(data_ptr->first, data_ptr->second, response[j].begin(), 0.));
+                for (unsigned j = 0; j<lfp_voltage.size(); ++j) {
+                    lfp_voltage[j].push_back(data_ptr->first[j]);
                 }
             }
         };
@@ -149,9 +127,6 @@ struct lfp_sampler {
 
     std::vector<double> lfp_time;
     std::vector<std::vector<double>> lfp_voltage; // [mV] (one vector per electrode)
-
-private:
-    std::vector<std::vector<double>> response; // [MΩ]
 };
 
 // JSON output helpers:
@@ -188,7 +163,11 @@ int main(int argc, char** argv) {
 
     // Weight 0.005 μS, onset at t = 0 ms, mean frequency 0.1 kHz.
     auto events = arb::poisson_generator({0, 0}, .005, 0., 0.1, std::minstd_rand{});
-    lfp_demo_recipe R(events);
+    std::vector<arb::mpoint> electrodes = {
+        {30, 0, 0, 0},
+        {30, 0, 100, 0}
+    };
+    lfp_demo_recipe R(events, electrodes, 3.0);
 
     const double t_stop = 100;    // [ms]
     const double sample_dt = 0.1; // [ms]
@@ -196,19 +175,10 @@ int main(int argc, char** argv) {
 
     arb::simulation sim(R, arb::partition_load_balance(R, context), context);
 
-    std::vector<position> electrodes = {
-        {30, 0, 0},
-        {30, 0, 100}
-    };
-
     arb::morphology cell_morphology = any_cast<arb::cable_cell>(R.get_cell_description(0)).morphology();
     arb::place_pwlin placed_cell(cell_morphology);
 
-    auto probe0_metadata = sim.get_probe_metadata(cell_member_type{0, 0});
-    assert(probe0_metadata.size()==1); // Should only be one probe associated with this id.
-    arb::mcable_list current_cables = *any_cast<const arb::mcable_list*>(probe0_metadata.at(0).meta);
-
-    lfp_sampler lfp(placed_cell, current_cables, electrodes, 3.0);
+    lfp_sampler lfp;
 
     auto sample_schedule = arb::regular_schedule(sample_dt);
     sim.add_sampler(arb::one_probe({0, 0}), sample_schedule, lfp.callback(), arb::sampling_policy::exact);
@@ -115,20 +115,27 @@ std::ostream& operator<<(std::ostream& out, const printer_options& popt) {
         table_prefix{"simd"} << popt.simd << line_end;
 }
 
-std::istream& operator>> (std::istream& i, simd_spec& spec) {
-    auto npos = std::string::npos;
-    std::string s;
-    i >> s;
+// Parse a SIMD ABI name with an optional /n width suffix, e.g. 'avx2' or
+// 'native/4'.
+to::maybe<simd_spec> parse_simd_spec(const char* text) {
+    std::string s(text);
     unsigned width = no_size;
 
     auto suffix = s.find_last_of('/');
-    if (suffix!=npos) {
-        width = stoul(s.substr(suffix+1));
+    if (suffix!=std::string::npos) {
+        auto w = s.substr(suffix+1);
+        if (w.empty() || w.find_first_not_of("0123456789")!=std::string::npos) {
+            return to::nothing;
+        }
+        width = std::stoul(w);
         s = s.substr(0, suffix);
     }
 
-    spec = simd_spec(simdAbiMap.at(s.c_str()), width);
-    return i;
+    auto abi = simdAbiMap.find(s);
+    if (abi==simdAbiMap.end()) {
+        return to::nothing;
+    }
+    return simd_spec(abi->second, width);
 }
 
 const char* usage_str =
@@ -174,7 +181,7 @@ int main(int argc, char **argv) {
                 { to::set(popt.profile), to::flag,   "-P", "--profile" },
                 { popt.cpp_namespace,                "-N", "--namespace" },
                 { to::action(enable_simd), to::flag, "-s", "--simd" },
-                { popt.simd,                         "-S", "--simd-abi" },
+                { to::sink(popt.simd, parse_simd_spec), "-S", "--simd-abi" },
                 { {to::action(add_target, to::keywords(targetKindMap))}, "-t", "--target" },
                 { to::action(help), to::flag, to::exit,    "-h", "--help" }
         };
@@ -37,8 +37,11 @@ void emit_procedure_proto(std::ostream&, ProcedureExpression*, const std::string
 void emit_simd_procedure_proto(std::ostream&, ProcedureExpression*, const std::string& qualified = "");
 void emit_masked_simd_procedure_proto(std::ostream&, ProcedureExpression*, const std::string& qualified = "");
 
-void emit_api_body(std::ostream&, APIMethod*);
+void emit_api_body(std::ostream&, APIMethod*, bool ranged = false);
 void emit_simd_api_body(std::ostream&, APIMethod*, const std::vector<VariableExpression*>& scalars);
+void emit_simd_deliver_events_batch(std::ostream&, const std::string& weight_arg,
+                                    const std::vector<net_receive_increment>& increments,
+                                    const std::vector<VariableExpression*>& scalars);
 
 void emit_simd_index_initialize(std::ostream& out, const std::list<index_prop>& indices, simd_expr_constraint constraint);
 
@@ -151,6 +154,7 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
 
     out <<
         "#include <algorithm>\n"
+        "#include <cfloat>\n"
         "#include <cmath>\n"
         "#include <cstddef>\n"
         "#include <memory>\n"
@@ -250,6 +254,15 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
         "void nrn_current() override;\n"
         "void write_ions() override;\n";
 
+    // Scalar kernels can also be run over sub-ranges of instances by the
+    // thread team of a cell group.
+    !with_simd && out <<
+        "\n"
+        "bool has_range_kernels() const override { return true; }\n"
+        "void nrn_state_range(size_type begin_, size_type end_) override;\n"
+        "void nrn_current_range(size_type begin_, size_type end_) override;\n"
+        "void write_ions_range(size_type begin_, size_type end_) override;\n";
+
     net_receive && out <<
         "void deliver_events(deliverable_event_stream::state events) override;\n"
         "void net_receive(int i_, value_type weight);\n";
@@ -372,15 +385,25 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
     if (net_receive) {
         const std::string weight_arg = net_receive->args().empty() ? "weight" : net_receive->args().front()->is_argument()->name();
         out <<
-            "void " << class_name << "::deliver_events(deliverable_event_stream::state events) {\n" << indent <<
-            "auto ncell = events.n_streams();\n"
-            "for (size_type c = 0; c<ncell; ++c) {\n" << indent <<
-            "auto begin = events.begin_marked(c);\n"
-            "auto end = events.end_marked(c);\n"
-            "for (auto p = begin; p<end; ++p) {\n" << indent <<
-            "if (p->mech_id==mechanism_id_) net_receive(p->mech_index, p->weight);\n" << popindent <<
-            "}\n" << popindent <<
-            "}\n" << popindent <<
+            "void " << class_name << "::deliver_events(deliverable_event_stream::state events) {\n" << indent;
+
+        auto increments = net_receive_increments(net_receive);
+        if (with_simd && !increments.empty()) {
+            emit_simd_deliver_events_batch(out, weight_arg, increments, vars.scalars);
+        }
+        else {
+            out <<
+                "auto ncell = events.n_streams();\n"
+                "for (size_type c = 0; c<ncell; ++c) {\n" << indent <<
+                "auto begin = events.begin_marked(c);\n"
+                "auto end = events.end_marked(c);\n"
+                "for (auto p = begin; p<end; ++p) {\n" << indent <<
+                "net_receive(p->mech_index, p->weight);\n" << popindent <<
+                "}\n" << popindent <<
+                "}\n";
+        }
+
+        out << popindent <<
             "}\n"
             "\n"
             "void " << class_name << "::net_receive(int i_, value_type " << weight_arg << ") {\n" << indent <<
@@ -401,21 +424,52 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
     emit_body(init_api);
     out << popindent << "}\n\n";
 
-    out << "void " << class_name << "::nrn_state() {\n" << indent;
-    out << profiler_enter("advance_integrate_state");
-    emit_body(state_api);
-    out << profiler_leave();
-    out << popindent << "}\n\n";
-
-    out << "void " << class_name << "::nrn_current() {\n" << indent;
-    out << profiler_enter("advance_integrate_current");
-    emit_body(current_api);
-    out << profiler_leave();
-    out << popindent << "}\n\n";
-
-    out << "void " << class_name << "::write_ions() {\n" << indent;
-    emit_body(write_ions_api);
-    out << popindent << "}\n\n";
+    if (with_simd) {
+        out << "void " << class_name << "::nrn_state() {\n" << indent;
+        out << profiler_enter("advance_integrate_state");
+        emit_body(state_api);
+        out << profiler_leave();
+        out << popindent << "}\n\n";
+
+        out << "void " << class_name << "::nrn_current() {\n" << indent;
+        out << profiler_enter("advance_integrate_current");
+        emit_body(current_api);
+        out << profiler_leave();
+        out << popindent << "}\n\n";
+
+        out << "void " << class_name << "::write_ions() {\n" << indent;
+        emit_body(write_ions_api);
+        out << popindent << "}\n\n";
+    }
+    else {
+        out << "void " << class_name << "::nrn_state() {\n" << indent;
+        out << profiler_enter("advance_integrate_state");
+        out << "nrn_state_range(0, width_);\n";
+        out << profiler_leave();
+        out << popindent << "}\n\n";
+
+        out << "void " << class_name << "::nrn_current() {\n" << indent;
+        out << profiler_enter("advance_integrate_current");
+        out << "nrn_current_range(0, width_);\n";
+        out << profiler_leave();
+        out << popindent << "}\n\n";
+
+        out << "void " << class_name << "::write_ions() {\n" << indent;
+        out << "write_ions_range(0, width_);\n";
+        out << popindent << "}\n\n";
+
+        out << "void " << class_name << "::nrn_state_range(size_type begin_, size_type end_) {\n" << indent;
+        emit_api_body(out, state_api, true);
+        out << popindent << "}\n\n";
+
+        out << "void " << class_name << "::nrn_current_range(size_type begin_, size_type end_) {\n" << indent;
+        emit_api_body(out, current_api, true);
+        out << popindent << "}\n\n";
+
+        out << "void " << class_name << "::write_ions_range(size_type begin_, size_type end_) {\n" << indent;
+        emit_api_body(out, write_ions_api, true);
+        out << popindent << "}\n\n";
+    }
 
     // Mechanism procedures
 
@@ -555,7 +609,9 @@ void emit_state_update(std::ostream& out, Symbol* from, IndexedVariable* externa
     }
 }
 
-void emit_api_body(std::ostream& out, APIMethod* method) {
+// Emit the loop over instances of an API method; if ranged, over the
+// instances [begin_, end_) only.
+void emit_api_body(std::ostream& out, APIMethod* method, bool ranged) {
     auto body = method->body();
     auto indexed_vars = indexed_locals(method->scope());
 
@@ -576,8 +632,8 @@ void emit_api_body(std::ostream& out, APIMethod* method) {
 
     if (!body->statements().empty()) {
         out <<
-            "int n_ = width_;\n"
-            "for (int i_ = 0; i_ < n_; ++i_) {\n" << indent;
+            "int n_ = " << (ranged? "end_": "width_") << ";\n"
+            "for (int i_ = " << (ranged? "begin_": "0") << "; i_ < n_; ++i_) {\n" << indent;
 
         for (auto index: indices) {
             out << "auto " << index_i_name(index.source_var) << " = " << index.source_var << "[" << index.index_name << "];\n";
@@ -698,6 +754,96 @@ void SimdPrinter::visit(BlockExpression* block) {
     }
 }
 
+// Prints expressions for a batch of events, with range variables gathered
+// through the mechanism instance indices of the events in index_.
+
+class SimdEventPrinter: public SimdPrinter {
+public:
+    SimdEventPrinter(std::ostream& out): SimdPrinter(out), out_(out) {}
+
+    using SimdPrinter::visit;
+
+    void visit(VariableExpression* sym) override {
+        if (sym->is_range()) {
+            out_ << "simd_cast<simd_value>(indirect(" << sym->name() << ", index_, simd_width_))";
+        }
+        else {
+            out_ << sym->name();
+        }
+    }
+
+private:
+    std::ostream& out_;
+};
+
+void emit_simd_deliver_events_batch(std::ostream& out, const std::string& weight_arg,
+                                    const std::vector<net_receive_increment>& increments,
+                                    const std::vector<VariableExpression*>& scalars)
+{
+    std::unordered_set<std::string> scalar_names;
+    for (auto& s: scalars) {
+        scalar_names.insert(s->name());
+    }
+
+    // The marked events of all streams are staged simd_width_ at a time. A
+    // full batch in which every event has a different target is delivered
+    // with one gather and scatter per increment. A batch with repeated
+    // targets, and the events left over at the end, are delivered one at a
+    // time, so that each instance sees its events added in the same order
+    // as with scalar delivery.
+
+    out <<
+        "index_type event_index_[simd_width_] = {};\n"
+        "value_type event_weight_[simd_width_] = {};\n"
+        "unsigned n_ = 0;\n"
+        "auto ncell = events.n_streams();\n"
+        "for (size_type c = 0; c<ncell; ++c) {\n" << indent <<
+        "auto begin = events.begin_marked(c);\n"
+        "auto end = events.end_marked(c);\n"
+        "for (auto p = begin; p<end; ++p) {\n" << indent <<
+        "event_index_[n_] = p->mech_index;\n"
+        "event_weight_[n_] = p->weight;\n"
+        "if (++n_<simd_width_) continue;\n"
+        "n_ = 0;\n"
+        "\n"
+        "bool independent_ = true;\n"
+        "for (unsigned j_ = 1; j_<simd_width_; ++j_) {\n" << indent <<
+        "for (unsigned k_ = 0; k_<j_; ++k_) {\n" << indent <<
+        "independent_ &= event_index_[j_]!=event_index_[k_];\n" << popindent <<
+        "}\n" << popindent <<
+        "}\n"
+        "if (!independent_) {\n" << indent <<
+        "for (unsigned j_ = 0; j_<simd_width_; ++j_) {\n" << indent <<
+        "net_receive(event_index_[j_], event_weight_[j_]);\n" << popindent <<
+        "}\n"
+        "continue;\n" << popindent <<
+        "}\n"
+        "\n"
+        "simd_index index_;\n"
+        "assign(index_, indirect(event_index_, simd_width_));\n"
+        "simd_value " << weight_arg << ";\n"
+        "assign(" << weight_arg << ", indirect(event_weight_, simd_width_));\n";
+
+    for (auto& inc: increments) {
+        SimdEventPrinter printer(out);
+        printer.save_scalar_names(scalar_names);
+
+        bool cast = inc.increment->is_number() ||
+            (inc.increment->is_identifier() && scalar_names.count(inc.increment->is_identifier()->name()));
+
+        out << "indirect(" << inc.target->name() << ", index_, simd_width_, index_constraint::independent) += ";
+        if (cast) out << "simd_cast<simd_value>(";
+        inc.increment->accept(&printer);
+        if (cast) out << ")";
+        out << ";\n";
+    }
+
+    out << popindent << "}\n" << popindent << "}\n"
+        "for (unsigned j_ = 0; j_<n_; ++j_) {\n" << indent <<
+        "net_receive(event_index_[j_], event_weight_[j_]);\n" << popindent <<
+        "}\n";
+}
+
 void emit_simd_procedure_proto(std::ostream& out, ProcedureExpression* e, const std::string& qualified) {
     out << "void " << qualified << (qualified.empty()? "": "::") << e->name() << "(index_type i_";
     for (auto& arg: e->args()) {
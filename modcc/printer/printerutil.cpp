@@ -5,6 +5,8 @@
 #include "expression.hpp"
 #include "module.hpp"
 #include "printerutil.hpp"
+#include "symdiff.hpp"
+#include "visitor.hpp"
 
 std::vector<std::string> namespace_components(const std::string& ns) {
     static std::regex ns_regex("([^:]+)(?:::|$)");
@@ -113,6 +115,78 @@ NetReceiveExpression* find_net_receive(const Module& m) {
     return it==m.symbols().end()? nullptr: it->second->is_net_receive();
 }
 
+namespace {
+// Checks that an expression is built only from numbers, arguments, module
+// variables and arithmetic.
+struct increment_checker: public Visitor {
+    bool ok = true;
+
+    void visit(Expression*) override { ok = false; }
+    void visit(NumberExpression*) override {}
+    void visit(UnaryExpression* e) override { e->expression()->accept(this); }
+    void visit(ConditionalExpression*) override { ok = false; }
+
+    void visit(BinaryExpression* e) override {
+        e->lhs()->accept(this);
+        e->rhs()->accept(this);
+    }
+
+    void visit(IdentifierExpression* e) override {
+        auto sym = e->symbol();
+        if (!sym) {
+            ok = false;
+        }
+        else if (auto local = sym->is_local_variable()) {
+            ok = ok && local->is_arg();
+        }
+        else if (!sym->is_variable()) {
+            ok = false;
+        }
+    }
+};
+}
+
+std::vector<net_receive_increment> net_receive_increments(NetReceiveExpression* net_receive) {
+    std::vector<net_receive_increment> incs;
+    if (!net_receive || !net_receive->body()) return {};
+
+    for (auto& s: net_receive->body()->statements()) {
+        auto assign = s->is_assignment();
+        if (!assign) return {};
+
+        auto lhs = assign->lhs()->is_identifier();
+        auto target = lhs && lhs->symbol()? lhs->symbol()->is_variable(): nullptr;
+        if (!target || !target->is_range()) return {};
+
+        auto sum = assign->rhs()->is_binary();
+        if (!sum || sum->op()!=tok::plus) return {};
+
+        auto is_target = [&](Expression* e) {
+            auto id = e->is_identifier();
+            return id && id->name()==target->name();
+        };
+
+        Expression* inc = is_target(sum->lhs())? sum->rhs():
+                          is_target(sum->rhs())? sum->lhs(): nullptr;
+        if (!inc) return {};
+
+        increment_checker check;
+        inc->accept(&check);
+        if (!check.ok) return {};
+
+        incs.push_back({target, inc});
+    }
+
+    identifier_set targets;
+    for (auto& i: incs) {
+        targets.push_back(i.target->name());
+    }
+    for (auto& i: incs) {
+        if (involves_identifier(i.increment, targets)) return {};
+    }
+    return incs;
+}
+
 indexed_variable_info decode_indexed_variable(IndexedVariable* sym) {
     indexed_variable_info v;
     v.node_index_var = "node_index_";
@@ -114,6 +114,21 @@ APIMethod* find_api_method(const Module& m, const char* which);
 
 NetReceiveExpression* find_net_receive(const Module& m);
 
+// A NET_RECEIVE block is accumulate-only if every statement has the form
+// `x = x + e`, where x is a range variable and e does not depend on any of
+// the variables assigned in the block. The increments e for a batch of events
+// can then be evaluated together and summed into their variables in any order.
+
+struct net_receive_increment {
+    VariableExpression* target;
+    Expression* increment;
+};
+
+// Increments of an accumulate-only NET_RECEIVE block, in statement order;
+// empty if the block is not accumulate-only.
+
+std::vector<net_receive_increment> net_receive_increments(NetReceiveExpression*);
+
 struct indexed_variable_info {
     std::string data_var;
     std::string node_index_var;
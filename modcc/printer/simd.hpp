@@ -43,6 +43,10 @@ struct simd_spec {
         case sve:
             size = 0;
             break;
+        case default_abi:
+            // The generic implementation can take any size: match the width.
+            size = width;
+            break;
         default: ;
         }
 
@@ -1,4 +1,5 @@
 #include <string>
+#include <vector>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
@@ -115,6 +116,11 @@ struct recorder_cable_vector_point_info: recorder_cable_vector<std::vector<arb::
         recorder_cable_vector(meta_ptr, std::ptrdiff_t(meta_ptr->size())) {}
 };
 
+struct recorder_cable_vector_mpoint: recorder_cable_vector<std::vector<arb::mpoint>> {
+    explicit recorder_cable_vector_mpoint(const std::vector<arb::mpoint>* meta_ptr):
+        recorder_cable_vector(meta_ptr, std::ptrdiff_t(meta_ptr->size())) {}
+};
+
 // Helper for registering sample recorder factories and (trivial) metadata conversions.
 
 template <typename Meta, typename Recorder>
@@ -157,6 +163,10 @@ arb::probe_info cable_probe_total_current_cell() {
     return arb::cable_probe_total_current_cell{};
 }
 
+arb::probe_info cable_probe_extracellular_potential(std::vector<arb::mpoint> electrodes, double conductivity) {
+    return arb::cable_probe_extracellular_potential{std::move(electrodes), conductivity};
+}
+
 arb::probe_info cable_probe_density_state(const char* where, const char* mechanism, const char* state) {
     return arb::cable_probe_density_state{arb::locset(where), mechanism, state};
 };
@@ -243,6 +253,11 @@ void register_cable_probes(pybind11::module& m, pyarb_global_ptr global_ptr) {
     m.def("cable_probe_total_current_cell", &cable_probe_total_current_cell,
         "Probe specification for cable cell total transmembrane current for each cable in each CV.");
 
+    m.def("cable_probe_extracellular_potential", &cable_probe_extracellular_potential,
+        "Probe specification for the extracellular potential [mV] at each electrode position due to the\n"
+        "transmembrane currents of the cell, in a homogeneous medium of given conductivity [S/m].",
+        "electrodes"_a, "conductivity"_a=0.3);
+
     m.def("cable_probe_density_state", &cable_probe_density_state,
         "Probe specification for a cable cell density mechanism state variable at points in a location set.",
         "where"_a, "mechanism"_a, "state"_a);
@@ -289,6 +304,7 @@ void register_cable_probes(pybind11::module& m, pyarb_global_ptr global_ptr) {
     register_probe_meta_maps<arb::cable_probe_point_info, recorder_cable_scalar_point_info>(global_ptr);
     register_probe_meta_maps<arb::mcable_list, recorder_cable_vector_mcable>(global_ptr);
     register_probe_meta_maps<std::vector<arb::cable_probe_point_info>, recorder_cable_vector_point_info>(global_ptr);
+    register_probe_meta_maps<std::vector<arb::mpoint>, recorder_cable_vector_mpoint>(global_ptr);
 }
 
 } // namespace pyarb
@@ -476,6 +476,10 @@ void register_cells(pybind11::module& m) {
             "specific regions using the paint interface, while the method for calculating\n"
             "reversal potential is global for all compartments in the cell, and can't be\n"
             "overriden locally.")
+        .def_readwrite("fuse_single_cv_integration", &arb::cable_cell_global_properties::fuse_single_cv_integration,
+            "Integrate cell groups in which every cell has a single CV in one fused pass over the CVs, where supported.")
+        .def_readwrite("discretization_cache_dir", &arb::cable_cell_global_properties::discretization_cache_dir,
+            "If not empty, an existing directory in which the discretization of each cell is cached for reuse in later runs.")
         .def("register", [](arb::cable_cell_global_properties& props, const arb::mechanism_catalogue& cat) {
                 props.catalogue = &cat;
             },
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
@@ -54,6 +55,24 @@ class simulation_shim {
 
     std::unordered_map<arb::sampler_association_handle, sampler_callback> sampler_map_;
 
+    // Optional Python callback, invoked with the spikes recorded since its
+    // previous invocation after each batch_interval_ [ms] of a run, or only at
+    // the end of a run if the interval is zero. Spikes and samples are
+    // gathered in C++ buffers while the simulation runs without the GIL,
+    // which is taken only to invoke the callback between batches.
+    py::object batch_callback_;
+    arb::time_type batch_interval_ = 0;
+    std::size_t spikes_reported_ = 0;
+    arb::time_type time_ = 0;
+
+    void report_batch() {
+        py::gil_scoped_acquire guard;
+        auto n = spike_record_.size()-spikes_reported_;
+        py::array_t<arb::spike> spikes(py::ssize_t(n), spike_record_.data()+spikes_reported_);
+        spikes_reported_ = spike_record_.size();
+        batch_callback_(time_, spikes);
+    }
+
 public:
     simulation_shim(std::shared_ptr<py_recipe>& rec, const arb::domain_decomposition& decomp, const context_shim& ctx, pyarb_global_ptr global_ptr):
         global_ptr_(global_ptr)
@@ -70,6 +89,8 @@ public:
     void reset() {
         sim_->reset();
         spike_record_.clear();
+        spikes_reported_ = 0;
+        time_ = 0;
         for (auto&& [handle, cb]: sampler_map_) {
             for (auto& rec: *cb.recorders) {
                 rec->reset();
@@ -78,13 +99,42 @@ public:
     }
 
     arb::time_type run(arb::time_type tfinal, arb::time_type dt) {
-        return sim_->run(tfinal, dt);
+        if (!batch_callback_) {
+            return time_ = sim_->run(tfinal, dt);
+        }
+
+        while (time_<tfinal) {
+            auto tuntil = batch_interval_>0? std::min(tfinal, time_+batch_interval_): tfinal;
+            time_ = sim_->run(tuntil, dt);
+            report_batch();
+        }
+        return time_;
+    }
+
+    void set_batch_callback(py::object callback, arb::time_type interval) {
+        if (interval<0) {
+            throw pyarb_error("batch interval must be non-negative");
+        }
+        batch_callback_ = callback.is_none()? py::object{}: std::move(callback);
+        batch_interval_ = interval;
     }
 
     void set_binning_policy(arb::binning_kind policy, arb::time_type bin_interval) {
         sim_->set_binning_policy(policy, bin_interval);
     }
 
+    void set_compact_spike_exchange(bool enable, arb::time_type resolution) {
+        sim_->set_compact_spike_exchange(enable, resolution);
+    }
+
+    void set_node_spike_exchange(bool enable) {
+        sim_->set_node_spike_exchange(enable);
+    }
+
+    void set_deterministic(bool enable) {
+        sim_->set_deterministic(enable);
+    }
+
     void record(spike_recording policy) {
         auto spike_recorder = [this](const std::vector<arb::spike>& spikes) {
             spike_record_.insert(spike_record_.end(), spikes.begin(), spikes.end());
@@ -199,6 +249,20 @@ void register_simulation(pybind11::module& m, pyarb_global_ptr global_ptr) {
         .def("set_binning_policy", &simulation_shim::set_binning_policy,
             "Set the binning policy for event delivery, and the binning time interval if applicable [ms].",
             "policy"_a, "bin_interval"_a)
+        .def("set_compact_spike_exchange", &simulation_shim::set_compact_spike_exchange,
+            "Exchange spikes between domains in a compact format, with spike times rounded to multiples of resolution [ms] (exact if zero).",
+            "enable"_a, "resolution"_a=0.)
+        .def("set_node_spike_exchange", &simulation_shim::set_node_spike_exchange,
+            "Exchange spikes in two levels when MPI ranks share a node, with one rank per node taking part in the exchange between nodes.",
+            "enable"_a)
+        .def("set_deterministic", &simulation_shim::set_deterministic,
+            "Record and export spikes sorted by time and then by source, in an order that does not depend on the number of threads or the decomposition.",
+            "enable"_a)
+        .def("set_batch_callback", &simulation_shim::set_batch_callback,
+            "Call callback(time, spikes) with the time [ms] and the spikes recorded since the previous call,\n"
+            "after every interval [ms] of a run, or at the end of each run if interval is zero.\n"
+            "The callback is removed if it is None.",
+            "callback"_a, "interval"_a=0.)
         .def("record", &simulation_shim::record,
             "Disable or enable local or global spike recording.")
         .def("spikes", &simulation_shim::spikes,
@@ -1,9 +1,11 @@
 #include <any>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -43,17 +45,23 @@ struct trace {
 };
 
 // Callback provided to sampling API that records into a trace variable.
+// Each run of the model records into a fresh trace, so that traces returned
+// to the user from earlier runs are left untouched.
 struct trace_callback {
-    trace& trace_;
+    std::vector<std::shared_ptr<trace>>& traces_;
+    std::size_t index_;
 
-    trace_callback(trace& t): trace_(t) {}
+    trace_callback(std::vector<std::shared_ptr<trace>>& traces, std::size_t index):
+        traces_(traces), index_(index) {}
 
     void operator()(arb::probe_metadata, std::size_t n, const arb::sample_record* recs) {
-        // Push each (time, value) pair from the last epoch into trace_.
+        trace& tr = *traces_[index_];
+
+        // Push each (time, value) pair from the last epoch into the trace.
         for (std::size_t i=0; i<n; ++i) {
             if (auto p = any_cast<const double*>(recs[i].data)) {
-                trace_.t.push_back(recs[i].time);
-                trace_.v.push_back(*p);
+                tr.t.push_back(recs[i].time);
+                tr.v.push_back(*p);
             }
             else {
                 throw std::runtime_error("unexpected sample type");
@@ -136,26 +144,66 @@ struct single_cell_recipe: arb::recipe {
     }
 };
 
+// The model is instantiated as an arb::simulation on the first call to run,
+// and reused by subsequent runs, which only reset the simulation. Changes to
+// the probes, global properties or catalogue discard the simulation, so that
+// it is instantiated again on the next run; mechanism parameter overrides
+// are applied in place.
 class single_cell_model {
     arb::cable_cell cell_;
     arb::context ctx_;
-    bool run_ = false;
 
     std::vector<probe_site> probes_;
     std::unique_ptr<arb::simulation> sim_;
     std::vector<double> spike_times_;
     // Create one trace for each probe.
-    std::vector<trace> traces_;
+    std::vector<std::shared_ptr<trace>> traces_;
 
-public:
-    arb::cable_cell_global_properties gprop;
-    arb::mechanism_catalogue cat;
+    // Mechanism parameter overrides (mechanism, parameter, value), in the order set.
+    std::vector<std::tuple<std::string, std::string, double>> mech_params_;
+
+    arb::cable_cell_global_properties gprop_;
+    arb::mechanism_catalogue cat_;
+
+    void instantiate() {
+        gprop_.catalogue = &cat_;
+        single_cell_recipe rec(cell_, probes_, gprop_);
+
+        auto domdec = arb::partition_load_balance(rec, ctx_);
+
+        sim_ = std::make_unique<arb::simulation>(rec, domdec, ctx_);
+
+        traces_.assign(probes_.size(), nullptr);
+
+        // Add probes
+        for (arb::cell_lid_type i=0; i<probes_.size(); ++i) {
+            const auto& p = probes_[i];
+
+            auto sched = arb::regular_schedule(1000./p.frequency);
+
+            // Now attach the sampler at probe site, with sampling schedule sched, writing to voltage
+            sim_->add_sampler(arb::one_probe({0,i}), sched, trace_callback(traces_, i));
+        }
+
+        // Set callback that records spike times.
+        sim_->set_global_spike_callback(
+            [this](const std::vector<arb::spike>& spikes) {
+                for (auto& s: spikes) {
+                    spike_times_.push_back(s.time);
+                }
+            });
+
+        for (auto& [mech, param, value]: mech_params_) {
+            sim_->set_mechanism_parameter(mech, param, value);
+        }
+    }
 
+public:
     single_cell_model(arb::cable_cell c):
         cell_(std::move(c)), ctx_(arb::make_context())
     {
-        gprop.default_parameters = arb::neuron_parameter_defaults;
-        cat = arb::global_default_catalogue();
+        gprop_.default_parameters = arb::neuron_parameter_defaults;
+        cat_ = arb::global_default_catalogue();
     }
 
     // example use:
@@ -175,62 +223,78 @@ public:
         for (auto& l: cell_.concrete_locset(where)) {
             probes_.push_back({l, frequency});
         }
+        sim_.reset();
     }
 
-    void run(double tfinal, double dt) {
-        gprop.catalogue = &cat;
-        single_cell_recipe rec(cell_, probes_, gprop);
-
-        auto domdec = arb::partition_load_balance(rec, ctx_);
-
-        sim_ = std::make_unique<arb::simulation>(rec, domdec, ctx_);
-
-        // Create one trace for each probe.
-        traces_.reserve(probes_.size());
-
-        // Add probes
-        for (arb::cell_lid_type i=0; i<probes_.size(); ++i) {
-            const auto& p = probes_[i];
-
-            traces_.push_back({"voltage", p.site, {}, {}});
-
-            auto sched = arb::regular_schedule(1000./p.frequency);
+    // Override a parameter or global of a mechanism on the whole cell.
+    void set_parameter(const std::string& mechanism, const std::string& parameter, double value) {
+        if (sim_) {
+            sim_->set_mechanism_parameter(mechanism, parameter, value);
+        }
+        mech_params_.emplace_back(mechanism, parameter, value);
+    }
 
-            // Now attach the sampler at probe site, with sampling schedule sched, writing to voltage
-            sim_->add_sampler(arb::one_probe({0,i}), sched, trace_callback(traces_[i]));
+    void run(double tfinal, double dt) {
+        if (sim_) {
+            sim_->reset();
+        }
+        else {
+            instantiate();
         }
 
-        // Set callback that records spike times.
-        sim_->set_global_spike_callback(
-            [this](const std::vector<arb::spike>& spikes) {
-                for (auto& s: spikes) {
-                    spike_times_.push_back(s.time);
-                }
-            });
+        spike_times_.clear();
+        for (std::size_t i=0; i<probes_.size(); ++i) {
+            traces_[i] = std::make_shared<trace>(trace{"voltage", probes_[i].site, {}, {}});
+        }
 
         sim_->run(tfinal, dt);
-
-        run_ = true;
     }
 
     const std::vector<double>& spike_times() const {
         return spike_times_;
     }
 
-    const std::vector<trace>& traces() const {
+    const std::vector<std::shared_ptr<trace>>& traces() const {
         return traces_;
     }
+
+    // Python code may modify the properties and catalogue through the
+    // returned references: discard the simulation.
+    arb::cable_cell_global_properties& properties() {
+        sim_.reset();
+        return gprop_;
+    }
+
+    arb::mechanism_catalogue& catalogue() {
+        sim_.reset();
+        return cat_;
+    }
 };
 
+// Read-only NumPy array referring to x, which keeps owner alive.
+pybind11::array_t<double> readonly_view(const std::vector<double>& x, pybind11::object owner) {
+    pybind11::array_t<double> a(x.size(), x.data(), owner);
+    a.attr("flags").attr("writeable") = false;
+    return a;
+}
+
 void register_single_cell(pybind11::module& m) {
     using namespace pybind11::literals;
 
-    pybind11::class_<trace> tr(m, "trace", "Values and meta-data for a sample-trace on a single cell model.");
+    pybind11::class_<trace, std::shared_ptr<trace>> tr(m, "trace", "Values and meta-data for a sample-trace on a single cell model.");
     tr
         .def_readonly("variable", &trace::variable, "Name of the variable being recorded.")
         .def_readonly("location", &trace::loc, "Location on cell morphology.")
-        .def_readonly("time",    &trace::t, "Time stamps of samples [ms].")
-        .def_readonly("value",   &trace::v, "Sample values.")
+        .def_property_readonly("time",
+            [](pybind11::object self) {
+                auto& t = self.cast<const trace&>().t;
+                return readonly_view(t, self);},
+            "Time stamps of samples [ms], as a read-only view.")
+        .def_property_readonly("value",
+            [](pybind11::object self) {
+                auto& v = self.cast<const trace&>().v;
+                return readonly_view(v, self);},
+            "Sample values, as a read-only view.")
         .def("__str__", [](const trace& tr) {return util::pprintf("(trace \"{}\" {})", tr.variable, tr.loc);})
         .def("__repr__", [](const trace& tr) {return util::pprintf("(trace \"{}\" {})", tr.variable, tr.loc);});
 
@@ -245,6 +309,12 @@ void register_single_cell(pybind11::module& m) {
              "tfinal"_a,
              "dt"_a = 0.025,
              "Run model from t=0 to t=tfinal ms.")
+        .def("set_parameter",
+             &single_cell_model::set_parameter,
+             "mechanism"_a, "parameter"_a, "value"_a,
+             "Set a parameter or global of a mechanism to value over the whole cell, in place\n"
+             "of the values painted or placed on the cell. Takes effect from the next run,\n"
+             "without re-instantiating the model.")
         .def("probe",
             [](single_cell_model& m, const char* what, const char* where, double frequency) {
                 m.probe(what, where, frequency);},
@@ -268,8 +338,16 @@ void register_single_cell(pybind11::module& m) {
             [](const single_cell_model& m) {
                 return m.traces();},
             "Holds sample traces after a call to run().")
-        .def_readwrite("properties", &single_cell_model::gprop, "Global properties.")
-        .def_readwrite("catalogue", &single_cell_model::cat, "Mechanism catalogue.")
+        .def_property("properties",
+            [](single_cell_model& m) -> arb::cable_cell_global_properties& { return m.properties(); },
+            [](single_cell_model& m, const arb::cable_cell_global_properties& p) { m.properties() = p; },
+            pybind11::return_value_policy::reference_internal,
+            "Global properties.")
+        .def_property("catalogue",
+            [](single_cell_model& m) -> arb::mechanism_catalogue& { return m.catalogue(); },
+            [](single_cell_model& m, const arb::mechanism_catalogue& c) { m.catalogue() = c; },
+            pybind11::return_value_policy::reference_internal,
+            "Mechanism catalogue.")
         .def("__repr__", [](const single_cell_model&){return "<arbor.single_cell_model>";})
         .def("__str__",  [](const single_cell_model&){return "<arbor.single_cell_model>";});
 }
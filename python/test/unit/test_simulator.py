@@ -250,6 +250,57 @@ class Simulator(unittest.TestCase):
         self.assertEqual([0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20], s0)
         self.assertEqual([0, 4, 8, 12, 16, 20], s1)
 
+    def test_batch_callback(self):
+        sim = self.init_sim(lif2_recipe())
+        sim.record(A.spike_recording.all)
+
+        batches = []
+        sim.set_batch_callback(lambda t, spikes: batches.append((t, spikes.tolist())), 5)
+        sim.run(21, 0.01)
+
+        self.assertEqual([5, 10, 15, 20, 21], [t for t, _ in batches])
+
+        # Each batch holds the spikes generated since the previous one.
+        t0 = 0
+        for t, spikes in batches:
+            for _, time in spikes:
+                self.assertTrue(t0<=time<t)
+            t0 = t
+
+        batched = [s for _, spikes in batches for s in spikes]
+        self.assertEqual(sorted(sim.spikes().tolist()), sorted(batched))
+
+        # Without an interval, the callback is invoked at the end of a run.
+        batches = []
+        sim.set_batch_callback(lambda t, spikes: batches.append((t, spikes.tolist())))
+        sim.run(30, 0.01)
+        self.assertEqual([30], [t for t, _ in batches])
+        later = [s for s in sim.spikes().tolist() if s[1]>=21]
+        self.assertEqual(sorted(later), sorted(batches[0][1]))
+
+    def test_batch_callback_repeated_runs(self):
+        sim = self.init_sim(lif2_recipe())
+        sim.record(A.spike_recording.all)
+
+        # Batches are counted from the start of each run, and the last batch
+        # of a run is cut short at its end time.
+        batches = []
+        sim.set_batch_callback(lambda t, spikes: batches.append((t, spikes.tolist())), 4)
+        sim.run(10, 0.01)
+        sim.run(19, 0.01)
+        sim.run(22, 0.01)
+        self.assertEqual([4, 8, 10, 14, 18, 19, 22], [t for t, _ in batches])
+
+        t0 = 0
+        for t, spikes in batches:
+            for _, time in spikes:
+                self.assertTrue(t0<=time<t)
+            t0 = t
+
+        batched = [s for _, spikes in batches for s in spikes]
+        self.assertGreater(len(batched), 0)
+        self.assertEqual(sorted(sim.spikes().tolist()), sorted(batched))
+
 def suite():
     # specify class and test functions in tuple (here: all tests starting with 'test' from class Contexts
     suite = unittest.makeSuite(Simulator, ('test'))
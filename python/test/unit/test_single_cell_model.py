@@ -0,0 +1,94 @@
+# -*- coding: utf-8 -*-
+#
+# test_single_cell_model.py
+
+import unittest
+import arbor as A
+
+# to be able to run .py file from child directory
+import sys, os
+sys.path.insert(0, os.path.abspath(os.path.join(os.path.dirname(__file__), '../../')))
+
+try:
+    import options
+except ModuleNotFoundError:
+    from test import options
+
+"""
+tests for the single cell model
+"""
+
+def make_cell():
+    # A spiking soma with a current clamp.
+    tree = A.segment_tree()
+    tree.append(A.mnpos, A.mpoint(-3, 0, 0, 3), A.mpoint(3, 0, 0, 3), tag=1)
+    labels = A.label_dict({'soma': '(tag 1)', 'midpoint': '(location 0 0.5)'})
+
+    decor = A.decor()
+    decor.set_property(Vm=-40)
+    decor.paint('"soma"', 'hh')
+    decor.place('"midpoint"', A.iclamp(10, 2, 0.8))
+    decor.place('"midpoint"', A.spike_detector(-10))
+
+    return A.cable_cell(tree, labels, decor)
+
+class SingleCellModel(unittest.TestCase):
+    def test_set_parameter_reused(self):
+        m = A.single_cell_model(make_cell())
+        m.probe('voltage', '"midpoint"', frequency=10000)
+
+        m.run(tfinal=30)
+        spikes = list(m.spikes)
+        values = list(m.traces[0].value)
+        self.assertGreater(len(spikes), 0)
+
+        # Without sodium conductance the cell does not spike; the override
+        # applies to the model as instantiated by the first run.
+        m.set_parameter('hh', 'gnabar', 0)
+        m.run(tfinal=30)
+        self.assertEqual([], list(m.spikes))
+        self.assertNotEqual(values, list(m.traces[0].value))
+
+        # Restoring the default value restores the original results.
+        m.set_parameter('hh', 'gnabar', 0.12)
+        m.run(tfinal=30)
+        self.assertEqual(spikes, list(m.spikes))
+        self.assertEqual(values, list(m.traces[0].value))
+
+    def test_set_parameter_before_run(self):
+        m = A.single_cell_model(make_cell())
+        m.set_parameter('hh', 'gnabar', 0)
+        m.run(tfinal=30)
+        self.assertEqual([], list(m.spikes))
+
+    def test_traces_read_only(self):
+        m = A.single_cell_model(make_cell())
+        m.probe('voltage', '"midpoint"', frequency=10000)
+        m.run(tfinal=10)
+
+        tr = m.traces[0]
+        self.assertEqual(len(tr.time), len(tr.value))
+        self.assertGreater(len(tr.value), 0)
+        self.assertFalse(tr.time.flags.writeable)
+        self.assertFalse(tr.value.flags.writeable)
+        with self.assertRaises(ValueError):
+            tr.value[0] = 0
+
+        # Traces from an earlier run are left untouched by later runs.
+        values = list(tr.value)
+        m.run(tfinal=20)
+        self.assertEqual(values, list(tr.value))
+        self.assertGreater(len(m.traces[0].value), len(values))
+
+def suite():
+    # specify class and test functions in tuple (here: all tests starting with 'test' from class SingleCellModel
+    suite = unittest.makeSuite(SingleCellModel, ('test'))
+    return suite
+
+def run():
+    v = options.parse_arguments().verbosity
+    runner = unittest.TextTestRunner(verbosity = v)
+    runner.run(suite())
+
+if __name__ == "__main__":
+    run()
@@ -50,6 +50,10 @@ public:
         return catalogue_;
     }
 
+    cable_cell_global_properties& cable_properties() {
+        return cell_gprop_;
+    }
+
     void add_ion(const std::string& ion_name, int charge, double init_iconc, double init_econc, double init_revpot) {
         cell_gprop_.add_ion(ion_name, charge, init_iconc, init_econc, init_revpot);
     }
@@ -0,0 +1,95 @@
+// Cost of delivering the events of one integration step to the synapses of a
+// cell group with several point mechanism types.
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechcat.hpp>
+
+#include "backends/event.hpp"
+#include "backends/multicore/fvm.hpp"
+#include "backends/multicore/mechanism.hpp"
+#include "fvm_layout.hpp"
+
+using namespace arb;
+
+using backend = multicore::backend;
+
+// n_mech instances of expsyn, each with n_syn synapses on each of n_cell
+// one-CV cells, and n_event events per cell spread uniformly over the
+// synapses of all the mechanisms and over n_step steps.
+
+void deliver_events(benchmark::State& state) {
+    const unsigned n_mech = state.range(0);
+    const unsigned n_cell = 100;
+    const unsigned n_syn = 10;
+    const unsigned n_event = 1000;
+    const unsigned n_step = 40;
+    const double dt = 0.025;
+
+    std::vector<fvm_index_type> cv_to_intdom(n_cell);
+    for (unsigned i = 0; i<n_cell; ++i) cv_to_intdom[i] = i;
+    std::vector<fvm_value_type> vinit(n_cell, -65.), temp(n_cell, 308.), diam(n_cell, 1.);
+
+    const auto& cat = global_default_catalogue();
+    std::vector<std::unique_ptr<multicore::mechanism>> mechs;
+    for (unsigned m = 0; m<n_mech; ++m) {
+        auto mech = cat.instance<backend>("expsyn").mech.release();
+        mechs.emplace_back(dynamic_cast<multicore::mechanism*>(mech));
+    }
+    backend::shared_state shared(n_cell, cv_to_intdom, {}, vinit, temp, diam, mechs.front()->data_alignment());
+
+    mechanism_layout layout;
+    for (unsigned c = 0; c<n_cell; ++c) {
+        for (unsigned s = 0; s<n_syn; ++s) {
+            layout.cv.push_back(c);
+        }
+    }
+    layout.weight.assign(layout.cv.size(), 1.);
+
+    for (unsigned m = 0; m<n_mech; ++m) {
+        mechs[m]->instantiate(m, shared, {}, layout);
+        mechs[m]->initialize();
+    }
+
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<time_type> time_dist(0, n_step*dt);
+    std::uniform_int_distribution<unsigned> mech_dist(0, n_mech-1), syn_dist(0, n_syn-1);
+
+    std::vector<deliverable_event> staged;
+    for (unsigned c = 0; c<n_cell; ++c) {
+        std::vector<deliverable_event> cell_events;
+        for (unsigned e = 0; e<n_event; ++e) {
+            target_handle h(mech_dist(gen), c*n_syn+syn_dist(gen), c);
+            cell_events.emplace_back(time_dist(gen), h, 1.f);
+        }
+        std::sort(cell_events.begin(), cell_events.end(),
+            [](const auto& a, const auto& b) { return a.time<b.time; });
+        staged.insert(staged.end(), cell_events.begin(), cell_events.end());
+    }
+
+    std::vector<fvm_value_type> t_until(n_cell);
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        shared.deliverable_events.init(staged);
+        state.ResumeTiming();
+
+        for (unsigned s = 1; s<=n_step; ++s) {
+            std::fill(t_until.begin(), t_until.end(), s*dt);
+            shared.deliverable_events.mark_until_after(t_until);
+            for (auto& m: mechs) {
+                m->deliver_events();
+            }
+            shared.deliverable_events.drop_marked_events();
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(deliver_events)->Arg(1)->Arg(2)->Arg(5)->Arg(10)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
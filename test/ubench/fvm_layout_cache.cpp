@@ -0,0 +1,96 @@
+// Cost of discretizing cells and building their mechanism data, compared
+// with reading the same from a populated on-disk cache.
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <arbor/cable_cell.hpp>
+#include <arbor/morph/segment_tree.hpp>
+
+#include "fvm_layout.hpp"
+#include "fvm_layout_cache.hpp"
+
+using namespace arb;
+
+// A random tree of n segments with a soma, in unbranched runs of 1 to 50
+// segments that start at the end of a random earlier segment.
+
+segment_tree make_tree(unsigned n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<unsigned> run_dist(1, 50);
+    std::uniform_real_distribution<double> step(-5, 5), radius(0.2, 1.);
+
+    segment_tree tree;
+    tree.append(mnpos, {0, 0, 0, 5}, {10, 0, 0, 5}, 1);
+    while (tree.size()<n) {
+        msize_t p = std::uniform_int_distribution<msize_t>(0, tree.size()-1)(gen);
+        auto run = std::min<unsigned>(run_dist(gen), n-tree.size());
+        for (unsigned i = 0; i<run; ++i) {
+            auto x = tree.segments()[p].dist;
+            p = tree.append(p, {x.x+step(gen), x.y+step(gen), x.z+step(gen), radius(gen)}, 3);
+        }
+    }
+    return tree;
+}
+
+std::vector<cable_cell> make_cells(unsigned n_cell, unsigned n_segment) {
+    std::vector<cable_cell> cells;
+    for (unsigned i = 0; i<n_cell; ++i) {
+        decor d;
+        d.paint("(tag 1)", "hh");
+        d.paint("(tag 3)", "pas");
+        d.place("(uniform (tag 3) 0 99 1)", "expsyn");
+        d.place("(location 0 0.5)", i_clamp{5, 80, 0.3});
+        d.set_default(cv_policy_max_extent(10));
+        cells.emplace_back(morphology(make_tree(n_segment, i)), label_dict{}, d);
+    }
+    return cells;
+}
+
+cable_cell_global_properties make_gprop() {
+    cable_cell_global_properties gprop;
+    gprop.default_parameters = neuron_parameter_defaults;
+    return gprop;
+}
+
+void discretize(benchmark::State& state) {
+    auto cells = make_cells(100, state.range(0));
+    auto gprop = make_gprop();
+
+    while (state.KeepRunning()) {
+        auto D = fvm_cv_discretize(cells, gprop.default_parameters);
+        benchmark::DoNotOptimize(fvm_build_mechanism_data(gprop, cells, D));
+    }
+}
+
+void discretize_cached(benchmark::State& state) {
+    auto cells = make_cells(100, state.range(0));
+    auto gprop = make_gprop();
+
+    char dir_template[] = "/tmp/arbor-ubench-XXXXXX";
+    if (!mkdtemp(dir_template)) {
+        state.SkipWithError("unable to create cache directory");
+        return;
+    }
+    std::string dir = dir_template;
+    fvm_build_layout_cached(dir, gprop, cells);
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(fvm_build_layout_cached(dir, gprop, cells));
+    }
+
+    for (auto& c: cells) {
+        std::remove(fvm_layout_cache_path(dir, fvm_layout_cache_key(c, gprop)).c_str());
+    }
+    std::remove(dir.c_str());
+}
+
+BENCHMARK(discretize)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(discretize_cached)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,50 @@
+// Cost of random gathers from a large array of simulation state, allocated
+// with regular pages or with transparent huge pages (see arb::huge_page_size).
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <arbor/huge_pages.hpp>
+
+#include "util/padded_alloc.hpp"
+
+using namespace arb;
+
+template <typename T>
+using padded_vector = std::vector<T, util::padded_allocator<T>>;
+
+// Sum n_index values at random indices of an array of state.range(0) MiB,
+// with huge pages if state.range(1) is non-zero.
+
+void gather(benchmark::State& state) {
+    const std::size_t n = (std::size_t(state.range(0))<<20)/sizeof(double);
+    const std::size_t n_index = 1<<20;
+
+    set_huge_page_threshold(state.range(1)? huge_page_size: 0);
+    padded_vector<double> data(n, 1., util::padded_allocator<double>(64));
+    set_huge_page_threshold(0);
+
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<std::uint32_t> dist(0, n-1);
+    std::vector<std::uint32_t> index(n_index);
+    for (auto& i: index) i = dist(gen);
+
+    while (state.KeepRunning()) {
+        double sum = 0;
+        for (auto i: index) {
+            sum += data[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(gather)
+    ->Args({16, 0})->Args({16, 1})
+    ->Args({256, 0})->Args({256, 1})
+    ->Args({1024, 0})->Args({1024, 1})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,110 @@
+// Cost of parsing region and locset descriptions: tokenizing and building
+// s-expressions for a large input, and parsing and evaluating each
+// expression through the public label parsing API.
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <arbor/morph/label_parse.hpp>
+
+#include "s_expr.hpp"
+#include "util/strprintf.hpp"
+
+using namespace arb;
+
+// Random region and locset expressions, nested up to a given depth.
+
+struct expression_generator {
+    std::mt19937 gen;
+
+    int integer(int n) {
+        return std::uniform_int_distribution<int>(0, n-1)(gen);
+    }
+
+    double real() {
+        return std::uniform_real_distribution<double>(0, 1)(gen);
+    }
+
+    std::string region(int depth) {
+        switch (integer(depth>0? 8: 4)) {
+            case 0: return util::pprintf("(tag {})", 1+integer(4));
+            case 1: return util::pprintf("(branch {})", integer(100));
+            case 2: return util::pprintf("(cable {} {} {})", integer(100), 0.5*real(), 0.5+0.5*real());
+            case 3: return util::pprintf("(region \"dend-{}\")", integer(10));
+            case 4: return util::pprintf("(join {} {})", region(depth-1), region(depth-1));
+            case 5: return util::pprintf("(intersect {} {})", region(depth-1), region(depth-1));
+            case 6: return util::pprintf("(radius-lt {} {})", region(depth-1), real());
+            default: return util::pprintf("(distal-interval {} {})", locset(depth-1), 100*real());
+        }
+    }
+
+    std::string locset(int depth) {
+        switch (integer(depth>0? 7: 4)) {
+            case 0: return "(root)";
+            case 1: return "(terminal)";
+            case 2: return util::pprintf("(location {} {})", integer(100), real());
+            case 3: return util::pprintf("(locset \"syn-{}\")", integer(10));
+            case 4: return util::pprintf("(distal {})", region(depth-1));
+            case 5: return util::pprintf("(restrict {} {})", locset(depth-1), region(depth-1));
+            default: return util::pprintf("(uniform {} 0 9 {})", region(depth-1), integer(1000));
+        }
+    }
+
+    std::string operator()() {
+        return integer(2)? region(3): locset(3);
+    }
+};
+
+const std::vector<std::string>& expressions() {
+    static std::vector<std::string> exprs = [] {
+        expression_generator g;
+        std::vector<std::string> v(100000);
+        for (auto& e: v) e = g();
+        return v;
+    }();
+    return exprs;
+}
+
+const std::string& input() {
+    static std::string in = [] {
+        std::string s;
+        for (auto& e: expressions()) {
+            s += e;
+            s += '\n';
+        }
+        return s;
+    }();
+    return in;
+}
+
+void s_expr_parse(benchmark::State& state) {
+    const auto& in = input();
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(parse_multi_s_expr(transmogrifier(in)));
+    }
+}
+
+void s_expr_tree_parse(benchmark::State& state) {
+    const auto& in = input();
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(parse_multi_s_expr_tree(in));
+    }
+}
+
+void label_expression_parse(benchmark::State& state) {
+    const auto& exprs = expressions();
+    while (state.KeepRunning()) {
+        for (auto& e: exprs) {
+            benchmark::DoNotOptimize(parse_label_expression(e));
+        }
+    }
+}
+
+BENCHMARK(s_expr_parse)->Unit(benchmark::kMillisecond);
+BENCHMARK(s_expr_tree_parse)->Unit(benchmark::kMillisecond);
+BENCHMARK(label_expression_parse)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
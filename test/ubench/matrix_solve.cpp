@@ -0,0 +1,87 @@
+// Cost of matrix assembly and Hines solve in the multicore back end,
+// as a function of the number of cells and the number of CVs per cell.
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <arbor/fvm_types.hpp>
+
+#include "backends/multicore/matrix_state.hpp"
+
+using namespace arb;
+
+using matrix_state = multicore::matrix_state<fvm_value_type, fvm_index_type>;
+
+// Build a matrix for ncells identical cells of ncv CVs each. Each cell is a
+// tree in which a new branch of eight CVs is attached to a random, earlier
+// CV, which gives a branch structure roughly like that of a dendritic tree.
+
+matrix_state make_matrix(unsigned ncells, unsigned ncv) {
+    std::mt19937 gen;
+    std::vector<fvm_index_type> cell_parent(ncv);
+    cell_parent[0] = -1;
+    for (unsigned i = 1; i<ncv; ++i) {
+        cell_parent[i] = i%8? i-1: std::uniform_int_distribution<fvm_index_type>(0, i-1)(gen);
+    }
+
+    std::vector<fvm_index_type> p, cell_cv_divs = {0}, cell_to_intdom;
+    for (unsigned c = 0; c<ncells; ++c) {
+        fvm_index_type base = c*ncv;
+        for (auto q: cell_parent) {
+            p.push_back(q<0? q: base+q);
+        }
+        cell_cv_divs.push_back(base+ncv);
+        cell_to_intdom.push_back(c);
+    }
+
+    auto n = p.size();
+    std::vector<fvm_value_type> cap(n, 1.), cond(n, 10.), area(n, 100.);
+    return matrix_state(p, cell_cv_divs, cap, cond, area, cell_to_intdom);
+}
+
+void assemble(benchmark::State& state) {
+    const unsigned ncells = state.range(0);
+    const unsigned ncv = state.range(1);
+
+    auto m = make_matrix(ncells, ncv);
+    std::size_t n = ncells*ncv;
+
+    matrix_state::array dt(ncells, 0.025), v(n, -65.), i(n, 1.), g(n, 0.1);
+    while (state.KeepRunning()) {
+        m.assemble(dt, v, i, g);
+        benchmark::ClobberMemory();
+    }
+}
+
+// The solve is destructive, so it is timed together with the assembly
+// that precedes it in every integration step.
+
+void assemble_solve(benchmark::State& state) {
+    const unsigned ncells = state.range(0);
+    const unsigned ncv = state.range(1);
+
+    auto m = make_matrix(ncells, ncv);
+    std::size_t n = ncells*ncv;
+
+    matrix_state::array dt(ncells, 0.025), v(n, -65.), i(n, 1.), g(n, 0.1);
+    while (state.KeepRunning()) {
+        m.assemble(dt, v, i, g);
+        m.solve();
+        benchmark::ClobberMemory();
+    }
+}
+
+void run_custom_arguments(benchmark::internal::Benchmark* b) {
+    for (auto ncells: {1, 10, 100, 1000}) {
+        for (auto ncv: {1, 16, 128, 1024}) {
+            b->Args({ncells, ncv});
+        }
+    }
+}
+
+BENCHMARK(assemble)->Apply(run_custom_arguments);
+BENCHMARK(assemble_solve)->Apply(run_custom_arguments);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+// Cost of one integration step (current and state update) of the generated
+// multicore mechanism kernels from the built-in catalogues, as a function of
+// the mechanism width, i.e. the number of CVs it covers.
+//
+// One benchmark is registered for each mechanism in the default, BBP and
+// Allen catalogues, named <catalogue>/<mechanism>.
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechcat.hpp>
+
+#include "backends/multicore/fvm.hpp"
+#include "fvm_layout.hpp"
+
+using namespace arb;
+
+using backend = multicore::backend;
+
+void run_mechanism(benchmark::State& state, const mechanism_catalogue* cat, std::string name) {
+    const fvm_size_type width = state.range(0);
+
+    auto instance = cat->instance<backend>(name);
+    auto& mech = instance.mech;
+    auto info = (*cat)[name];
+
+    // One cell, one CV per mechanism instance.
+    std::vector<fvm_index_type> cv_to_intdom(width, 0);
+    std::vector<fvm_value_type> vinit(width, -65.), temp(width, 308.), diam(width, 1.);
+    backend::shared_state shared(1, cv_to_intdom, {}, vinit, temp, diam, mech->data_alignment());
+
+    mechanism_layout layout;
+    for (fvm_size_type i = 0; i<width; ++i) {
+        layout.cv.push_back(i);
+    }
+    layout.weight.assign(width, 1.);
+
+    static const std::unordered_map<std::string, int> ion_charge = {{"ca", 2}, {"na", 1}, {"k", 1}};
+    for (auto& kv: info.ions) {
+        fvm_ion_config ion;
+        ion.cv = layout.cv;
+        ion.init_iconc.assign(width, 1.);
+        ion.init_econc.assign(width, 1.);
+        ion.reset_iconc.assign(width, 1.);
+        ion.reset_econc.assign(width, 1.);
+        ion.init_revpot.assign(width, 0.);
+
+        auto charge = kv.second.verify_ion_charge? kv.second.expected_ion_charge: ion_charge.at(kv.first);
+        shared.add_ion(kv.first, charge, ion);
+    }
+
+    mech->instantiate(0, shared, instance.overrides, layout);
+    shared.reset();
+    shared.update_time_to(0.025, 1e9);
+    shared.set_dt();
+    mech->initialize();
+
+    while (state.KeepRunning()) {
+        mech->update_current();
+        mech->update_state();
+        benchmark::ClobberMemory();
+    }
+}
+
+int main(int argc, char** argv) {
+    std::pair<const char*, const mechanism_catalogue*> catalogues[] = {
+        {"default", &global_default_catalogue()},
+        {"bbp", &global_bbp_catalogue()},
+        {"allen", &global_allen_catalogue()}
+    };
+
+    for (auto& [prefix, cat]: catalogues) {
+        for (auto& name: cat->mechanism_names()) {
+            // Derived mechanisms share the kernels of their parents.
+            if (cat->is_derived(name)) continue;
+
+            benchmark::RegisterBenchmark((std::string(prefix)+"/"+name).c_str(), run_mechanism, cat, name)
+                ->RangeMultiplier(8)->Range(8, 32768);
+        }
+    }
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+}
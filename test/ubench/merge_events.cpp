@@ -0,0 +1,63 @@
+// Cost of tree_merge_events, used in simulation_state::setup_events to merge
+// the pending events of a cell with those from its event generators, as a
+// function of the number of input lanes and of events per lane.
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <arbor/spike_event.hpp>
+
+#include "merge_events.hpp"
+#include "util/rangeutil.hpp"
+
+using namespace arb;
+
+std::vector<pse_vector> generate_lanes(unsigned n_lane, unsigned ev_per_lane) {
+    std::mt19937 gen;
+    std::uniform_real_distribution<time_type> time_dist(0., 1.);
+
+    std::vector<pse_vector> lanes(n_lane);
+    for (auto& lane: lanes) {
+        for (unsigned i = 0; i<ev_per_lane; ++i) {
+            lane.push_back({{0, 0}, time_dist(gen), 1.f});
+        }
+        util::sort(lane);
+    }
+    return lanes;
+}
+
+void tree_merge(benchmark::State& state) {
+    const unsigned n_lane = state.range(0);
+    const unsigned ev_per_lane = state.range(1);
+
+    auto lanes = generate_lanes(n_lane, ev_per_lane);
+
+    pse_vector out;
+    std::vector<event_span> spans;
+    while (state.KeepRunning()) {
+        // tree_merge_events consumes its input spans.
+        spans.clear();
+        for (auto& lane: lanes) {
+            spans.push_back(util::range_pointer_view(lane));
+        }
+        out.clear();
+
+        tree_merge_events(spans, out);
+        benchmark::ClobberMemory();
+    }
+}
+
+void run_custom_arguments(benchmark::internal::Benchmark* b) {
+    for (auto n_lane: {2, 4, 16, 64, 256}) {
+        for (auto ev_per_lane: {1, 10, 100, 1000}) {
+            b->Args({n_lane, ev_per_lane});
+        }
+    }
+}
+
+BENCHMARK(tree_merge)->Apply(run_custom_arguments);
+
+BENCHMARK_MAIN();
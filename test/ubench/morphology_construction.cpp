@@ -0,0 +1,98 @@
+// Cost of building morphologies and their embeddings from large segment
+// trees, as read from whole-neuron reconstructions, and from libraries of
+// many smaller cells.
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <arbor/context.hpp>
+#include <arbor/morph/embed_pwlin.hpp>
+#include <arbor/morph/morphology.hpp>
+#include <arbor/morph/primitives.hpp>
+#include <arbor/morph/segment_tree.hpp>
+
+using namespace arb;
+
+// A random tree of n segments, in unbranched runs of 1 to 200 segments that
+// start at the end of a random earlier segment.
+
+segment_tree make_tree(unsigned n, unsigned seed = 0) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<unsigned> run_dist(1, 200);
+    std::uniform_real_distribution<double> step(-1, 1), radius(0.2, 2.);
+
+    segment_tree tree;
+    tree.reserve(n);
+    tree.append(mnpos, {0, 0, 0, 5}, {10, 0, 0, 5}, 1);
+    while (tree.size()<n) {
+        msize_t p = std::uniform_int_distribution<msize_t>(0, tree.size()-1)(gen);
+        auto run = std::min<unsigned>(run_dist(gen), n-tree.size());
+        for (unsigned i = 0; i<run; ++i) {
+            auto x = tree.segments()[p].dist;
+            p = tree.append(p, {x.x+step(gen), x.y+step(gen), x.z+step(gen), radius(gen)}, 3);
+        }
+    }
+    return tree;
+}
+
+void morphology_from_tree(benchmark::State& state) {
+    auto tree = make_tree(state.range(0));
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(morphology(tree));
+    }
+}
+
+void embedding(benchmark::State& state) {
+    morphology m(make_tree(state.range(0)));
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(embed_pwlin(m));
+    }
+}
+
+// Construct the embedding and compute the area of every branch.
+void embedding_all_branches(benchmark::State& state) {
+    morphology m(make_tree(state.range(0)));
+    while (state.KeepRunning()) {
+        embed_pwlin e(m);
+        double area = 0;
+        for (msize_t b = 0; b<m.num_branches(); ++b) {
+            area += e.integrate_area(mcable{b, 0, 1});
+        }
+        benchmark::DoNotOptimize(area);
+    }
+}
+
+// Construct the embedding of all branches up front, with a context of
+// the given number of threads.
+void embedding_parallel(benchmark::State& state) {
+    morphology m(make_tree(1000000));
+    auto ctx = make_context(proc_allocation(state.range(0), -1));
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(embed_pwlin(m, ctx));
+    }
+}
+
+// Morphologies and embeddings for a library of 10⁴ cells of n segments.
+void cell_library(benchmark::State& state) {
+    std::vector<segment_tree> trees;
+    for (unsigned i = 0; i<10000; ++i) {
+        trees.push_back(make_tree(state.range(0), i));
+    }
+
+    while (state.KeepRunning()) {
+        for (auto& t: trees) {
+            morphology m(t);
+            benchmark::DoNotOptimize(embed_pwlin(m));
+        }
+    }
+}
+
+BENCHMARK(morphology_from_tree)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(embedding)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(embedding_all_branches)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(embedding_parallel)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
+BENCHMARK(cell_library)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,174 @@
+// Cost of the local parts of spike exchange: collating the thread private
+// spike buffers, and generating post-synaptic events from the global spike
+// list with communicator::make_event_queues; and the cost of constructing
+// the communicator from the recipe.
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <arbor/context.hpp>
+#include <arbor/domain_decomposition.hpp>
+#include <arbor/recipe.hpp>
+#include <arbor/spike.hpp>
+
+#include "communication/communicator.hpp"
+#include "execution_context.hpp"
+#include "thread_private_spike_store.hpp"
+#include "threading/threading.hpp"
+
+using namespace arb;
+
+// Total number of cells in the (notional) global network.
+constexpr cell_gid_type n_global = 100000;
+
+// Number of cells on the local domain.
+constexpr cell_gid_type n_local = 1000;
+
+// Every local cell receives n_conn connections from sources drawn uniformly
+// from the global network.
+
+class random_recipe: public recipe {
+public:
+    random_recipe(unsigned n_conn): n_conn_(n_conn) {}
+
+    cell_size_type num_cells() const override { return n_global; }
+    util::unique_any get_cell_description(cell_gid_type) const override { return {}; }
+    cell_kind get_cell_kind(cell_gid_type) const override { return cell_kind::cable; }
+
+    cell_size_type num_sources(cell_gid_type) const override { return 1; }
+    cell_size_type num_targets(cell_gid_type) const override { return n_conn_; }
+
+    std::vector<cell_connection> connections_on(cell_gid_type gid) const override {
+        std::mt19937 gen(gid);
+        std::uniform_int_distribution<cell_gid_type> src_dist(0, n_global-1);
+        std::uniform_real_distribution<float> delay_dist(1.f, 10.f);
+
+        std::vector<cell_connection> conns;
+        for (cell_lid_type i = 0; i<n_conn_; ++i) {
+            conns.emplace_back(cell_member_type{src_dist(gen), 0}, cell_member_type{gid, i}, 1.f, delay_dist(gen));
+        }
+        return conns;
+    }
+
+private:
+    unsigned n_conn_;
+};
+
+domain_decomposition local_decomposition() {
+    std::vector<cell_gid_type> gids(n_local);
+    std::iota(gids.begin(), gids.end(), 0u);
+
+    domain_decomposition d;
+    d.gid_domain = [](cell_gid_type) { return 0; };
+    d.num_domains = 1;
+    d.domain_id = 0;
+    d.num_local_cells = n_local;
+    d.num_global_cells = n_global;
+    d.groups.emplace_back(cell_kind::cable, std::move(gids), backend_kind::multicore);
+    return d;
+}
+
+std::vector<spike> generate_spikes(std::size_t n) {
+    std::mt19937 gen;
+    std::uniform_int_distribution<cell_gid_type> src_dist(0, n_global-1);
+    std::uniform_real_distribution<time_type> time_dist(0., 1.);
+
+    std::vector<spike> spikes(n);
+    for (auto& s: spikes) {
+        s.source = {src_dist(gen), 0};
+        s.time = time_dist(gen);
+    }
+    return spikes;
+}
+
+void communicator_construction(benchmark::State& state) {
+    const unsigned n_threads = state.range(0);
+    const unsigned n_conn = state.range(1);
+
+    proc_allocation resources(n_threads, -1);
+    auto ctx = make_context(resources);
+    random_recipe rec(n_conn);
+    auto decomp = local_decomposition();
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(communicator(rec, decomp, *ctx));
+    }
+}
+
+void make_event_queues(benchmark::State& state) {
+    const unsigned n_conn = state.range(0);
+    const std::size_t n_spikes = state.range(1);
+
+    auto ctx = make_context();
+    communicator comm(random_recipe(n_conn), local_decomposition(), *ctx);
+
+    auto spikes = generate_spikes(n_spikes);
+    std::sort(spikes.begin(), spikes.end(), [](const spike& a, const spike& b) { return a.source<b.source; });
+    gathered_vector<spike> global_spikes(std::move(spikes), {0u, unsigned(n_spikes)});
+
+    std::vector<pse_vector> queues(n_local);
+    while (state.KeepRunning()) {
+        for (auto& q: queues) {
+            q.clear();
+        }
+        comm.make_event_queues(global_spikes, queues);
+        benchmark::ClobberMemory();
+    }
+}
+
+void spike_store_gather(benchmark::State& state) {
+    const unsigned n_threads = state.range(0);
+    const std::size_t n_spikes = state.range(1);
+
+    // Fill the thread private buffers from many small tasks, as the cell
+    // groups do in simulation_state::run.
+    constexpr std::size_t n_chunk = 256;
+    auto spikes = generate_spikes(n_spikes);
+    auto ts = std::make_shared<threading::task_system>(n_threads);
+    thread_private_spike_store store(ts);
+
+    threading::parallel_for::apply(0, (n_spikes+n_chunk-1)/n_chunk, ts.get(),
+        [&](std::size_t i) {
+            auto b = spikes.begin()+i*n_chunk;
+            auto e = spikes.begin()+std::min(n_spikes, (i+1)*n_chunk);
+            store.insert(std::vector<spike>(b, e));
+        });
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(store.gather());
+    }
+}
+
+void construction_arguments(benchmark::internal::Benchmark* b) {
+    for (auto n_threads: {1, 4}) {
+        for (auto n_conn: {10, 100, 1000}) {
+            b->Args({n_threads, n_conn});
+        }
+    }
+}
+
+void make_event_queues_arguments(benchmark::internal::Benchmark* b) {
+    for (auto n_conn: {10, 100, 1000}) {
+        for (auto n_spikes: {1000, 10000, 100000}) {
+            b->Args({n_conn, n_spikes});
+        }
+    }
+}
+
+void spike_store_arguments(benchmark::internal::Benchmark* b) {
+    for (auto n_threads: {1, 4, 16, 64}) {
+        for (auto n_spikes: {1000, 100000, 1000000}) {
+            b->Args({n_threads, n_spikes});
+        }
+    }
+}
+
+BENCHMARK(communicator_construction)->Apply(construction_arguments);
+BENCHMARK(make_event_queues)->Apply(make_event_queues_arguments);
+BENCHMARK(spike_store_gather)->Apply(spike_store_arguments);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,146 @@
+// Cost of the per-step bookkeeping kernels of the multicore back end that
+// run outside the mechanisms and the matrix solver: threshold detection,
+// marking of deliverable events, and sampling.
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <arbor/fvm_types.hpp>
+
+#include "backends/event.hpp"
+#include "backends/multicore/fvm.hpp"
+#include "execution_context.hpp"
+
+using namespace arb;
+
+using backend = multicore::backend;
+using array = backend::array;
+
+// Threshold detection on n_cv detectors, of which a fraction (given in
+// percent) crosses the threshold on every second step.
+
+void threshold_test(benchmark::State& state) {
+    const unsigned n_cv = state.range(0);
+    const unsigned n_crossing = n_cv*state.range(1)/100;
+
+    execution_context ctx;
+    std::vector<fvm_index_type> cv_to_intdom(n_cv, 0), cv_index(n_cv);
+    std::vector<fvm_value_type> thresholds(n_cv, 0.);
+    std::iota(cv_index.begin(), cv_index.end(), 0);
+
+    array values(n_cv, -10.), t_before(1, 0.), t_after(1, 0.025);
+    backend::threshold_watcher watcher(cv_to_intdom.data(), values.data(), &t_before, &t_after,
+        cv_index, thresholds, ctx);
+
+    while (state.KeepRunning()) {
+        for (unsigned i = 0; i<n_crossing; ++i) {
+            values[i] = -values[i];
+        }
+        watcher.test();
+        watcher.clear_crossings();
+        benchmark::ClobberMemory();
+    }
+}
+
+// Marking and dropping deliverable events for one epoch of 40 steps, for
+// n_cell streams with ev_per_cell events each, uniform in the epoch.
+
+void mark_events(benchmark::State& state) {
+    const unsigned n_cell = state.range(0);
+    const unsigned ev_per_cell = state.range(1);
+    const unsigned n_step = 40;
+
+    std::mt19937 gen;
+    std::uniform_real_distribution<time_type> time_dist(0., 1.);
+
+    std::vector<deliverable_event> staged;
+    for (unsigned c = 0; c<n_cell; ++c) {
+        std::vector<time_type> times(ev_per_cell);
+        for (auto& t: times) t = time_dist(gen);
+        std::sort(times.begin(), times.end());
+
+        for (auto t: times) {
+            staged.emplace_back(t, target_handle(0, 0, c), 1.f);
+        }
+    }
+
+    backend::deliverable_event_stream stream(n_cell);
+    std::vector<fvm_value_type> t_until(n_cell);
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        stream.init(staged);
+        state.ResumeTiming();
+
+        for (unsigned s = 1; s<=n_step; ++s) {
+            std::fill(t_until.begin(), t_until.end(), s/double(n_step));
+            stream.mark_until_after(t_until);
+            stream.drop_marked_events();
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+// Sampling n_probe_per_cell values on each of n_cell cells in one step.
+
+void take_samples(benchmark::State& state) {
+    const unsigned n_cell = state.range(0);
+    const unsigned n_probe_per_cell = state.range(1);
+    const unsigned n_cv_per_cell = 100;
+    const unsigned n_cv = n_cell*n_cv_per_cell;
+
+    std::vector<fvm_index_type> cv_to_intdom(n_cv);
+    for (unsigned i = 0; i<n_cv; ++i) {
+        cv_to_intdom[i] = i/n_cv_per_cell;
+    }
+    std::vector<fvm_value_type> vinit(n_cv, -65.), temp(n_cv, 300.), diam(n_cv, 1.);
+    backend::shared_state shared(n_cell, cv_to_intdom, {}, vinit, temp, diam, 1);
+    shared.reset();
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<unsigned> cv_dist(0, n_cv_per_cell-1);
+
+    std::vector<sample_event> staged;
+    sample_size_type offset = 0;
+    for (unsigned c = 0; c<n_cell; ++c) {
+        for (unsigned p = 0; p<n_probe_per_cell; ++p) {
+            auto cv = c*n_cv_per_cell + cv_dist(gen);
+            staged.push_back(sample_event{0., c, {shared.voltage.data()+cv, offset++}});
+        }
+    }
+
+    backend::sample_event_stream stream(n_cell);
+    stream.init(staged);
+    stream.mark_until_after(shared.time);
+
+    array sample_time(offset), sample_value(offset);
+    while (state.KeepRunning()) {
+        shared.take_samples(stream.marked_events(), sample_time, sample_value);
+        benchmark::ClobberMemory();
+    }
+}
+
+void threshold_arguments(benchmark::internal::Benchmark* b) {
+    for (auto n_cv: {100, 1000, 10000, 100000}) {
+        for (auto pct_crossing: {0, 1, 10}) {
+            b->Args({n_cv, pct_crossing});
+        }
+    }
+}
+
+void event_arguments(benchmark::internal::Benchmark* b) {
+    for (auto n_cell: {1, 10, 100, 1000}) {
+        for (auto per_cell: {1, 10, 100, 1000}) {
+            b->Args({n_cell, per_cell});
+        }
+    }
+}
+
+BENCHMARK(threshold_test)->Apply(threshold_arguments);
+BENCHMARK(mark_events)->Apply(event_arguments);
+BENCHMARK(take_samples)->Apply(event_arguments);
+
+BENCHMARK_MAIN();
@@ -1,6 +1,7 @@
 #include "../gtest.h"
 #include "test.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 #include <vector>
 
@@ -10,8 +11,10 @@
 #include <threading/threading.hpp>
 
 #include "communication/communicator.hpp"
+#include "connection.hpp"
 #include "execution_context.hpp"
 #include "util/filter.hpp"
+#include "util/partition.hpp"
 #include "util/rangeutil.hpp"
 #include "util/span.hpp"
 
@@ -29,6 +32,21 @@ TEST(communicator, policy_basics) {
     EXPECT_EQ(g_context->distributed->max(rank), num_domains-1);
 }
 
+TEST(communicator, sum_vector) {
+    const int num_domains = g_context->distributed->size();
+    const int rank = g_context->distributed->id();
+
+    auto sums = g_context->distributed->sum(std::vector<double>{1., double(rank)});
+    ASSERT_EQ(2u, sums.size());
+    EXPECT_EQ(double(num_domains), sums[0]);
+    EXPECT_EQ(num_domains*(num_domains-1)/2., sums[1]);
+
+    auto maxima = g_context->distributed->max(std::vector<unsigned>{1u, unsigned(rank)});
+    ASSERT_EQ(2u, maxima.size());
+    EXPECT_EQ(1u, maxima[0]);
+    EXPECT_EQ(unsigned(num_domains-1), maxima[1]);
+}
+
 // Wrappers for creating and testing spikes used
 // to test that spikes are correctly exchanged.
 arb::spike gen_spike(int source, int value) {
@@ -140,6 +158,71 @@ TEST(communicator, gather_spikes_variant) {
     }
 }
 
+// Test spike gather in two levels by node, which must give the same result as
+// the flat gather, with a varying number of spikes per domain.
+TEST(communicator, gather_spikes_by_node) {
+    const auto rank = g_context->distributed->id();
+
+    std::vector<spike> local_spikes;
+    for (auto i=0; i<3*rank+1; ++i) {
+        auto s = gen_spike(100*rank+i, rank);
+        s.time = 0.5*i;
+        local_spikes.push_back(s);
+    }
+
+    const auto expected = g_context->distributed->gather_spikes(local_spikes);
+    const auto by_node = g_context->distributed->gather_spikes(local_spikes, true);
+    EXPECT_EQ(expected.partition(), by_node.partition());
+    EXPECT_EQ(expected.values(), by_node.values());
+
+    const auto compact = g_context->distributed->gather_spikes_compact(local_spikes, 0.1);
+    const auto compact_by_node = g_context->distributed->gather_spikes_compact(local_spikes, 0.1, true);
+    EXPECT_EQ(compact.partition(), compact_by_node.partition());
+    EXPECT_EQ(compact.values(), compact_by_node.values());
+}
+
+// Test spike gather with the compact wire format, with a varying number of
+// spikes per domain.
+TEST(communicator, gather_spikes_compact) {
+    const auto num_domains = g_context->distributed->size();
+    const auto rank = g_context->distributed->id();
+
+    constexpr int scale = 10;
+    constexpr time_type resolution = 0.01;
+    auto sumn = [](int n) {return scale*n*(n+1)/2;};
+    const auto n_local_spikes = scale*rank;
+
+    std::vector<spike> local_spikes;
+    const auto local_start_id = sumn(rank-1);
+    for (auto i=0; i<n_local_spikes; ++i) {
+        auto s = gen_spike(local_start_id+i, rank);
+        s.time = 10 + 0.123*i;
+        local_spikes.push_back(s);
+    }
+
+    const auto global_spikes = g_context->distributed->gather_spikes_compact(local_spikes, resolution);
+
+    const auto& part = global_spikes.partition();
+    EXPECT_EQ(unsigned(num_domains+1), part.size());
+    EXPECT_EQ(0, (int)part[0]);
+    for (auto i=1u; i<part.size(); ++i) {
+        EXPECT_EQ(sumn(i-1), (int)part[i]);
+    }
+
+    for (auto domain=0; domain<num_domains; ++domain) {
+        auto source = sumn(domain-1);
+        const auto first_spike = global_spikes.values().begin() + sumn(domain-1);
+        const auto last_spike  = global_spikes.values().begin() + sumn(domain);
+        int i = 0;
+        for (auto s: util::make_range(first_spike, last_spike)) {
+            EXPECT_EQ(get_value(s), domain);
+            EXPECT_EQ(get_source(s), source++);
+            // Times half-way between two ticks may round either way.
+            EXPECT_NEAR(10 + 0.123*i++, s.time, resolution/2*(1+1e-6));
+        }
+    }
+}
+
 // Test low level gids_gather function when the number of gids per domain
 // are not equal.
 TEST(communicator, gather_gids_variant) {
@@ -495,3 +578,190 @@ TEST(communicator, all2all)
     // odd-numbered cells fire
     EXPECT_TRUE(test_all2all(D, C, [](cell_gid_type g){return g%2==1;}));
 }
+
+namespace {
+    // Ring of cells, where each cell has three parallel connections with
+    // delay 1 from the preceding cell and one connection with delay 2.
+    class multapse_recipe: public recipe {
+    public:
+        multapse_recipe(cell_size_type s, bool fold):
+            size_(s), fold_(fold)
+        {}
+
+        cell_size_type num_cells() const override {
+            return size_;
+        }
+
+        util::unique_any get_cell_description(cell_gid_type) const override {
+            return {};
+        }
+
+        cell_kind get_cell_kind(cell_gid_type gid) const override {
+            return gid%2? cell_kind::cable: cell_kind::spike_source;
+        }
+
+        cell_size_type num_sources(cell_gid_type) const override { return 1; }
+        cell_size_type num_targets(cell_gid_type) const override { return 1; }
+
+        std::vector<cell_connection> connections_on(cell_gid_type gid) const override {
+            cell_member_type src = {gid==0? size_-1: gid-1, 0};
+            cell_member_type dst = {gid, 0};
+            return {
+                cell_connection(src, dst, 1.0f, 1.0f),
+                cell_connection(src, dst, 0.5f, 2.0f),
+                cell_connection(src, dst, 2.0f, 1.0f),
+                cell_connection(src, dst, 4.0f, 1.0f)};
+        }
+
+        bool fold_connections() const override { return fold_; }
+
+    private:
+        cell_size_type size_;
+        bool fold_;
+    };
+}
+
+TEST(communicator, fold_connections)
+{
+    unsigned N = g_context->distributed->size();
+    unsigned n_global = 10u*N;
+
+    for (bool fold: {false, true}) {
+        auto R = multapse_recipe(n_global, fold);
+        const auto D = partition_load_balance(R, g_context);
+        auto C = communicator(R, D, *g_context);
+
+        auto n_local = D.num_local_cells;
+        EXPECT_EQ(fold? 2*n_local: 4*n_local, C.connections().size());
+        EXPECT_EQ(fold? 2*n_local: 0u, C.num_folded_connections());
+
+        // Every cell fires once at time gid.
+        auto gids = get_gids(D);
+        std::vector<spike> local_spikes;
+        for (auto gid: gids) {
+            local_spikes.push_back(make_spike(gid));
+        }
+        auto global_spikes = C.exchange(local_spikes);
+
+        std::vector<arb::pse_vector> queues(C.num_local_cells());
+        C.make_event_queues(global_spikes, queues);
+
+        // Each cell receives the same total weight at each delay.
+        for (auto i: util::count_along(gids)) {
+            auto gid = gids[i];
+            auto t = source_of(gid, n_global);
+            float w1 = 0, w2 = 0;
+            unsigned n_events = 0;
+            for (auto& e: queues[i]) {
+                EXPECT_EQ(gid, e.target.gid);
+                ++n_events;
+                if (e.time==t+1.0) w1 += e.weight;
+                else if (e.time==t+2.0) w2 += e.weight;
+                else ADD_FAILURE() << "unexpected event " << e;
+            }
+            EXPECT_EQ(fold? 2u: 4u, n_events);
+            EXPECT_EQ(7.0f, w1);
+            EXPECT_EQ(0.5f, w2);
+        }
+    }
+}
+
+namespace {
+    // Cells with fan_in connections each, from sources spread over all cells
+    // and with a varying number of sources per cell.
+    class fan_in_recipe: public recipe {
+    public:
+        fan_in_recipe(cell_size_type s, cell_size_type fan_in):
+            size_(s), fan_in_(fan_in)
+        {}
+
+        cell_size_type num_cells() const override {
+            return size_;
+        }
+
+        util::unique_any get_cell_description(cell_gid_type) const override {
+            return {};
+        }
+
+        cell_kind get_cell_kind(cell_gid_type gid) const override {
+            return gid%2? cell_kind::cable: cell_kind::spike_source;
+        }
+
+        cell_size_type num_sources(cell_gid_type gid) const override { return 1+gid%3; }
+        cell_size_type num_targets(cell_gid_type) const override { return fan_in_; }
+
+        std::vector<cell_connection> connections_on(cell_gid_type gid) const override {
+            std::vector<cell_connection> cons;
+            for (cell_size_type j = 0; j<fan_in_; ++j) {
+                cell_gid_type src = (7*gid+13*j)%size_;
+                cons.emplace_back(
+                    cell_member_type{src, j%num_sources(src)},
+                    cell_member_type{gid, j},
+                    float(gid+0.01*j),
+                    float(1+j%3));
+            }
+            return cons;
+        }
+
+    private:
+        cell_size_type size_;
+        cell_size_type fan_in_;
+    };
+}
+
+// Connections are validated and placed in parallel over blocks of cells; the
+// result must be that of a serial pass over the cells, for any number of
+// threads, with and without the cache of the number of sources.
+TEST(communicator, parallel_construction)
+{
+    unsigned N = g_context->distributed->size();
+    unsigned n_global = 20u*N;
+
+    // Fewer local connections than cells leaves the number of sources
+    // uncached.
+    for (cell_size_type fan_in: {1u, 3u, 2*n_global}) {
+        auto R = fan_in_recipe(n_global, fan_in);
+        const auto D = partition_load_balance(R, g_context);
+
+        // Serial construction: connections in order of local cell, stably
+        // partitioned by the domain of their source, then sorted by source
+        // in each domain.
+        std::vector<connection> expected;
+        cell_size_type index = 0;
+        for (auto gid: get_gids(D)) {
+            for (auto& c: R.connections_on(gid)) {
+                expected.emplace_back(c.source, c.dest, c.weight, c.delay, index);
+            }
+            ++index;
+        }
+        std::stable_sort(expected.begin(), expected.end(),
+            [&](const connection& a, const connection& b) {
+                return D.gid_domain(a.source().gid)<D.gid_domain(b.source().gid);
+            });
+        std::vector<cell_size_type> domain_counts(N);
+        for (auto& c: expected) {
+            ++domain_counts[D.gid_domain(c.source().gid)];
+        }
+        std::vector<cell_size_type> domain_divs;
+        auto part = util::make_partition(domain_divs, domain_counts);
+        for (auto d: util::make_span(N)) {
+            util::sort(util::subrange_view(expected, part[d].first, part[d].second));
+        }
+
+        for (unsigned n_thread: {1u, 2u, 3u, 4u, 7u}) {
+            execution_context ctx(proc_allocation(n_thread, -1));
+            ctx.distributed = g_context->distributed;
+            auto C = communicator(R, D, ctx);
+
+            const auto& cons = C.connections();
+            ASSERT_EQ(expected.size(), cons.size());
+            for (auto i: util::count_along(cons)) {
+                EXPECT_EQ(expected[i].source(), cons[i].source());
+                EXPECT_EQ(expected[i].destination(), cons[i].destination());
+                EXPECT_EQ(expected[i].weight(), cons[i].weight());
+                EXPECT_EQ(expected[i].delay(), cons[i].delay());
+                EXPECT_EQ(expected[i].index_on_domain(), cons[i].index_on_domain());
+            }
+        }
+    }
+}
@@ -94,6 +94,49 @@ TEST(mpi, gather_all_with_partition) {
     EXPECT_EQ(expected_divisions, gathered.partition());
 }
 
+TEST(mpi, gather_with_partition) {
+    int id = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    // rank i contributes i items.
+    std::vector<big_thing> data;
+    for (int i = 0; i<id; ++i) {
+        data.push_back(id*100+i);
+    }
+
+    auto gathered = mpi::gather_with_partition(data, 0, MPI_COMM_WORLD);
+
+    if (!id) {
+        std::vector<big_thing> expected_values;
+        std::vector<unsigned> expected_divisions = {0};
+        for (int r = 0; r<size; ++r) {
+            for (int i = 0; i<r; ++i) {
+                expected_values.push_back(r*100+i);
+            }
+            expected_divisions.push_back(expected_values.size());
+        }
+
+        EXPECT_EQ(expected_values, gathered.values());
+        EXPECT_EQ(expected_divisions, gathered.partition());
+    }
+    else {
+        EXPECT_EQ(0u, gathered.size());
+    }
+}
+
+TEST(mpi, broadcast_vector) {
+    int id = mpi::rank(MPI_COMM_WORLD);
+
+    std::vector<int> expected = {1, 2, 3, 5, 8};
+    std::vector<int> data;
+    if (!id) {
+        data = expected;
+    }
+
+    mpi::broadcast(data, 0, MPI_COMM_WORLD);
+    EXPECT_EQ(expected, data);
+}
+
 TEST(mpi, gather_string) {
     int id = mpi::rank(MPI_COMM_WORLD);
     int size = mpi::size(MPI_COMM_WORLD);
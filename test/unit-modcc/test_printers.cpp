@@ -9,6 +9,7 @@
 #include "printer/cexpr_emit.hpp"
 #include "printer/cprinter.hpp"
 #include "printer/gpuprinter.hpp"
+#include "printer/printerutil.hpp"
 #include "expression.hpp"
 #include "symdiff.hpp"
 
@@ -331,3 +332,82 @@ TEST(SimdPrinter, simd_if_else) {
 
     }
 }
+
+static std::unique_ptr<Module> make_net_receive_module(const std::string& net_receive) {
+    std::string src =
+        "NEURON { POINT_PROCESS syn RANGE e NONSPECIFIC_CURRENT i }\n"
+        "PARAMETER { e = 0 }\n"
+        "ASSIGNED { factor }\n"
+        "STATE { A B }\n"
+        "INITIAL { A = 0 B = 0 factor = 1 }\n"
+        "BREAKPOINT { i = (B - A)*(v - e) }\n"
+        + net_receive;
+
+    auto m = std::make_unique<Module>(src.c_str(), src.c_str()+src.size(), "");
+    Parser p(*m, false);
+    EXPECT_TRUE(p.parse());
+    EXPECT_TRUE(m->semantic());
+    return m;
+}
+
+TEST(CPrinter, net_receive_increments) {
+    auto targets = [](const std::string& net_receive) {
+        auto m = make_net_receive_module(net_receive);
+        std::vector<std::string> names;
+        for (auto& inc: net_receive_increments(find_net_receive(*m))) {
+            names.push_back(inc.target->name());
+        }
+        return names;
+    };
+
+    using names = std::vector<std::string>;
+
+    EXPECT_EQ(names{"A"}, targets("NET_RECEIVE(weight) { A = A + weight }"));
+    EXPECT_EQ((names{"A", "B"}), targets("NET_RECEIVE(weight) { A = A + weight*factor B = factor*weight + B }"));
+
+    // Not accumulate-only:
+    EXPECT_TRUE(targets("NET_RECEIVE(weight) { A = A*weight }").empty());
+    EXPECT_TRUE(targets("NET_RECEIVE(weight) { A = B + weight }").empty());
+    EXPECT_TRUE(targets("NET_RECEIVE(weight) { A = A + weight B = B + A }").empty());
+    EXPECT_TRUE(targets("NET_RECEIVE(weight) { A = A + weight factor = 2 }").empty());
+    EXPECT_TRUE(targets("NET_RECEIVE(weight) { if (weight>0) { A = A + weight } }").empty());
+}
+
+TEST(SimdPrinter, net_receive_batch) {
+    printer_options opt;
+    opt.simd = simd_spec(simd_spec::avx2);
+
+    auto m = make_net_receive_module("NET_RECEIVE(weight) { A = A + weight*factor B = B + weight }");
+    auto text = strip(emit_cpp_source(*m, opt));
+    EXPECT_NE(std::string::npos, text.find(strip(
+        "indirect(A, index_, simd_width_, index_constraint::independent) += "
+        "S::mul(weight, simd_cast<simd_value>(indirect(factor, index_, simd_width_)));")));
+    EXPECT_NE(std::string::npos, text.find(strip(
+        "indirect(B, index_, simd_width_, index_constraint::independent) += weight;")));
+
+    // A batch with a repeated target is delivered one event at a time.
+    EXPECT_NE(std::string::npos, text.find(strip(
+        "independent_ &= event_index_[j_]!=event_index_[k_];")));
+    EXPECT_NE(std::string::npos, text.find(strip(
+        "if (!independent_) {"
+        "for (unsigned j_ = 0; j_<simd_width_; ++j_) {"
+        "net_receive(event_index_[j_], event_weight_[j_]);")));
+
+    // Events are staged in arrays of simd_width_ elements, which is non-zero
+    // also for SVE, where the vector length is only known at run time.
+    for (auto abi: {simd_spec::avx2, simd_spec::sve}) {
+        opt.simd = simd_spec(abi);
+        auto text = strip(emit_cpp_source(*m, opt));
+        EXPECT_NE(std::string::npos, text.find(strip("index_type event_index_[simd_width_] = {};")));
+        EXPECT_NE(std::string::npos, text.find(strip("value_type event_weight_[simd_width_] = {};")));
+        EXPECT_NE(std::string::npos, text.find(strip("assign(index_, indirect(event_index_, simd_width_));")));
+        EXPECT_NE(std::string::npos, text.find(strip("assign(weight, indirect(event_weight_, simd_width_));")));
+    }
+
+    // No batched delivery without explicit vectorization, or when the
+    // NET_RECEIVE block is not accumulate-only.
+    EXPECT_EQ(std::string::npos, strip(emit_cpp_source(*m, printer_options{})).find("event_index_"));
+
+    m = make_net_receive_module("NET_RECEIVE(weight) { A = A*weight }");
+    EXPECT_EQ(std::string::npos, strip(emit_cpp_source(*m, opt)).find("event_index_"));
+}
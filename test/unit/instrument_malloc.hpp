@@ -20,7 +20,7 @@
 
 #include <cstddef>
 
-#if (__GLIBC__==2)
+#if (__GLIBC__==2) && (__GLIBC_MINOR__<34)
 #include <malloc.h>
 #define CAN_INSTRUMENT_MALLOC
 #endif
@@ -2,6 +2,8 @@
 
 #include <stdexcept>
 
+#include <arbor/arbexcept.hpp>
+#include <arbor/cable_cell.hpp>
 #include <arbor/context.hpp>
 #include <arbor/domain_decomposition.hpp>
 #include <arbor/load_balance.hpp>
@@ -355,3 +357,45 @@ TEST(domain_decomposition, compulsory_groups)
     EXPECT_EQ(expected_groups2, D2.groups[0].gids);
 
 }
+
+TEST(domain_decomposition, tune_group_size) {
+    auto ctx = make_context();
+
+    homogeneous_recipe<cell_kind::cable, cable_cell> rec(20, make_cell_ball_and_stick());
+
+    partition_hint_map hints;
+    hints[cell_kind::cable].prefer_gpu = false;
+
+    group_size_tuning opts;
+    opts.group_sizes = {1, 4, 16};
+    opts.steps = 2;
+
+    auto result = tune_cpu_group_size(rec, ctx, hints, opts);
+
+    ASSERT_EQ(3u, result.trials.size());
+    const group_size_trial* best = nullptr;
+    for (unsigned i = 0; i<3; ++i) {
+        const auto& t = result.trials[i];
+        EXPECT_EQ(cell_kind::cable, t.kind);
+        EXPECT_EQ(opts.group_sizes[i], t.group_size);
+        EXPECT_GT(t.throughput, 0.);
+        if (!best || t.throughput>best->throughput) best = &t;
+    }
+
+    // The hints are kept, with the size of the best trial.
+    ASSERT_EQ(1u, result.hints.count(cell_kind::cable));
+    const auto& hint = result.hints.at(cell_kind::cable);
+    EXPECT_FALSE(hint.prefer_gpu);
+    EXPECT_EQ(best->group_size, hint.cpu_group_size);
+
+    domain_decomposition D = partition_load_balance(rec, ctx, result.hints);
+    for (auto& g: D.groups) {
+        EXPECT_LE(g.gids.size(), hint.cpu_group_size);
+    }
+
+    // Invalid options.
+    opts.group_sizes = {1, 0};
+    EXPECT_THROW(tune_cpu_group_size(rec, ctx, hints, opts), arbor_exception);
+    opts.group_sizes = {};
+    EXPECT_THROW(tune_cpu_group_size(rec, ctx, hints, opts), arbor_exception);
+}
@@ -44,6 +44,9 @@ TEST(dry_run_context, minmax)
 
     EXPECT_EQ(1u,  ctx->min(1u));
     EXPECT_EQ(1u,  ctx->max(1u));
+
+    std::vector<unsigned> widths = {3u, 0u};
+    EXPECT_EQ(widths, ctx->max(widths));
 }
 
 TEST(dry_run_context, sum)
@@ -54,6 +57,9 @@ TEST(dry_run_context, sum)
     EXPECT_EQ(42.f * num_ranks, ctx->sum(42.f));
     EXPECT_EQ(int(42 * num_ranks), ctx->sum(42));
     EXPECT_EQ(unsigned(42 * num_ranks), ctx->sum(42u));
+
+    std::vector<double> expected = {1. * num_ranks, 2. * num_ranks};
+    EXPECT_EQ(expected, ctx->sum(std::vector<double>{1., 2.}));
 }
 
 TEST(dry_run_context, gather_spikes)
@@ -1,5 +1,6 @@
 #include "../gtest.h"
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -114,6 +115,36 @@ TEST(event_queue, pop_if_not_after) {
     EXPECT_FALSE(e4);
 }
 
+// Spike events with equal times are popped in order of target and weight,
+// whatever the order in which they were pushed.
+TEST(event_queue, equal_times) {
+    std::vector<spike_event> events = {
+        {{1u, 0u}, 2., 0.5f},
+        {{0u, 1u}, 2., 0.25f},
+        {{1u, 0u}, 2., 0.125f},
+        {{0u, 0u}, 2., 1.f},
+        {{0u, 1u}, 1., 2.f}
+    };
+
+    std::vector<spike_event> expected = events;
+    std::sort(expected.begin(), expected.end());
+
+    for (int i = 0; i<5; ++i) {
+        std::rotate(events.begin(), events.begin()+1, events.end());
+
+        event_queue<spike_event> q;
+        for (auto& ev: events) {
+            q.push(ev);
+        }
+
+        std::vector<spike_event> popped;
+        while (auto ev = q.pop_if_not_after(2.)) {
+            popped.push_back(*ev);
+        }
+        EXPECT_EQ(expected, popped);
+    }
+}
+
 // Event queues can be defined for arbitrary copy-constructible events
 // for which `event_time(ev)` returns the corresponding time. Time values just
 // need to be well-ordered on '>'.
@@ -1,3 +1,7 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
 #include <limits>
 #include <string>
 #include <vector>
@@ -10,6 +14,7 @@
 #include "arbor/morph/morphology.hpp"
 #include "arbor/morph/segment_tree.hpp"
 #include "fvm_layout.hpp"
+#include "fvm_layout_cache.hpp"
 #include "util/maputil.hpp"
 #include "util/rangeutil.hpp"
 #include "util/span.hpp"
@@ -1128,3 +1133,155 @@ TEST(fvm_layout, iinterp) {
         EXPECT_EQ(-fc2, I.distal_coef);
     }
 }
+
+namespace {
+    void check_same_layout(
+        const fvm_cv_discretization& D0, const fvm_mechanism_data& M0,
+        const fvm_cv_discretization& D1, const fvm_mechanism_data& M1)
+    {
+        EXPECT_EQ(D0.geometry.cv_cables, D1.geometry.cv_cables);
+        EXPECT_EQ(D0.geometry.cv_cables_divs, D1.geometry.cv_cables_divs);
+        EXPECT_EQ(D0.geometry.cv_parent, D1.geometry.cv_parent);
+        EXPECT_EQ(D0.geometry.cv_children, D1.geometry.cv_children);
+        EXPECT_EQ(D0.geometry.cv_children_divs, D1.geometry.cv_children_divs);
+        EXPECT_EQ(D0.geometry.cv_to_cell, D1.geometry.cv_to_cell);
+        EXPECT_EQ(D0.geometry.cell_cv_divs, D1.geometry.cell_cv_divs);
+        EXPECT_EQ(D0.geometry.branch_cv_map, D1.geometry.branch_cv_map);
+        EXPECT_EQ(D0.face_conductance, D1.face_conductance);
+        EXPECT_EQ(D0.cv_area, D1.cv_area);
+        EXPECT_EQ(D0.cv_capacitance, D1.cv_capacitance);
+        EXPECT_EQ(D0.init_membrane_potential, D1.init_membrane_potential);
+        EXPECT_EQ(D0.temperature_K, D1.temperature_K);
+        EXPECT_EQ(D0.diam_um, D1.diam_um);
+        EXPECT_EQ(D0.axial_resistivity, D1.axial_resistivity);
+
+        ASSERT_EQ(M0.mechanisms.size(), M1.mechanisms.size());
+        for (auto& kv: M0.mechanisms) {
+            SCOPED_TRACE(kv.first);
+            ASSERT_TRUE(M1.mechanisms.count(kv.first));
+            const auto& c0 = kv.second;
+            const auto& c1 = M1.mechanisms.at(kv.first);
+            EXPECT_EQ(c0.kind, c1.kind);
+            EXPECT_EQ(c0.cv, c1.cv);
+            EXPECT_EQ(c0.multiplicity, c1.multiplicity);
+            EXPECT_EQ(c0.norm_area, c1.norm_area);
+            EXPECT_EQ(c0.target, c1.target);
+            EXPECT_EQ(c0.param_values, c1.param_values);
+        }
+
+        ASSERT_EQ(M0.ions.size(), M1.ions.size());
+        for (auto& kv: M0.ions) {
+            SCOPED_TRACE(kv.first);
+            const auto& c0 = kv.second;
+            ASSERT_TRUE(M1.ions.count(kv.first));
+            const auto& c1 = M1.ions.at(kv.first);
+            EXPECT_EQ(c0.cv, c1.cv);
+            EXPECT_EQ(c0.init_iconc, c1.init_iconc);
+            EXPECT_EQ(c0.init_econc, c1.init_econc);
+            EXPECT_EQ(c0.reset_iconc, c1.reset_iconc);
+            EXPECT_EQ(c0.reset_econc, c1.reset_econc);
+            EXPECT_EQ(c0.init_revpot, c1.init_revpot);
+        }
+
+        EXPECT_EQ(M0.n_target, M1.n_target);
+        EXPECT_EQ(M0.target_divs, M1.target_divs);
+    }
+} // namespace
+
+TEST(fvm_layout, cache) {
+    auto system = two_cell_system();
+    auto& descriptions = system.descriptions;
+    descriptions[0].decorations.place(system.builders[0].location({1, 0.4}), "expsyn");
+    descriptions[1].decorations.place(system.builders[1].location({3, 0.4}), "expsyn");
+    descriptions[1].decorations.place(system.builders[1].location({2, 0.5}), "exp2syn");
+
+    // Cells 0 and 2 share a cache entry.
+    descriptions.push_back(descriptions[0]);
+    auto cells = system.cells();
+
+    cable_cell_global_properties gprop;
+    gprop.default_parameters = neuron_parameter_defaults;
+
+    fvm_cv_discretization D = fvm_cv_discretize(cells, gprop.default_parameters);
+    fvm_mechanism_data M = fvm_build_mechanism_data(gprop, cells, D);
+
+    char dir_template[] = "/tmp/arbor-test-XXXXXX";
+    ASSERT_TRUE(mkdtemp(dir_template));
+    std::string dir = dir_template;
+
+    std::vector<std::string> keys;
+    for (auto& c: cells) {
+        keys.push_back(fvm_layout_cache_key(c, gprop));
+        EXPECT_FALSE(fvm_layout_cache_load(dir, keys.back()));
+    }
+    EXPECT_NE(keys[0], keys[1]);
+    EXPECT_EQ(keys[0], keys[2]);
+
+    // Populate the cache, then build again from the cached entries.
+    {
+        auto [D1, M1] = fvm_build_layout_cached(dir, gprop, cells);
+        check_same_layout(D, M, D1, M1);
+        for (auto k: keys) EXPECT_TRUE(fvm_layout_cache_load(dir, k));
+
+        auto [D2, M2] = fvm_build_layout_cached(dir, gprop, cells);
+        check_same_layout(D, M, D2, M2);
+    }
+
+    // Damaged or truncated entries are misses, and are replaced.
+    {
+        auto path = fvm_layout_cache_path(dir, keys[1]);
+        std::string bytes;
+        {
+            std::ifstream in(path, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+
+        std::string damaged = bytes;
+        damaged[bytes.size()/2] ^= 1;
+        std::ofstream(path, std::ios::binary|std::ios::trunc) << damaged;
+        EXPECT_FALSE(fvm_layout_cache_load(dir, keys[1]));
+
+        std::ofstream(path, std::ios::binary|std::ios::trunc) << bytes.substr(0, bytes.size()-3);
+        EXPECT_FALSE(fvm_layout_cache_load(dir, keys[1]));
+
+        auto [D1, M1] = fvm_build_layout_cached(dir, gprop, cells);
+        check_same_layout(D, M, D1, M1);
+        EXPECT_TRUE(fvm_layout_cache_load(dir, keys[1]));
+    }
+
+    // An entry for a different key under the same file name, as left by a
+    // hash collision, is a miss.
+    {
+        auto path = fvm_layout_cache_path(dir, keys[1]);
+        std::string bytes;
+        {
+            std::ifstream in(fvm_layout_cache_path(dir, keys[0]), std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+
+        std::ofstream(path, std::ios::binary|std::ios::trunc) << bytes;
+        EXPECT_FALSE(fvm_layout_cache_load(dir, keys[1]));
+
+        auto [D1, M1] = fvm_build_layout_cached(dir, gprop, cells);
+        check_same_layout(D, M, D1, M1);
+        EXPECT_TRUE(fvm_layout_cache_load(dir, keys[1]));
+    }
+
+    // Changes to global properties and to the discretization policy change the key.
+    {
+        auto gprop_temp = gprop;
+        gprop_temp.default_parameters.temperature_K = 300;
+        EXPECT_NE(keys[0], fvm_layout_cache_key(cells[0], gprop_temp));
+
+        auto gprop_coalesce = gprop;
+        gprop_coalesce.coalesce_synapses = false;
+        EXPECT_NE(keys[0], fvm_layout_cache_key(cells[0], gprop_coalesce));
+
+        auto desc_cv = descriptions[0];
+        desc_cv.decorations.set_default(cv_policy_fixed_per_branch(7));
+        EXPECT_NE(keys[0], fvm_layout_cache_key(cable_cell(desc_cv), gprop));
+    }
+
+    for (auto k: keys) std::remove(fvm_layout_cache_path(dir, k).c_str());
+    EXPECT_EQ(0, std::remove(dir.c_str()));
+}
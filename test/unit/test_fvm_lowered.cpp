@@ -1,3 +1,4 @@
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -8,6 +9,7 @@
 #include <arbor/fvm_types.hpp>
 #include <arbor/load_balance.hpp>
 #include <arbor/math.hpp>
+#include <arbor/mechcat.hpp>
 #include <arbor/cable_cell.hpp>
 #include <arbor/recipe.hpp>
 #include <arbor/sampling.hpp>
@@ -15,6 +17,7 @@
 #include <arbor/schedule.hpp>
 #include <arbor/string_literals.hpp>
 #include <arbor/util/any_ptr.hpp>
+#include <arbor/version.hpp>
 
 #include <arborenv/concurrency.hpp>
 
@@ -527,6 +530,101 @@ TEST(fvm_lowered, derived_mechs) {
     }
 }
 
+TEST(fvm_lowered, set_mechanism_parameter) {
+    // Ball and stick cell with passive membrane of differing reversal
+    // potential on soma and dendrite, and the 'test_kin1' mechanism with
+    // global parameter tau.
+
+    soma_cell_builder builder(6);
+    builder.add_branch(0, 100, 0.5, 0.5, 4, "dend");
+    auto desc = builder.make_cell();
+    desc.decorations.paint("\"soma\"", mechanism_desc("pas").set("e", -60));
+    desc.decorations.paint("\"dend\"", mechanism_desc("pas").set("e", -70));
+    desc.decorations.paint(reg::all(), "test_kin1");
+
+    cable1d_recipe rec({cable_cell{desc}});
+    rec.catalogue() = make_unit_test_catalogue(global_default_catalogue());
+    rec.add_probe(0, 0, cable_probe_membrane_voltage{builder.location({1, 0.5})});
+
+    {
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map probe_map;
+
+        execution_context context;
+        fvm_cell fvcell(context);
+        fvcell.initialize({0}, rec, cell_to_intdom, targets, probe_map);
+
+        auto pas = dynamic_cast<multicore::mechanism*>(find_mechanism(fvcell, "pas"));
+        auto kin = dynamic_cast<multicore::mechanism*>(find_mechanism(fvcell, "test_kin1"));
+        ASSERT_TRUE(pas);
+        ASSERT_TRUE(kin);
+
+        auto e = mechanism_field(pas, "e");
+        EXPECT_DOUBLE_EQ(-60., *std::max_element(e.begin(), e.end()));
+        EXPECT_DOUBLE_EQ(-70., *std::min_element(e.begin(), e.end()));
+
+        fvcell.set_mechanism_parameter("pas", "e", -50);
+        EXPECT_EQ(std::vector<fvm_value_type>(pas->size(), -50.), mechanism_field(pas, "e"));
+
+        fvcell.set_mechanism_parameter("test_kin1", "tau", 5);
+        auto opt_tau_ptr = util::value_by_key((kin->*private_global_table_ptr)(), "tau"s);
+        ASSERT_TRUE(opt_tau_ptr);
+        EXPECT_EQ(5., *opt_tau_ptr.value());
+
+        // Mechanisms not on the cell are ignored; unknown parameters and
+        // state variables are errors.
+        EXPECT_NO_THROW(fvcell.set_mechanism_parameter("hh", "gnabar", 0.1));
+        EXPECT_THROW(fvcell.set_mechanism_parameter("pas", "foo", 0), no_such_parameter);
+        EXPECT_THROW(fvcell.set_mechanism_parameter("test_kin1", "x", 0), no_such_parameter);
+    }
+
+    {
+        // A simulation with overridden parameters, after reset, should match
+        // one built with those parameters.
+
+        auto run = [](simulation& sim) {
+            std::vector<double> samples;
+            sim.add_sampler(all_probes, regular_schedule(1.),
+                [&](probe_metadata, std::size_t n, const sample_record* records) {
+                    for (std::size_t i = 0; i<n; ++i) {
+                        samples.push_back(*util::any_cast<const double*>(records[i].data));
+                    }
+                });
+            sim.run(20., 0.025);
+            sim.remove_all_samplers();
+            return samples;
+        };
+
+        auto ctx = make_context();
+        simulation sim(rec, partition_load_balance(rec, ctx), ctx);
+        auto v_painted = run(sim);
+
+        sim.set_mechanism_parameter("pas", "e", -50);
+        sim.set_mechanism_parameter("test_kin1", "tau", 5);
+        sim.reset();
+        auto v_set = run(sim);
+
+        auto desc_set = builder.make_cell();
+        desc_set.decorations.paint(reg::all(), mechanism_desc("pas").set("e", -50));
+        desc_set.decorations.paint(reg::all(), "custom_kin1");
+
+        cable1d_recipe rec_set({cable_cell{desc_set}});
+        rec_set.catalogue() = make_unit_test_catalogue(global_default_catalogue());
+        rec_set.catalogue().derive("custom_kin1", "test_kin1", {{"tau", 5.0}});
+        rec_set.add_probe(0, 0, cable_probe_membrane_voltage{builder.location({1, 0.5})});
+
+        simulation sim_set(rec_set, partition_load_balance(rec_set, ctx), ctx);
+        auto v_expected = run(sim_set);
+
+        ASSERT_EQ(v_expected.size(), v_set.size());
+        EXPECT_NE(v_painted, v_set);
+        for (std::size_t i = 0; i<v_set.size(); ++i) {
+            EXPECT_DOUBLE_EQ(v_expected[i], v_set[i]);
+        }
+    }
+}
+
 // Test that ion charge is propagated into mechanism variable.
 
 TEST(fvm_lowered, read_valence) {
@@ -1207,3 +1305,197 @@ TEST(fvm_lowered, integration_domains) {
     }
 }
 
+
+// Work of a multicore cell group shared over a thread team must give the
+// same results as the work done by one thread.
+
+TEST(fvm_lowered, thread_team) {
+    using namespace arb::literals;
+    const unsigned n_cell = 32;
+
+    soma_cell_builder builder(12.6157/2.0);
+    builder.add_branch(0, 200, 0.5, 0.5, 4, "dend");
+
+    std::vector<cable_cell> cells;
+    for (unsigned i = 0; i<n_cell; ++i) {
+        auto desc = builder.make_cell();
+        desc.decorations.paint("soma"_lab, "hh");
+        desc.decorations.paint("dend"_lab, "pas");
+        desc.decorations.set_default(cv_policy_fixed_per_branch(64));
+        desc.decorations.place(builder.location({0, 0.5}), threshold_detector{10});
+        // Vary stimulus amplitude so that cells spike at different times.
+        desc.decorations.place(builder.location({1, 1}), i_clamp{2, 40, 0.2+0.02*i});
+        cells.push_back(desc);
+    }
+
+    cable1d_recipe rec(cells);
+    for (unsigned i = 0; i<n_cell; ++i) {
+        rec.add_probe(i, 0, cable_probe_membrane_voltage{builder.location({1, 0.5})});
+    }
+
+    {
+        // Work is partitioned over the team once there is enough of it.
+
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map probe_map;
+
+        std::vector<cell_gid_type> gids(n_cell);
+        std::iota(gids.begin(), gids.end(), 0u);
+
+        arb::proc_allocation resources(4, -1);
+        arb::execution_context context(resources);
+        fvm_cell fvcell(context, 4);
+        fvcell.initialize(gids, rec, cell_to_intdom, targets, probe_map);
+
+        auto& state = *(fvcell.*private_state_ptr).get();
+        EXPECT_EQ(4u, state.team.size);
+        EXPECT_TRUE(state.team.active());
+        EXPECT_EQ(5u, (fvcell.*private_matrix_ptr).state_.team_cell_divs.size());
+    }
+
+    auto run = [&](unsigned n_thread) {
+        std::vector<spike> spikes;
+        std::vector<std::vector<double>> samples(n_cell);
+
+        auto ctx = make_context(proc_allocation(n_thread, -1));
+        partition_hint_map hints = {{cell_kind::cable, {n_cell}}};
+        auto decomp = partition_load_balance(rec, ctx, hints);
+        EXPECT_EQ(1u, decomp.groups.size());
+
+        simulation sim(rec, decomp, ctx);
+        sim.set_global_spike_callback(
+            [&](const std::vector<spike>& s) { spikes.insert(spikes.end(), s.begin(), s.end()); });
+        sim.add_sampler(all_probes, regular_schedule(1.),
+            [&](probe_metadata pm, std::size_t n, const sample_record* records) {
+                for (std::size_t i = 0; i<n; ++i) {
+                    samples[pm.id.gid].push_back(*util::any_cast<const double*>(records[i].data));
+                }
+            });
+        sim.run(50, 0.025);
+
+        return std::make_pair(spikes, samples);
+    };
+
+    auto expected = run(1);
+    auto shared = run(4);
+
+    ASSERT_FALSE(expected.first.empty());
+    ASSERT_EQ(expected.first.size(), shared.first.size());
+    for (std::size_t i = 0; i<expected.first.size(); ++i) {
+        EXPECT_EQ(expected.first[i].source, shared.first[i].source);
+        EXPECT_EQ(expected.first[i].time, shared.first[i].time);
+    }
+    EXPECT_EQ(expected.second, shared.second);
+}
+
+// Cell groups in which every cell has one CV are integrated in one fused pass
+// over the CVs if requested, which must give the same results as the general
+// loop. The fused pass is not used with SIMD mechanism kernels.
+
+TEST(fvm_lowered, single_cv_integration) {
+    using namespace arb::literals;
+    // Enough cells for more than one block of CVs.
+    const unsigned n_cell = 100;
+
+    arb::proc_allocation resources;
+    arb::execution_context context(resources);
+
+    soma_cell_builder builder(12.6157/2.0);
+
+    std::vector<cable_cell> cells;
+    for (unsigned i = 0; i<n_cell; ++i) {
+        auto desc = builder.make_cell();
+        desc.decorations.paint("soma"_lab, "hh");
+        desc.decorations.place(builder.location({0, 0.5}), "expsyn");
+        desc.decorations.place(builder.location({0, 0.5}), threshold_detector{10});
+        if (i%3==0) {
+            desc.decorations.place(builder.location({0, 0.5}), i_clamp{5, 30, 0.05+0.001*i});
+        }
+        cells.push_back(desc);
+    }
+
+    cable1d_recipe rec(cells);
+    for (unsigned i = 0; i<n_cell; ++i) {
+        rec.add_probe(i, 0, cable_probe_membrane_voltage{builder.location({0, 0.5})});
+    }
+
+    {
+        // A cell of more than one CV in the group takes the general loop.
+
+        builder.add_branch(0, 200, 0.5, 0.5, 4, "dend");
+        auto desc = builder.make_cell();
+        desc.decorations.paint("soma"_lab, "hh");
+        desc.decorations.paint("dend"_lab, "pas");
+
+        std::vector<cable_cell> mixed_cells = cells;
+        mixed_cells.push_back(desc);
+        cable1d_recipe mixed_rec(mixed_cells);
+        mixed_rec.cable_properties().fuse_single_cv_integration = true;
+
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map probe_map;
+
+        std::vector<cell_gid_type> gids(n_cell+1);
+        std::iota(gids.begin(), gids.end(), 0u);
+
+        fvm_cell fvcell(context);
+        fvcell.initialize(gids, mixed_rec, cell_to_intdom, targets, probe_map);
+        EXPECT_FALSE(fvcell.single_cv_integration());
+    }
+
+    auto run = [&](bool fused) {
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map probe_map;
+
+        std::vector<cell_gid_type> gids(n_cell);
+        std::iota(gids.begin(), gids.end(), 0u);
+
+        rec.cable_properties().fuse_single_cv_integration = fused;
+
+        fvm_cell fvcell(context);
+        fvcell.initialize(gids, rec, cell_to_intdom, targets, probe_map);
+#ifdef ARB_VECTORIZE_ENABLED
+        EXPECT_FALSE(fvcell.single_cv_integration());
+#else
+        EXPECT_EQ(fused, fvcell.single_cv_integration());
+#endif
+
+        std::vector<threshold_crossing> crossings;
+        std::vector<fvm_value_type> samples;
+
+        // Two events per cell, and one sample per cell and epoch.
+
+        for (unsigned epoch = 0; epoch<50; ++epoch) {
+            std::vector<deliverable_event> events;
+            std::vector<sample_event> sample_events;
+
+            for (unsigned i = 0; i<n_cell; ++i) {
+                for (double t: {1+0.1*i, 20+0.05*i}) {
+                    if (t>=epoch && t<epoch+1) {
+                        events.emplace_back(t, targets[i], 0.05f);
+                    }
+                }
+
+                auto handle = probe_map.data_on({i, 0}).front().raw_handle_range()[0];
+                sample_events.push_back({epoch+0.5, (cell_size_type)cell_to_intdom[i], {handle, (sample_size_type)i}});
+            }
+
+            auto result = fvcell.integrate(epoch+1, 0.025, events, sample_events);
+            util::append(crossings, result.crossings);
+            util::append(samples, result.sample_value);
+        }
+
+        return std::make_pair(crossings, samples);
+    };
+
+    auto expected = run(false);
+    auto fused = run(true);
+
+    EXPECT_FALSE(expected.first.empty());
+    EXPECT_EQ(expected.first, fused.first);
+    EXPECT_EQ(n_cell*50, fused.second.size());
+    EXPECT_EQ(expected.second, fused.second);
+}
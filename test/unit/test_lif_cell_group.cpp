@@ -1,8 +1,13 @@
 #include "../gtest.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include <arbor/arbexcept.hpp>
 #include <arbor/cable_cell.hpp>
 #include <arbor/domain_decomposition.hpp>
+#include <arbor/event_generator.hpp>
 #include <arbor/lif_cell.hpp>
 #include <arbor/load_balance.hpp>
 #include <arbor/recipe.hpp>
@@ -124,6 +129,22 @@ private:
     float weight_, delay_;
 };
 
+// LIF cells in a path, the first driven by an event generator.
+class generator_recipe: public path_recipe {
+public:
+    generator_recipe(cell_size_type n, float weight, float delay, time_type interval):
+        path_recipe(n, weight, delay), interval_(interval)
+    {}
+
+    std::vector<event_generator> event_generators(cell_gid_type gid) const override {
+        if (gid) return {};
+        return {regular_generator({0, 0}, 1000, interval_, interval_)};
+    }
+
+private:
+    time_type interval_;
+};
+
 // LIF cell with probe
 class probe_recipe: public arb::recipe {
 public:
@@ -243,3 +264,43 @@ TEST(lif_cell_group, ring)
     }
 }
 
+TEST(lif_cell_group, queued_events)
+{
+    // Events from the generator and from the first cell reach the cells
+    // through their event queues; most epochs deliver no events at all.
+    generator_recipe recipe(2, 1000, 0.1, 7.5);
+
+    auto context = make_context();
+    auto decomp = partition_load_balance(recipe, context);
+    simulation sim(recipe, decomp, context);
+
+    std::vector<spike> spikes;
+    sim.set_global_spike_callback(
+        [&spikes](const std::vector<spike>& s) { spikes.insert(spikes.end(), s.begin(), s.end()); });
+
+    auto run = [&] {
+        spikes.clear();
+        sim.run(50, 0.01);
+
+        std::vector<std::pair<cell_gid_type, time_type>> result;
+        for (auto& s: spikes) result.push_back({s.source.gid, s.time});
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    auto first = run();
+
+    std::vector<std::pair<cell_gid_type, time_type>> expected;
+    for (int i = 1; i<=6; ++i) expected.push_back({0, 7.5*i});
+    for (int i = 1; i<=6; ++i) expected.push_back({1, 7.5*i+0.1});
+
+    ASSERT_EQ(expected.size(), first.size());
+    for (std::size_t i = 0; i<expected.size(); ++i) {
+        EXPECT_EQ(expected[i].first, first[i].first);
+        EXPECT_NEAR(expected[i].second, first[i].second, 1e-6);
+    }
+
+    // A reset discards queued events and cell state.
+    sim.reset();
+    EXPECT_EQ(first, run());
+}
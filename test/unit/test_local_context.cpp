@@ -46,6 +46,12 @@ TEST(local_context, sum)
     EXPECT_EQ(42.f, ctx.min(42.));
     EXPECT_EQ(42,   ctx.sum(42));
     EXPECT_EQ(42u,  ctx.min(42u));
+
+    std::vector<double> values = {1., 2.};
+    EXPECT_EQ(values, ctx.sum(values));
+
+    std::vector<unsigned> widths = {3u, 0u};
+    EXPECT_EQ(widths, ctx.max(widths));
 }
 
 TEST(local_context, gather)
@@ -78,6 +84,29 @@ TEST(local_context, gather_spikes)
     EXPECT_EQ(part[1], spikes.size());
 }
 
+TEST(local_context, gather_spikes_compact)
+{
+    arb::local_context ctx;
+    using svec = std::vector<arb::spike>;
+
+    svec spikes = {
+        {{0u,3u}, 42.},
+        {{1u,2u}, 42.26},
+        {{2u,1u}, 42.51},
+    };
+
+    auto s = ctx.gather_spikes_compact(spikes, 0.1);
+
+    auto& part = s.partition();
+    EXPECT_EQ(part.size(), 2u);
+    EXPECT_EQ(part[0], 0u);
+    EXPECT_EQ(part[1], spikes.size());
+    for (unsigned i = 0; i<spikes.size(); ++i) {
+        EXPECT_EQ(s.values()[i].source, spikes[i].source);
+        EXPECT_NEAR(s.values()[i].time, spikes[i].time, 0.05);
+    }
+}
+
 TEST(local_context, gather_gids)
 {
     arb::local_context ctx;
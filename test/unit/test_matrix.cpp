@@ -185,3 +185,52 @@ TEST(matrix, zero_diagonal_assembled)
     EXPECT_TRUE(testing::seq_almost_eq<double>(expected, x));
 }
 
+TEST(matrix, single_cv)
+{
+    // Four cells of one CV each, in two integration domains: the system is
+    // diagonal.
+
+    std::vector<index_type> p = {0, 1, 2, 3};
+    std::vector<index_type> c = {0, 1, 2, 3, 4};
+    std::vector<index_type> s = {0, 0, 1, 1};
+
+    vvec g(4, 0);
+    vvec Cm = {1, 2, 3, 4};
+    vvec area = {1, 1, 2, 2};
+
+    array dt = {1.0e-3, 2.0e-3};
+    array v = {-60, -65, -70, -75};
+    array mg = {1000, 2000, 3000, 4000};
+    array i = {-1000, 2000, -3000, 4000};
+
+    matrix_type m(p, c, Cm, g, area, s);
+    EXPECT_TRUE(m.state_.single_cv);
+
+    // Expected solution: x = (gi·v - a·i)/gi, where gi = C/dt + a·mg,
+    // with dt in µs and a = 1e-3·area.
+    auto solution = [&](unsigned k) {
+        double a = 1e-3*area[k];
+        double gi = 1e-3/dt[s[k]]*Cm[k] + a*mg[k];
+        return (gi*v[k] - a*i[k])/gi;
+    };
+
+    array x(4, 0.0);
+    m.assemble(dt, v, i, mg);
+    m.solve(x);
+
+    std::vector<value_type> expected;
+    for (unsigned k = 0; k<4; ++k) expected.push_back(solution(k));
+    EXPECT_TRUE(testing::seq_almost_eq<double>(expected, x));
+
+    // A zero dt leaves the voltage of the domain unchanged.
+    dt[1] = 0;
+    m.assemble(dt, v, i, mg);
+    m.solve(x);
+
+    expected = {solution(0), solution(1), -70, -75};
+    EXPECT_TRUE(testing::seq_almost_eq<double>(expected, x));
+
+    // A cell with more than one CV uses the general solver.
+    matrix_type m2({0, 0, 2}, {0, 2, 3}, vvec(3, 1), vvec{0, 1, 0}, vvec(3, 1), {0, 0});
+    EXPECT_FALSE(m2.state_.single_cv);
+}
@@ -73,6 +73,7 @@ struct common_impl: concrete_mechanism<B> {
     std::size_t size() const override { return width_; }
 
     void set_parameter(const std::string& key, const std::vector<fvm_value_type>& vs) override {}
+    void set_global(const std::string& key, fvm_value_type v) override {}
 
     void initialize() override {}
     void update_state() override {}
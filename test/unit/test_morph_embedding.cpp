@@ -1,13 +1,17 @@
 #include <cmath>
+#include <random>
 #include <unordered_map>
 #include <vector>
 
+#include <arbor/context.hpp>
 #include <arbor/math.hpp>
 #include <arbor/morph/embed_pwlin.hpp>
 #include <arbor/morph/morphology.hpp>
 #include <arbor/morph/primitives.hpp>
 #include <arbor/morph/segment_tree.hpp>
 
+#include "execution_context.hpp"
+#include "threading/threading.hpp"
 #include "util/piecewise.hpp"
 
 #include "../test/gtest.h"
@@ -244,3 +248,47 @@ TEST(embedding, area_0_length_segment) {
     double expected_a2 = expected_a1 + pi*(20*20-10*10);
     EXPECT_TRUE(near_relative(a2, expected_a2, reltol));
 }
+
+TEST(embedding, lazy_and_parallel) {
+    // Random tree of unbranched runs attached to earlier segments.
+    segment_tree tree;
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> step(-1, 1), radius(0.2, 2.);
+    tree.append(mnpos, {0, 0, 0, 5}, {10, 0, 0, 5}, 1);
+    while (tree.size()<2000) {
+        msize_t p = std::uniform_int_distribution<msize_t>(0, tree.size()-1)(gen);
+        for (int i = 0; i<20; ++i) {
+            auto x = tree.segments()[p].dist;
+            p = tree.append(p, {x.x+step(gen), x.y+step(gen), x.z+step(gen), radius(gen)}, 3);
+        }
+    }
+    morphology m(tree);
+    msize_t n_branch = m.num_branches();
+    ASSERT_LT(100u, n_branch);
+
+    // Query the branches from the most distal, before their parents, in a
+    // lazily built embedding, and compare with one built up front.
+
+    auto ctx = make_context(proc_allocation{4, -1});
+    embedding lazy(m), eager(m, ctx);
+    EXPECT_EQ(eager.segment_ends(), lazy.segment_ends());
+
+    for (msize_t b = n_branch; b-->0; ) {
+        mlocation mid{b, 0.5};
+        EXPECT_EQ(eager.radius(mid), lazy.radius(mid));
+        EXPECT_EQ(eager.directed_projection(mid), lazy.directed_projection(mid));
+        EXPECT_EQ(eager.integrate_length(mlocation{0, 0}, mid), lazy.integrate_length(mlocation{0, 0}, mid));
+        EXPECT_EQ(eager.integrate_area(mlocation{0, 0}, mid), lazy.integrate_area(mlocation{0, 0}, mid));
+        EXPECT_EQ(eager.integrate_ixa(mcable{b, 0.1, 0.9}), lazy.integrate_ixa(mcable{b, 0.1, 0.9}));
+    }
+
+    // Copies share the interpolants, and can be queried concurrently.
+    embedding shared(m);
+    std::vector<double> areas(n_branch);
+    threading::parallel_for::apply(0, n_branch, ctx->thread_pool.get(),
+        [&](int b) { areas[b] = embedding(shared).integrate_area(mlocation{0, 0}, mlocation{msize_t(b), 1}); });
+
+    for (msize_t b = 0; b<n_branch; ++b) {
+        EXPECT_EQ(eager.integrate_area(mlocation{0, 0}, mlocation{b, 1}), areas[b]);
+    }
+}
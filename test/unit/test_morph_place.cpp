@@ -8,6 +8,7 @@
 
 #include "util/piecewise.hpp"
 #include "util/rangeutil.hpp"
+#include "util/span.hpp"
 
 #include "../test/gtest.h"
 #include "common_cells.hpp"
@@ -540,4 +541,28 @@ TEST(place_pwlin, segments) {
     EXPECT_TRUE(mpoint_almost_eq(p7d, x3all[1].dist));
     EXPECT_TRUE(mpoint_almost_eq(p8p, x3all[2].prox));
     EXPECT_TRUE(mpoint_almost_eq(p8p, x3all[2].dist));
+
+    // Segments with the cables they cover: the ends of each segment should
+    // be placed at the ends of its cable.
+
+    auto placed_at = [&place](mlocation loc, const mpoint& x) {
+        return util::any_of(place.all_at(loc), [&x](const mpoint& y) { return mpoint_almost_eq(x, y); });
+    };
+
+    auto x1cables = place.segment_cables(x1);
+    std::vector<msegment> x1min_unsorted = place.segments(x1);
+    ASSERT_EQ(x1min_unsorted.size(), x1cables.size());
+    for (auto i: util::count_along(x1cables)) {
+        auto& [c, seg] = x1cables[i];
+        EXPECT_EQ(x1min_unsorted[i].id, seg.id);
+        EXPECT_TRUE(placed_at(prox_loc(c), seg.prox));
+        EXPECT_TRUE(placed_at(dist_loc(c), seg.dist));
+    }
+
+    auto all_cables = place.segment_cables();
+    ASSERT_EQ(9u, all_cables.size());
+    for (auto& [c, seg]: all_cables) {
+        EXPECT_TRUE(placed_at(prox_loc(c), seg.prox));
+        EXPECT_TRUE(placed_at(dist_loc(c), seg.dist));
+    }
 }
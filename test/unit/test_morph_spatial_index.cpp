@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <arbor/context.hpp>
+#include <arbor/math.hpp>
+#include <arbor/morph/morphexcept.hpp>
+#include <arbor/morph/morphology.hpp>
+#include <arbor/morph/place_pwlin.hpp>
+#include <arbor/morph/primitives.hpp>
+#include <arbor/morph/segment_tree.hpp>
+#include <arbor/morph/spatial_index.hpp>
+
+#include "../test/gtest.h"
+
+using namespace arb;
+
+namespace {
+
+// Branching morphology with segments of differing lengths, including
+// a zero-length segment.
+morphology make_tree_morphology() {
+    segment_tree tree;
+    tree.append(mnpos, {0, 0, 0, 5}, {10, 0, 0, 5}, 1);
+    auto a = tree.append(0, {30, 0, 0, 1}, 3);
+    tree.append(a, {60, 10, 0, 1}, 3);
+    auto b = tree.append(0, {20, 20, 0, 1}, 4);
+    auto c = tree.append(b, {20, 20, 0, 1}, 4);
+    tree.append(c, {20, 50, 5, 0.5}, 4);
+    tree.append(b, {40, 40, 40, 0.5}, 4);
+    return {tree};
+}
+
+std::vector<place_pwlin> random_placements(const morphology& m, unsigned n, double extent) {
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<double> pos(0, extent), angle(0, 2*math::pi<double>), unit(-1, 1);
+
+    std::vector<place_pwlin> placements;
+    for (unsigned i = 0; i<n; ++i) {
+        auto iso = isometry::translate(pos(gen), pos(gen), pos(gen))*
+                   isometry::rotate(angle(gen), unit(gen), unit(gen), 1.);
+        placements.emplace_back(m, iso);
+    }
+    return placements;
+}
+
+mpoint lerp(const msegment& s, double u) {
+    return {s.prox.x+u*(s.dist.x-s.prox.x), s.prox.y+u*(s.dist.y-s.prox.y), s.prox.z+u*(s.dist.z-s.prox.z), 0};
+}
+
+// Distance from p to the segment axis by ternary search on the (convex)
+// distance along the segment.
+double brute_distance(const mpoint& p, const msegment& s) {
+    double lo = 0, hi = 1;
+    for (int i = 0; i<100; ++i) {
+        double m1 = lo+(hi-lo)/3, m2 = hi-(hi-lo)/3;
+        if (distance(p, lerp(s, m1))<distance(p, lerp(s, m2))) hi = m2; else lo = m1;
+    }
+    return distance(p, lerp(s, 0.5*(lo+hi)));
+}
+
+double brute_distance(const msegment& a, const msegment& b) {
+    double lo = 0, hi = 1;
+    for (int i = 0; i<100; ++i) {
+        double m1 = lo+(hi-lo)/3, m2 = hi-(hi-lo)/3;
+        if (brute_distance(lerp(a, m1), b)<brute_distance(lerp(a, m2), b)) hi = m2; else lo = m1;
+    }
+    return brute_distance(lerp(a, 0.5*(lo+hi)), b);
+}
+
+auto key(const indexed_location& l) {
+    return std::make_tuple(l.item, l.loc.branch, l.loc.pos);
+}
+
+} // anonymous namespace
+
+TEST(spatial_index, empty) {
+    spatial_index empty({});
+    EXPECT_EQ(0u, empty.size());
+    EXPECT_TRUE(empty.within(mpoint{0, 0, 0, 0}, 1e9).empty());
+    EXPECT_FALSE(empty.nearest(mpoint{0, 0, 0, 0}));
+    EXPECT_TRUE(empty.within(empty, 1e9).empty());
+
+    EXPECT_THROW(spatial_index({place_pwlin(make_tree_morphology())}, std::vector<mextent>{}), morphology_error);
+}
+
+TEST(spatial_index, point_queries) {
+    auto m = make_tree_morphology();
+    auto placements = random_placements(m, 100, 200.);
+
+    spatial_index index(placements);
+    EXPECT_EQ(7u*placements.size(), index.size());
+
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<double> pos(-20, 220);
+
+    for (int q = 0; q<20; ++q) {
+        mpoint p{pos(gen), pos(gen), pos(gen), 0};
+        const double r = 15;
+
+        unsigned n_expected = 0;
+        double min_distance = INFINITY;
+        for (auto& pl: placements) {
+            for (auto& [c, seg]: pl.segment_cables()) {
+                double d = brute_distance(p, seg);
+                n_expected += d<=r;
+                min_distance = std::min(min_distance, d);
+            }
+        }
+
+        auto hits = index.within(p, r);
+        EXPECT_EQ(n_expected, hits.size());
+        for (auto& h: hits) {
+            EXPECT_LE(h.distance, r);
+            EXPECT_NEAR(h.distance, distance(p, placements[h.item].at(h.loc)), 1e-9);
+        }
+
+        auto nearest = index.nearest(p);
+        ASSERT_TRUE(nearest);
+        EXPECT_NEAR(min_distance, nearest->distance, 1e-9);
+        EXPECT_NEAR(nearest->distance, distance(p, placements[nearest->item].at(nearest->loc)), 1e-9);
+    }
+}
+
+TEST(spatial_index, segment_queries) {
+    auto m = make_tree_morphology();
+    auto axons = random_placements(m, 30, 100.);
+    auto dendrites = random_placements(m, 40, 100.);
+
+    // Index only the tag 3 branch of the first set, and all of the second.
+    std::vector<mextent> axon_extents(axons.size(), mextent(mcable_list{{1, 0, 1}}));
+    spatial_index a(axons, axon_extents);
+    spatial_index b(dendrites);
+
+    const double r = 3;
+    auto pairs = a.within(b, r);
+
+    unsigned n_expected = 0;
+    for (auto& pa: axons) {
+        for (auto& [ca, sa]: pa.segment_cables(mextent(mcable_list{{1, 0, 1}}))) {
+            for (auto& pb: dendrites) {
+                for (auto& [cb, sb]: pb.segment_cables()) {
+                    // Skip pairs whose bounding spheres are well separated.
+                    double bound = distance(lerp(sa, 0.5), lerp(sb, 0.5))-0.5*distance(sa.prox, sa.dist)-0.5*distance(sb.prox, sb.dist);
+                    n_expected += bound<=r && brute_distance(sa, sb)<=r;
+                }
+            }
+        }
+    }
+    EXPECT_FALSE(pairs.empty());
+    EXPECT_EQ(n_expected, pairs.size());
+
+    for (auto& [x, y]: pairs) {
+        EXPECT_EQ(1u, x.loc.branch);
+        EXPECT_LE(x.distance, r);
+        EXPECT_EQ(x.distance, y.distance);
+        EXPECT_NEAR(x.distance, distance(axons[x.item].at(x.loc), dendrites[y.item].at(y.loc)), 1e-9);
+    }
+
+    // Every segment touches itself.
+    EXPECT_LE(b.size(), b.within(b, 0).size());
+}
+
+TEST(spatial_index, parallel_build) {
+    auto m = make_tree_morphology();
+    auto placements = random_placements(m, 2000, 1000.);
+
+    auto ctx = make_context(proc_allocation{4, -1});
+    spatial_index serial(placements), parallel(placements, ctx);
+    ASSERT_EQ(serial.size(), parallel.size());
+
+    mpoint p{500, 500, 500, 0};
+    auto by_key = [](const indexed_location& x, const indexed_location& y) { return key(x)<key(y); };
+    auto h1 = serial.within(p, 100);
+    auto h2 = parallel.within(p, 100);
+    std::sort(h1.begin(), h1.end(), by_key);
+    std::sort(h2.begin(), h2.end(), by_key);
+
+    ASSERT_EQ(h1.size(), h2.size());
+    EXPECT_FALSE(h1.empty());
+    for (std::size_t i = 0; i<h1.size(); ++i) {
+        EXPECT_EQ(key(h1[i]), key(h2[i]));
+        EXPECT_EQ(h1[i].distance, h2[i].distance);
+    }
+}
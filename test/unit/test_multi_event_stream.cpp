@@ -2,6 +2,7 @@
 #include "../gtest.h"
 
 #include "backends/event.hpp"
+#include "backends/multicore/deliverable_event_stream.hpp"
 #include "backends/multicore/multi_event_stream.hpp"
 #include "util/rangeutil.hpp"
 
@@ -210,3 +211,62 @@ TEST(multi_event_stream, time_if_before) {
 	}
     }
 }
+
+TEST(deliverable_event_stream, partition) {
+    multicore::deliverable_event_stream m(n_cell);
+    m.add_mechanism(mech_2);
+
+    auto events = common_events;
+    m.init(events);
+    EXPECT_FALSE(m.empty());
+
+    auto marked = [&](cell_local_size_type mech_id, unsigned i) {
+        auto state = m.marked_events(mech_id);
+        std::vector<cell_local_size_type> indices;
+        for (auto p = state.begin_marked(i); p!=state.end_marked(i); ++p) {
+            EXPECT_EQ(mech_id, p->mech_id);
+            indices.push_back(p->mech_index);
+        }
+        return indices;
+    };
+
+    using indices = std::vector<cell_local_size_type>;
+
+    std::vector<double> t_until(n_cell, 6.);
+    m.mark_until_after(t_until);
+
+    // Each mechanism sees only its own events.
+    EXPECT_EQ(indices{0u}, marked(mech_1, cell_1));
+    EXPECT_EQ(indices{4u}, marked(mech_1, cell_2));
+    EXPECT_EQ(indices{}, marked(mech_1, cell_3));
+    EXPECT_EQ(indices{}, marked(mech_2, cell_1));
+    EXPECT_EQ(indices{1u}, marked(mech_2, cell_2));
+    EXPECT_EQ(indices{2u}, marked(mech_2, cell_3));
+
+    // Mechanisms without events have none marked.
+    EXPECT_EQ(indices{}, marked(0u, cell_2));
+    EXPECT_EQ(indices{}, marked(mech_2+1, cell_2));
+
+    m.drop_marked_events();
+    EXPECT_TRUE(m.empty());
+
+    // Events without a mechanism, as used for exact sampling, bound the
+    // integration step, but are not delivered.
+    std::vector<deliverable_event> stops = {deliverable_event(3., target_handle(-1, 0, cell_2), 0.f)};
+    m.init(stops);
+    EXPECT_FALSE(m.empty());
+
+    std::vector<double> t_to(n_cell, 10.);
+    m.event_time_if_before(t_to);
+    EXPECT_EQ(10., t_to[cell_1]);
+    EXPECT_EQ(3., t_to[cell_2]);
+
+    m.mark_until_after(t_to);
+    EXPECT_EQ(indices{}, marked(mech_2, cell_2));
+    m.drop_marked_events();
+    EXPECT_TRUE(m.empty());
+
+    m.init(events);
+    m.clear();
+    EXPECT_TRUE(m.empty());
+}
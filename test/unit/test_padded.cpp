@@ -1,5 +1,8 @@
 #include <cstdint>
 
+#include <arbor/huge_pages.hpp>
+
+#include <memory/memory.hpp>
 #include <util/padded_alloc.hpp>
 
 #include "../gtest.h"
@@ -158,3 +161,27 @@ TEST(padded_vector, instrumented) {
 }
 
 #endif // ifdef CAN_INSTRUMENT_MALLOC
+
+#ifdef __linux__
+TEST(padded_vector, huge_pages) {
+    using arb::huge_page_size;
+    const std::size_t n = huge_page_size/sizeof(double)+1;
+
+    // Allocations at or above the threshold are aligned to huge pages.
+    arb::set_huge_page_threshold(huge_page_size);
+    pvector<double> a(n, 1.0, padded_allocator<double>(64));
+    pvector<double> b(n/4, 1.0, padded_allocator<double>(64));
+    arb::memory::host_vector<double> c(n, 1.0);
+    arb::set_huge_page_threshold(0);
+
+    EXPECT_EQ(0u, arb::huge_page_threshold());
+    EXPECT_TRUE(is_aligned(a.data(), huge_page_size));
+    EXPECT_TRUE(is_aligned(c.data(), huge_page_size));
+    EXPECT_EQ(n, a.size());
+    EXPECT_EQ(1.0, a.back());
+    EXPECT_EQ(1.0, c[n-1]);
+
+    // Below the threshold, the requested alignment is kept.
+    EXPECT_TRUE(is_aligned(b.data(), 64));
+}
+#endif
@@ -6,9 +6,11 @@
 #include <arbor/cable_cell.hpp>
 #include <arbor/common_types.hpp>
 #include <arbor/load_balance.hpp>
+#include <arbor/math.hpp>
 #include <arbor/mechanism.hpp>
 #include <arbor/mechcat.hpp>
 #include <arbor/mechinfo.hpp>
+#include <arbor/morph/place_pwlin.hpp>
 #include <arbor/sampling.hpp>
 #include <arbor/schedule.hpp>
 #include <arbor/simple_sampler.hpp>
@@ -26,6 +28,7 @@
 #include "backends/gpu/fvm.hpp"
 #include "backends/gpu/mechanism.hpp"
 #endif
+#include "extracellular.hpp"
 #include "fvm_lowered_cell_impl.hpp"
 #include "memory/gpu_wrappers.hpp"
 #include "util/filter.hpp"
@@ -1134,6 +1137,120 @@ void run_total_current_probe_test(const context& ctx) {
     }
 }
 
+template <typename Backend>
+void run_extracellular_probe_test(const context& ctx) {
+    // Sample the extracellular potential of a passive Y-shaped cell at a
+    // set of electrodes, and compare it with the potential computed from
+    // the total membrane current of each cable, taken to be uniform over
+    // the cable's surface.
+
+    auto m = make_y_morphology();
+    decor d;
+    d.place(mlocation{0, 0}, i_clamp(0, INFINITY, 0.3));
+    d.paint(reg::all(), mechanism_desc("ca_linear").set("g", 0.01)); // [S/cm²]
+    d.set_default(membrane_capacitance{0.01}); // [F/m²]
+    d.set_default(cv_policy_fixed_per_branch(3, cv_policy_flag::interior_forks));
+    std::vector<cable_cell> cells = {{m, {}, d}};
+
+    const std::vector<mpoint> electrodes = {{0., 20., 0., 0.}, {50., 10., 10., 0.}, {120., 50., 50., 0.}};
+    const double sigma = 0.5; // [S/m]
+    const double t_end = 1.;  // [ms]
+    const std::vector<double> when = {0., 0.1, 0.5};
+
+    auto phi = run_simple_sampler<std::vector<double>, std::vector<mpoint>>(ctx, t_end, cells, 0,
+            cable_probe_extracellular_potential{electrodes, sigma}, when).at(0);
+    auto i_memb = run_simple_sampler<std::vector<double>, mcable_list>(ctx, t_end, cells, 0,
+            cable_probe_total_current_cell{}, when).at(0);
+
+    ASSERT_EQ(when.size(), phi.size());
+    ASSERT_EQ(when.size(), i_memb.size());
+    EXPECT_EQ(electrodes, phi.meta);
+
+    // Potential at each electrode per unit current [nA] on each cable.
+    place_pwlin placement(m);
+    std::vector<std::vector<double>> response(electrodes.size());
+    for (auto e: util::count_along(electrodes)) {
+        for (auto& cable: i_memb.meta) {
+            double area = 0, r = 0;
+            for (auto& seg: placement.segments(mextent(mcable_list{cable}))) {
+                double seg_area = math::area_frustrum(distance(seg.prox, seg.dist), seg.prox.radius, seg.dist.radius);
+                r += seg_area*line_source_potential(seg, electrodes[e], sigma);
+                area += seg_area;
+            }
+            response[e].push_back(r/area);
+        }
+    }
+
+    // With a uniform membrane potential at t=0, there are no membrane currents.
+    double max_abs_phi = 0;
+    for (unsigned j = 0; j<when.size(); ++j) {
+        SCOPED_TRACE(j);
+        ASSERT_EQ(electrodes.size(), phi[j].v.size());
+
+        for (auto e: util::count_along(electrodes)) {
+            double expected = 0;
+            for (auto k: util::count_along(i_memb.meta)) {
+                expected += response[e][k]*i_memb[j].v[k];
+            }
+            EXPECT_NEAR(expected, phi[j].v[e], 1e-6*std::abs(expected)+1e-12);
+            max_abs_phi = std::max(max_abs_phi, std::abs(phi[j].v[e]));
+        }
+    }
+    EXPECT_GT(max_abs_phi, 0.);
+    for (double x: phi[0].v) {
+        EXPECT_NEAR(0., x, 1e-9*max_abs_phi);
+    }
+
+    // A summed sampler over two copies of the cell sees twice the potential,
+    // whether or not the cells share a cell group. A second summed sampler,
+    // reduced together with the first, takes two samples in one time step.
+    std::vector<std::pair<time_type, std::vector<double>>> grouped_sums;
+    for (unsigned group_size: {1u, 2u}) {
+        SCOPED_TRACE(group_size);
+        cable1d_recipe rec(std::vector<cable_cell>(2, cells[0]), false);
+        rec.catalogue() = make_unit_test_catalogue(global_default_catalogue());
+        rec.add_probe(0, 0, cable_probe_extracellular_potential{electrodes, sigma});
+        rec.add_probe(1, 0, cable_probe_extracellular_potential{electrodes, sigma});
+
+        partition_hint_map phints = {
+           {cell_kind::cable, {group_size, partition_hint::max_size, true}}
+        };
+        simulation sim(rec, partition_load_balance(rec, ctx, phints), ctx);
+
+        std::vector<std::pair<time_type, std::vector<double>>> sums, close_sums;
+        sim.add_summed_sampler(all_probes, explicit_schedule(when),
+            [&](time_type t, const std::vector<double>& v) { sums.push_back({t, v}); });
+        sim.add_summed_sampler(one_probe({1, 0}), explicit_schedule({0.1, 0.11}),
+            [&](time_type t, const std::vector<double>& v) { close_sums.push_back({t, v}); });
+        sim.run(t_end, 0.025);
+
+        ASSERT_EQ(2u, close_sums.size());
+        EXPECT_EQ(0.1, close_sums[0].first);
+        EXPECT_EQ(0.11, close_sums[1].first);
+        ASSERT_EQ(electrodes.size(), close_sums[0].second.size());
+        ASSERT_EQ(electrodes.size(), close_sums[1].second.size());
+        for (auto e: util::count_along(electrodes)) {
+            EXPECT_NEAR(phi[1].v[e], close_sums[0].second[e], 1e-9*max_abs_phi);
+        }
+
+        if (grouped_sums.empty()) {
+            grouped_sums = sums;
+        }
+        else {
+            EXPECT_EQ(grouped_sums, sums);
+        }
+
+        ASSERT_EQ(when.size(), sums.size());
+        for (unsigned j = 0; j<when.size(); ++j) {
+            EXPECT_EQ(when[j], sums[j].first);
+            ASSERT_EQ(electrodes.size(), sums[j].second.size());
+            for (auto e: util::count_along(electrodes)) {
+                EXPECT_NEAR(2*phi[j].v[e], sums[j].second[e], 1e-9*max_abs_phi);
+            }
+        }
+    }
+}
+
 template <typename Backend>
 void run_exact_sampling_probe_test(const context& ctx) {
     // As the exact sampling implementation interacts with the event delivery
@@ -1259,6 +1376,106 @@ void run_exact_sampling_probe_test(const context& ctx) {
     }
 }
 
+template <typename Backend>
+void run_cell_group_probe_test(const context& ctx) {
+    using fvm_cell = typename backend_access<Backend>::fvm_cell;
+
+    // Whole cell probes on cells sharing a group resolve to the CVs of their
+    // own cell, independent of the order in which the probes are resolved.
+    // Probes of different kinds, and probes with more than one data entry,
+    // keep their data apart.
+
+    auto m = make_stick_morphology();
+    decor d;
+    d.set_default(cv_policy_fixed_per_branch(3));
+    d.paint(reg::all(), "hh");
+
+    std::vector<cable_cell> cells(3, cable_cell(m, {}, d));
+    cable1d_recipe rec(cells);
+    for (cell_gid_type gid: {0u, 1u, 2u}) {
+        rec.add_probe(gid, 0, cable_probe_density_state_cell{"hh", "m"});
+        rec.add_probe(gid, 0, cable_probe_ion_int_concentration_cell{"na"});
+        rec.add_probe(gid, 0, cable_probe_ion_current_cell{"na"});
+        rec.add_probe(gid, 0, cable_probe_membrane_voltage{join(ls::location(0, 0.25), ls::location(0, 0.75))});
+    }
+
+    std::vector<target_handle> targets;
+    std::vector<fvm_index_type> cell_to_intdom;
+    probe_association_map probe_map;
+
+    fvm_cell lcell(*ctx);
+    lcell.initialize({0, 1, 2}, rec, cell_to_intdom, targets, probe_map);
+    EXPECT_EQ(12u, probe_map.tag.size());
+    EXPECT_EQ(15u, probe_map.data.size());
+
+    auto get_data = [&](cell_member_type x) {
+        std::vector<const fvm_probe_data*> data;
+        for (auto& d: probe_map.data_on(x)) data.push_back(&d);
+        return data;
+    };
+
+    auto get_info = [&](cell_member_type x) -> const fvm_probe_multi& {
+        auto data = get_data(x);
+        EXPECT_EQ(1u, data.size());
+        return std::get<fvm_probe_multi>(data.front()->info);
+    };
+
+    for (cell_lid_type i: {0u, 1u}) {
+        probe_handle first = get_info({0, i}).raw_handles.at(0);
+
+        for (cell_gid_type gid: {0u, 1u, 2u}) {
+            auto& info = get_info({gid, i});
+            ASSERT_EQ(3u, info.raw_handles.size());
+            EXPECT_EQ(3u, std::get<mcable_list>(info.metadata).size());
+
+            for (unsigned j = 0; j<3; ++j) {
+                EXPECT_EQ(first+3*gid+j, info.raw_handles[j]);
+            }
+        }
+    }
+
+    // Ion current weights are the CV areas in µm², scaled to give nA.
+    {
+        auto data = get_data({0, 2});
+        ASSERT_EQ(1u, data.size());
+        probe_handle first = std::get<fvm_probe_weighted_multi>(data.front()->info).raw_handles.at(0);
+
+        for (cell_gid_type gid: {0u, 1u, 2u}) {
+            auto data = get_data({gid, 2});
+            ASSERT_EQ(1u, data.size());
+
+            auto& info = std::get<fvm_probe_weighted_multi>(data.front()->info);
+            ASSERT_EQ(3u, info.raw_handles.size());
+            ASSERT_EQ(3u, info.weight.size());
+            ASSERT_EQ(3u, info.metadata.size());
+
+            double total = 0;
+            for (unsigned j = 0; j<3; ++j) {
+                EXPECT_EQ(first+3*gid+j, info.raw_handles[j]);
+                EXPECT_DOUBLE_EQ(0.001*cells[gid].embedding().integrate_area(info.metadata[j]), info.weight[j]);
+                total += info.weight[j];
+            }
+            EXPECT_TRUE(testing::near_relative(0.001*2*math::pi<double>*100, total, 1e-6));
+        }
+    }
+
+    // The voltage probe has one interpolated entry per location.
+    for (cell_gid_type gid: {0u, 1u, 2u}) {
+        auto data = get_data({gid, 3});
+        ASSERT_EQ(2u, data.size());
+
+        std::vector<double> pos;
+        for (auto p: data) {
+            auto& info = std::get<fvm_probe_interpolated>(p->info);
+            EXPECT_EQ(0u, info.metadata.branch);
+            EXPECT_DOUBLE_EQ(1., info.coef[0]+info.coef[1]);
+            pos.push_back(info.metadata.pos);
+        }
+        util::sort(pos);
+        EXPECT_EQ((std::vector<double>{0.25, 0.75}), pos);
+    }
+}
+
 // Generate unit tests multicore_X and gpu_X for each entry X in PROBE_TESTS,
 // which establish the appropriate arbor context and then call run_X_probe_test.
 
@@ -1266,7 +1483,7 @@ void run_exact_sampling_probe_test(const context& ctx) {
 #define PROBE_TESTS \
     v_i, v_cell, v_sampled, expsyn_g, expsyn_g_cell, ion_density, \
     axial_and_ion_current_sampled, partial_density, exact_sampling, \
-    multi, total_current
+    multi, total_current, extracellular, cell_group
 
 #undef RUN_MULTICORE
 #define RUN_MULTICORE(x) \
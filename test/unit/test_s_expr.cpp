@@ -99,6 +99,55 @@ TEST(s_expr, atoms_in_parens) {
     }
 }
 
+TEST(s_expr, tree) {
+    // Trees should parse to the same expressions as s_expr, including errors.
+    for (auto in: {"(foo bar 42 -3.2e4 \"dog cat\")",
+                   "(a (b (c) ()) nil (d\n  ; comment\n  e))",
+                   "atom",
+                   "()",
+                   "",
+                   "(foo",
+                   "foo)",
+                   "(foo) (bar)",
+                   "(foo 1.2.3)",
+                   "(foo \"bar)",
+                   "(foo #)"})
+    {
+        auto expected = parse_s_expr(transmogrifier(in));
+        auto tree = parse_s_expr_tree(in);
+        ASSERT_EQ(1u, tree.roots.size());
+        auto e = tree.to_s_expr(tree.roots[0]);
+
+        EXPECT_EQ(util::pprintf("{}", expected), util::pprintf("{}", e));
+        EXPECT_EQ(location(expected).line, tree.location(tree.roots[0]).line);
+        EXPECT_EQ(location(expected).column, tree.location(tree.roots[0]).column);
+        EXPECT_EQ(expected.is_atom() && expected.atom().kind==tok::error,
+                  tree[tree.roots[0]].kind==tok::error);
+    }
+
+    // Lists are linked through their elements, and symbols are interned.
+    std::string in = "(tag 1)\n(join (tag 2) (tag 3))\n(root)";
+    auto tree = parse_multi_s_expr_tree(in);
+    ASSERT_EQ(3u, tree.roots.size());
+    EXPECT_EQ(3u, tree.symbols.size());
+
+    auto& join = tree[tree.roots[1]];
+    EXPECT_EQ(tok::lparen, join.kind);
+    EXPECT_EQ(3u, join.length);
+    EXPECT_EQ("join", tree[join.first].spelling);
+    EXPECT_EQ(2u, tree[join.first].loc.line);
+
+    auto arg = tree[tree[join.first].next];
+    EXPECT_EQ(tree[tree[tree.roots[0]].first].symbol, tree[arg.first].symbol);
+    EXPECT_EQ("3", tree[tree[tree[arg.next].first].next].spelling);
+    EXPECT_EQ(s_expr_tree::npos, tree[arg.next].next);
+
+    // Parsing stops at the first error.
+    auto bad = parse_multi_s_expr_tree("(tag 1) (tag (2) (tag 3)");
+    ASSERT_EQ(2u, bad.roots.size());
+    EXPECT_EQ(tok::error, bad[bad.roots[1]].kind);
+}
+
 template <typename L>
 std::string round_trip_label(const char* in) {
     if (auto x = parse_label_expression(in)) {
@@ -186,6 +235,7 @@ TEST(regloc, comments) {
 TEST(regloc, errors) {
     for (auto expr: {"axon",         // unquoted region name
                      "(tag 1.2)",    // invalid argument in an otherwise valid region expression
+                     "(tag 12345678901234)", // integer argument out of range
                      "(tag 1 2)",    // too many arguments to otherwise valid region expression
                      "(tag 1) (tag 2)", // more than one valid description
                      "(tag",         // syntax error in region expression
@@ -0,0 +1,122 @@
+#include "../gtest.h"
+
+#include <tuple>
+#include <vector>
+
+#include <arbor/arbexcept.hpp>
+#include <arbor/context.hpp>
+#include <arbor/domain_decomposition.hpp>
+#include <arbor/lif_cell.hpp>
+#include <arbor/load_balance.hpp>
+#include <arbor/recipe.hpp>
+#include <arbor/schedule.hpp>
+#include <arbor/simulation.hpp>
+#include <arbor/spike.hpp>
+#include <arbor/spike_source_cell.hpp>
+
+using namespace arb;
+
+namespace {
+// Spike sources with gids below n_source, firing regularly at the same times,
+// driving a network of LIF cells with gids n_source and above. Each LIF
+// cell receives connections from three cells of lower gid, with distinct
+// weights, and many events arrive at the same time. Some single events take
+// a cell over threshold, others only together with coincident events.
+
+class lif_network_recipe: public recipe {
+public:
+    lif_network_recipe(cell_size_type n_source, cell_size_type n_lif):
+        n_source_(n_source), n_lif_(n_lif)
+    {}
+
+    cell_size_type num_cells() const override { return n_source_+n_lif_; }
+
+    cell_kind get_cell_kind(cell_gid_type gid) const override {
+        return gid<n_source_? cell_kind::spike_source: cell_kind::lif;
+    }
+
+    util::unique_any get_cell_description(cell_gid_type gid) const override {
+        if (gid<n_source_) {
+            return spike_source_cell{regular_schedule(0.5*(gid%3), 2.)};
+        }
+        return lif_cell();
+    }
+
+    std::vector<cell_connection> connections_on(cell_gid_type gid) const override {
+        std::vector<cell_connection> conns;
+        if (gid>=n_source_) {
+            for (cell_gid_type k = 0; k<3; ++k) {
+                cell_gid_type src = (gid*7+k*13)%gid;
+                float weight = 150.f + 31.3f*k + 0.37f*(gid%7);
+                conns.push_back(cell_connection({src, 0}, {gid, 0}, weight, 1.f+k));
+            }
+        }
+        return conns;
+    }
+
+    cell_size_type num_sources(cell_gid_type) const override { return 1; }
+    cell_size_type num_targets(cell_gid_type gid) const override { return gid<n_source_? 0: 1; }
+
+private:
+    cell_size_type n_source_, n_lif_;
+};
+}
+
+TEST(simulation, deterministic_spikes) {
+    lif_network_recipe rec(10, 50);
+
+    auto run = [&](unsigned n_thread, std::size_t group_size) {
+        auto ctx = make_context(proc_allocation(n_thread, -1));
+        partition_hint_map hints;
+        hints[cell_kind::lif].cpu_group_size = group_size;
+        hints[cell_kind::spike_source].cpu_group_size = group_size;
+        auto decomp = partition_load_balance(rec, ctx, hints);
+
+        simulation sim(rec, decomp, ctx);
+        sim.set_deterministic(true);
+
+        std::vector<spike> global, local;
+        sim.set_global_spike_callback(
+            [&](const std::vector<spike>& s) { global.insert(global.end(), s.begin(), s.end()); });
+        sim.set_local_spike_callback(
+            [&](const std::vector<spike>& s) { local.insert(local.end(), s.begin(), s.end()); });
+        sim.run(40, 0.025);
+
+        EXPECT_EQ(global, local);
+        return global;
+    };
+
+    auto expected = run(1, 1);
+
+    // Spikes are sorted by time and then by source.
+    ASSERT_FALSE(expected.empty());
+    for (std::size_t i = 1; i<expected.size(); ++i) {
+        const auto& a = expected[i-1];
+        const auto& b = expected[i];
+        EXPECT_TRUE(std::tie(a.time, a.source)<std::tie(b.time, b.source));
+    }
+
+    // Some of the LIF cells spike.
+    unsigned n_lif_spike = 0;
+    for (auto& s: expected) {
+        n_lif_spike += s.source.gid>=10;
+    }
+    EXPECT_LT(0u, n_lif_spike);
+
+    EXPECT_EQ(expected, run(4, 1));
+    EXPECT_EQ(expected, run(2, 7));
+    EXPECT_EQ(expected, run(4, 60));
+}
+
+TEST(simulation, compact_spike_exchange_resolution) {
+    // The minimum delay of the network is 1 ms.
+    lif_network_recipe rec(10, 20);
+    auto ctx = make_context();
+    simulation sim(rec, partition_load_balance(rec, ctx), ctx);
+
+    EXPECT_NO_THROW(sim.set_compact_spike_exchange(true, 0));
+    EXPECT_NO_THROW(sim.set_compact_spike_exchange(true, 0.5));
+    EXPECT_THROW(sim.set_compact_spike_exchange(true, -0.1), range_check_failure);
+    EXPECT_THROW(sim.set_compact_spike_exchange(true, 1.), range_check_failure);
+    EXPECT_NO_THROW(sim.set_compact_spike_exchange(false, 1.));
+}
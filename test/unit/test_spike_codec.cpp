@@ -0,0 +1,147 @@
+#include "../gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <arbor/spike.hpp>
+
+#include "communication/gathered_vector.hpp"
+#include "communication/spike_codec.hpp"
+#include "util/rangeutil.hpp"
+
+using namespace arb;
+
+namespace {
+std::vector<spike> sorted_spikes(std::size_t n, cell_gid_type max_gid, time_type t0, time_type t1) {
+    std::mt19937 gen;
+    std::uniform_int_distribution<cell_gid_type> gid_dist(0, max_gid);
+    std::uniform_real_distribution<time_type> time_dist(t0, t1);
+
+    std::vector<spike> spikes(n);
+    for (auto& s: spikes) {
+        s.source = {gid_dist(gen), 0};
+        s.time = time_dist(gen);
+    }
+    util::sort_by(spikes, [](const spike& s) { return s.source; });
+    return spikes;
+}
+
+gathered_vector<spike> round_trip(const std::vector<spike>& spikes, time_type resolution) {
+    auto block = encode_spikes(spikes, resolution);
+    auto n = block.size();
+    return decode_spikes(gathered_vector<char>(std::move(block), {0u, unsigned(n)}));
+}
+}
+
+TEST(spike_codec, empty) {
+    auto s = round_trip({}, 0.01);
+    EXPECT_EQ(0u, s.size());
+    EXPECT_EQ((std::vector<unsigned>{0u, 0u}), s.partition());
+}
+
+TEST(spike_codec, exact) {
+    std::vector<spike> spikes = {
+        {{0u, 3u}, 1.25},
+        {{2u, 0u}, 0.5},
+        {{2u, 1u}, 0.75},
+        {{70000u, 2u}, 3.},
+        {{3u, 0u}, 0.},
+    };
+
+    auto s = round_trip(spikes, 0);
+    EXPECT_EQ(spikes, s.values());
+    EXPECT_EQ((std::vector<unsigned>{0u, 5u}), s.partition());
+}
+
+TEST(spike_codec, rounded) {
+    const time_type resolution = 0.025/64;
+
+    // Times in a narrow window fit in 16 bits, and dense gids with zero
+    // lids in one byte each: less than a quarter of the plain size.
+    {
+        auto spikes = sorted_spikes(1000, 200, 10., 10.5);
+        auto block = encode_spikes(spikes, resolution);
+        EXPECT_LT(block.size(), spikes.size()*sizeof(spike)/4);
+
+        auto s = round_trip(spikes, resolution);
+        ASSERT_EQ(spikes.size(), s.size());
+        for (std::size_t i = 0; i<spikes.size(); ++i) {
+            EXPECT_EQ(spikes[i].source, s.values()[i].source);
+            EXPECT_NEAR(spikes[i].time, s.values()[i].time, resolution/2);
+        }
+
+        // Times are rounded to the nearest multiple of the resolution.
+        for (std::size_t i = 0; i<spikes.size(); ++i) {
+            EXPECT_EQ(std::round(spikes[i].time/resolution)*resolution, s.values()[i].time);
+        }
+    }
+
+    // Wider windows need 32 bit times.
+    {
+        auto spikes = sorted_spikes(1000, 200, 0., 100.);
+        auto s = round_trip(spikes, resolution);
+        ASSERT_EQ(spikes.size(), s.size());
+        for (std::size_t i = 0; i<spikes.size(); ++i) {
+            EXPECT_EQ(spikes[i].source, s.values()[i].source);
+            EXPECT_NEAR(spikes[i].time, s.values()[i].time, resolution/2);
+        }
+    }
+
+    // Times that can't be represented in 32 bits are sent exactly.
+    {
+        auto spikes = sorted_spikes(10, 200, 0., 1e10);
+        EXPECT_EQ(spikes, round_trip(spikes, resolution).values());
+    }
+
+    EXPECT_EQ(round_trip(sorted_spikes(100, 20, 0., 1.), 0.01).values(),
+              round_spike_times(sorted_spikes(100, 20, 0., 1.), 0.01));
+}
+
+// Rounded times do not depend on which other spikes are in the block, so
+// they are the same for any partition of the spikes over domains.
+TEST(spike_codec, grid) {
+    const time_type resolution = 0.01;
+    auto spikes = sorted_spikes(200, 50, 3., 4.);
+
+    auto whole = round_spike_times(spikes, resolution);
+    std::vector<spike> parts;
+    for (std::size_t i = 0; i<spikes.size(); i += 7) {
+        std::vector<spike> part(spikes.begin()+i, spikes.begin()+std::min(i+7, spikes.size()));
+        for (auto& s: round_spike_times(part, resolution)) {
+            parts.push_back(s);
+        }
+    }
+    EXPECT_EQ(whole, parts);
+
+    // Also for negative times and a single spike.
+    std::vector<spike> one = {{{1u, 0u}, -2.004}};
+    EXPECT_EQ(std::round(-2.004/resolution)*resolution, round_spike_times(one, resolution).front().time);
+}
+
+TEST(spike_codec, partition) {
+    std::vector<std::vector<spike>> domains = {
+        sorted_spikes(10, 100, 0., 1.),
+        {},
+        {{{7u, 1u}, 2.}},
+        sorted_spikes(100, 1000, 5., 6.),
+    };
+
+    std::vector<char> blocks;
+    std::vector<unsigned> block_part = {0};
+    std::vector<spike> expected;
+    std::vector<unsigned> expected_part = {0};
+    for (auto& d: domains) {
+        auto b = encode_spikes(d, 0);
+        blocks.insert(blocks.end(), b.begin(), b.end());
+        block_part.push_back(blocks.size());
+
+        expected.insert(expected.end(), d.begin(), d.end());
+        expected_part.push_back(expected.size());
+    }
+
+    auto s = decode_spikes(gathered_vector<char>(std::move(blocks), std::move(block_part)));
+    EXPECT_EQ(expected, s.values());
+    EXPECT_EQ(expected_part, s.partition());
+}
@@ -1,9 +1,24 @@
 #include "../gtest.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include <arbor/recipe.hpp>
 #include <arbor/schedule.hpp>
 #include <arbor/spike.hpp>
 #include <arbor/spike_source_cell.hpp>
+#include <arbor/spike_trains.hpp>
 #include <arbor/util/unique_any.hpp>
+#include <arborio/gdfio.hpp>
 
 #include "spike_source_cell_group.hpp"
 
@@ -111,3 +126,74 @@ TEST(spike_source, exhaust)
     test_seq(regular_schedule(0, 1, 5));
     test_seq(explicit_schedule({0.3, 2.3, 4.7}));
 }
+
+// Test that spike sources replaying a spike train file produce the spikes of
+// their train, from a file converted from the text spike format.
+TEST(spike_source, spike_train_file)
+{
+    std::istringstream gdf(
+        "# gid time\n"
+        "2 3.5\n"
+        "0 1.25\n"
+        "2 0.5\n"
+        "\n"
+        "0 12\n"
+        "2 17.75\n");
+
+    auto spikes = arborio::parse_gdf(gdf);
+    ASSERT_EQ(5u, spikes.size());
+
+    char dir_template[] = "/tmp/arbor-test-XXXXXX";
+    std::string path = std::string(mkdtemp(dir_template))+"/trains.bin";
+
+    // Four trains, of which 1 and 3 are empty.
+    write_spike_train_file(path, spikes, 4);
+    {
+        spike_train_file trains(path);
+        EXPECT_EQ(4u, trains.num_trains());
+        EXPECT_EQ(5u, trains.num_spikes());
+        EXPECT_EQ((std::vector<time_type>{1.25, 12}), as_vector(trains.train(0)));
+        EXPECT_EQ((std::vector<time_type>{}), as_vector(trains.train(1)));
+        EXPECT_EQ((std::vector<time_type>{0.5, 3.5, 17.75}), as_vector(trains.train(2)));
+        EXPECT_EQ((std::vector<time_type>{}), as_vector(trains.train(4)));
+
+        // Cells 0-3 replay trains 3-0, cell 4 has a schedule.
+        auto cell = [&](cell_gid_type gid) {
+            return gid<4? spike_source_cell{{}, trains, 3-gid}: spike_source_cell{explicit_schedule({2., 11.})};
+        };
+        struct trains_recipe: recipe {
+            std::function<spike_source_cell (cell_gid_type)> cell;
+            cell_size_type num_cells() const override { return 5; }
+            cell_kind get_cell_kind(cell_gid_type) const override { return cell_kind::spike_source; }
+            util::unique_any get_cell_description(cell_gid_type gid) const override { return cell(gid); }
+        } rec;
+        rec.cell = cell;
+
+        spike_source_cell_group group({0, 1, 2, 3, 4}, rec);
+
+        auto advance = [&](epoch ep) {
+            group.clear_spikes();
+            group.advance(ep, 1, {});
+            std::vector<std::pair<cell_gid_type, time_type>> result;
+            for (auto& s: group.spikes()) result.push_back({s.source.gid, s.time});
+            std::sort(result.begin(), result.end());
+            return result;
+        };
+
+        using spike_list = std::vector<std::pair<cell_gid_type, time_type>>;
+        epoch ep(0, 10);
+        EXPECT_EQ((spike_list{{1, 0.5}, {1, 3.5}, {3, 1.25}, {4, 2.}}), advance(ep));
+        ep.advance(20);
+        EXPECT_EQ((spike_list{{1, 17.75}, {3, 12.}, {4, 11.}}), advance(ep));
+
+        group.reset();
+        EXPECT_EQ((spike_list{{1, 0.5}, {1, 3.5}, {3, 1.25}, {4, 2.}}), advance(epoch(0, 10)));
+    }
+    std::remove(path.c_str());
+
+    EXPECT_THROW(spike_train_file{path}, bad_spike_train_file);
+    std::ofstream(path) << "not a spike train\n";
+    EXPECT_THROW(spike_train_file{path}, bad_spike_train_file);
+    std::remove(path.c_str());
+    rmdir(dir_template);
+}
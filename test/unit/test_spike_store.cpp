@@ -5,6 +5,7 @@
 
 #include "execution_context.hpp"
 #include "thread_private_spike_store.hpp"
+#include "threading/threading.hpp"
 
 using arb::spike;
 
@@ -114,3 +115,41 @@ TEST(spike_store, gather)
         EXPECT_EQ(spikes[i].time, gathered_spikes[i].time);
     }
 }
+
+TEST(spike_store, gather_sorted)
+{
+    using store_type = arb::thread_private_spike_store;
+
+    arb::proc_allocation resources;
+    if (auto nt = arbenv::get_env_num_threads()) {
+        resources.num_threads = nt;
+    }
+    else {
+        resources.num_threads = arbenv::thread_concurrency();
+    }
+
+    arb::execution_context context(resources);
+    store_type store(context.thread_pool);
+
+    // Insert batches of spikes in descending order of source from many tasks;
+    // within each batch, two spikes share a source.
+    const unsigned n_batch = 100;
+    arb::threading::parallel_for::apply(0, n_batch, context.thread_pool.get(),
+        [&](unsigned i) {
+            arb::cell_gid_type gid = 2*(n_batch-i);
+            store.insert({{{gid+1, 0}, 0.f}, {{gid, 0}, 1.f}, {{gid, 0}, 2.f}});
+        });
+
+    // Spikes appended through get() are also collated in order.
+    store.get().push_back({{1, 0}, 3.f});
+    store.get().push_back({{0, 0}, 4.f});
+
+    auto gathered_spikes = store.gather();
+    ASSERT_EQ(3*n_batch+2, gathered_spikes.size());
+
+    for (auto i=1u; i<gathered_spikes.size(); ++i) {
+        const auto& a = gathered_spikes[i-1];
+        const auto& b = gathered_spikes[i];
+        EXPECT_TRUE(a.source<b.source || (a.source==b.source && a.time<b.time));
+    }
+}
@@ -1,5 +1,6 @@
 #include "../gtest.h"
 
+#include <algorithm>
 #include <cmath>
 #include <tuple>
 #include <vector>
@@ -12,10 +13,15 @@
 #include "backends/multicore/mechanism.hpp"
 #include "util/maputil.hpp"
 #include "util/range.hpp"
+#include "util/rangeutil.hpp"
 
 #include "../common_cells.hpp"
 #include "common.hpp"
 #include "mech_private_field_access.hpp"
+#include "mechanisms/scalar/expsyn.hpp"
+#include "mechanisms/scalar/exp2syn.hpp"
+#include "mechanisms/simd/expsyn.hpp"
+#include "mechanisms/simd/exp2syn.hpp"
 
 using namespace arb;
 
@@ -176,3 +182,85 @@ TEST(synapses, syn_basic_state) {
     EXPECT_TRUE(testing::seq_almost_eq<fvm_value_type>(expected, mechanism_field(exp2syn, "B")));
 }
 
+
+// Batched SIMD event delivery must leave synapses in the same state as
+// delivering the events one at a time, with batches that span several
+// streams and contain both distinct and repeated targets.
+
+TEST(synapses, simd_event_delivery) {
+    using value_type = fvm_value_type;
+    using index_type = fvm_index_type;
+
+    const int num_intdom = 3;
+    const int num_comp = 6;
+    const int num_syn = 12;
+
+    // Mechanisms with ids 0 and 1 use scalar delivery, those with ids 2 and
+    // 3 the batched delivery.
+    std::vector<concrete_mech_ptr<backend>> mechs;
+    mechs.push_back(testing::make_mechanism_expsyn_scalar<backend>());
+    mechs.push_back(testing::make_mechanism_exp2syn_scalar<backend>());
+    mechs.push_back(testing::make_mechanism_expsyn_simd<backend>());
+    mechs.push_back(testing::make_mechanism_exp2syn_simd<backend>());
+
+    unsigned align = 1;
+    for (auto& m: mechs) {
+        align = std::max(align, m->data_alignment());
+    }
+
+    std::vector<index_type> cv_to_intdom = {0, 0, 1, 1, 2, 2};
+    value_type temp_K = *neuron_parameter_defaults.temperature_K;
+
+    shared_state state(num_intdom,
+        cv_to_intdom,
+        {},
+        std::vector<value_type>(num_comp, -65),
+        std::vector<value_type>(num_comp, temp_K),
+        std::vector<value_type>(num_comp, 1.),
+        align);
+
+    state.reset();
+    util::fill(state.time_to, 0.1);
+    state.set_dt();
+
+    // Four synapses on each integration domain.
+    std::vector<index_type> syn_cv(num_syn), syn_mult(num_syn, 1);
+    std::vector<value_type> syn_weight(num_syn, 1.0);
+    for (int i = 0; i<num_syn; ++i) {
+        syn_cv[i] = i/2;
+    }
+
+    for (unsigned id = 0; id<mechs.size(); ++id) {
+        mechs[id]->instantiate(id, state, {}, {syn_cv, syn_weight, syn_mult});
+        mechs[id]->initialize();
+    }
+
+    // Batches of four events with distinct targets and with repeated
+    // targets, and three events left over at the end.
+    const int num_events[num_intdom] = {7, 3, 9};
+    std::vector<deliverable_event> events;
+    for (unsigned id = 0; id<mechs.size(); ++id) {
+        for (int d = 0; d<num_intdom; ++d) {
+            for (int j = 0; j<num_events[d]; ++j) {
+                cell_local_size_type target = 4*d + (j<4? j: (j*j+d)%4);
+                events.push_back({0., {id, target, (cell_size_type)d}, 0.1f+0.37f*j+d});
+            }
+        }
+    }
+
+    for (int round = 0; round<2; ++round) {
+        state.deliverable_events.init(events);
+        state.deliverable_events.mark_until_after(state.time);
+        for (auto& m: mechs) {
+            m->deliver_events();
+        }
+    }
+
+    auto g = mechanism_field(mechs[0], "g");
+    EXPECT_TRUE(util::any_of(g, [](value_type x) { return x!=0; }));
+    EXPECT_EQ(g, mechanism_field(mechs[2], "g"));
+
+    for (auto field: {"A", "B"}) {
+        EXPECT_TRUE(testing::seq_almost_eq<fvm_value_type>(mechanism_field(mechs[1], field), mechanism_field(mechs[3], field)));
+    }
+}
@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <ostream>
+#include <vector>
 // (Pending abstraction of threading interface)
 #include <arbor/version.hpp>
 
@@ -110,6 +111,37 @@ TEST(notification_queue, test_move) {
     reset();
 }
 
+TEST(notification_queue, priority) {
+    notification_queue q;
+    std::vector<int> order;
+
+    q.push([&] { order.push_back(0); });
+    q.push([&] { order.push_back(1); }, high_priority);
+    q.push([&] { order.push_back(2); }, high_priority);
+
+    q.try_pop(normal_priority)();
+    q.pop()();
+    q.try_pop()();
+    EXPECT_FALSE(q.try_pop());
+    EXPECT_EQ((std::vector<int>{0, 1, 2}), order);
+}
+
+TEST(task_system, priority) {
+    // With a single thread, tasks are only run by try_run_task().
+    task_system ts(1);
+    std::vector<int> order;
+
+    ts.async([&] { order.push_back(0); });
+    ts.async([&] { order.push_back(1); }, high_priority);
+    ts.async([&] { order.push_back(2); });
+    ts.async([&] { order.push_back(3); }, high_priority);
+
+    for (int i = 0; i<4; ++i) {
+        ts.try_run_task();
+    }
+    EXPECT_EQ((std::vector<int>{1, 3, 0, 2}), order);
+}
+
 TEST(task_group, test_copy) {
     task_system ts;
     task_group g(&ts);
@@ -0,0 +1,144 @@
+#include "../gtest.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <arborenv/topology.hpp>
+
+using namespace arbenv;
+namespace fs = std::filesystem;
+
+namespace {
+// A sysfs tree for a node with two sockets, each with two cores with two
+// SMT threads, numbered as Linux does: processors i and i+4 are siblings.
+// Each core has a private 1 MiB L2 cache, each socket an 8 MiB L3 cache and
+// its own NUMA node.
+struct fake_sysfs {
+    std::string root;
+
+    fake_sysfs() {
+        char dir_template[] = "/tmp/arbor-test-XXXXXX";
+        root = mkdtemp(dir_template);
+
+        put("cpu/online", "0-7");
+        put("node/online", "0-1");
+        put("node/node0/cpulist", "0-1,4-5");
+        put("node/node1/cpulist", "2-3,6-7");
+
+        for (int id = 0; id<8; ++id) {
+            int core = id%4;
+            int socket = core/2;
+            auto siblings = std::to_string(core)+","+std::to_string(core+4);
+            auto socket_cpus = std::to_string(2*socket)+"-"+std::to_string(2*socket+1)+","
+                              +std::to_string(2*socket+4)+"-"+std::to_string(2*socket+5);
+
+            auto dir = "cpu/cpu"+std::to_string(id);
+            put(dir+"/topology/physical_package_id", std::to_string(socket));
+            put(dir+"/topology/thread_siblings_list", siblings);
+
+            put(dir+"/cache/index0/level", "1");
+            put(dir+"/cache/index0/type", "Data");
+            put(dir+"/cache/index0/size", "32K");
+            put(dir+"/cache/index0/shared_cpu_list", siblings);
+
+            put(dir+"/cache/index1/level", "1");
+            put(dir+"/cache/index1/type", "Instruction");
+            put(dir+"/cache/index1/size", "32K");
+            put(dir+"/cache/index1/shared_cpu_list", siblings);
+
+            put(dir+"/cache/index2/level", "2");
+            put(dir+"/cache/index2/type", "Unified");
+            put(dir+"/cache/index2/size", "1024K");
+            put(dir+"/cache/index2/shared_cpu_list", siblings);
+
+            put(dir+"/cache/index3/level", "3");
+            put(dir+"/cache/index3/type", "Unified");
+            put(dir+"/cache/index3/size", "8M");
+            put(dir+"/cache/index3/shared_cpu_list", socket_cpus);
+        }
+    }
+
+    ~fake_sysfs() {
+        fs::remove_all(root);
+    }
+
+    void put(const std::string& path, const std::string& value) {
+        fs::path p = fs::path(root)/path;
+        fs::create_directories(p.parent_path());
+        std::ofstream(p) << value << "\n";
+    }
+};
+}
+
+TEST(topology, parse_cpu_list) {
+    EXPECT_EQ((std::vector<int>{}), parse_cpu_list(""));
+    EXPECT_EQ((std::vector<int>{3}), parse_cpu_list("3"));
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 8, 10, 11}), parse_cpu_list("0-3,8,10-11"));
+    EXPECT_EQ((std::vector<int>{0, 1, 2}), parse_cpu_list("2,0-1"));
+}
+
+TEST(topology, get_topology) {
+    fake_sysfs sys;
+    auto topo = get_topology(sys.root);
+
+    ASSERT_EQ(8u, topo.processors.size());
+    EXPECT_EQ(2u, topo.num_sockets);
+    EXPECT_EQ(2u, topo.num_numa_nodes);
+
+    using cores = std::vector<std::vector<int>>;
+    EXPECT_EQ((cores{{0, 4}, {1, 5}, {2, 6}, {3, 7}}), topo.cores);
+
+    for (auto& p: topo.processors) {
+        EXPECT_EQ(p.id%4, p.core);
+        EXPECT_EQ(p.id%4/2, p.socket);
+        EXPECT_EQ(p.id%4/2, p.numa_node);
+        EXPECT_EQ(1u<<20, topo.l2_cache_size(p.id));
+    }
+
+    // Per core L1 data, L1 instruction and L2 caches, and per socket L3.
+    EXPECT_EQ(4u*3u+2u, topo.caches.size());
+
+    // No topology information.
+    auto none = get_topology(sys.root+"/missing");
+    EXPECT_TRUE(none.processors.empty());
+    EXPECT_EQ(0u, none.l2_cache_size(0));
+}
+
+TEST(topology, default_allocation) {
+    fake_sysfs sys;
+    auto topo = get_topology(sys.root);
+
+    // One thread per core.
+    auto a = default_allocation(topo, {});
+    EXPECT_EQ(4u, a.num_threads);
+    EXPECT_EQ(1u, a.threads_per_core);
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3}), a.pinning);
+    EXPECT_EQ(1u<<20, a.group_working_set);
+
+    // Two threads per core share the L2 cache.
+    a = default_allocation(topo, {}, 2);
+    EXPECT_EQ(8u, a.num_threads);
+    EXPECT_EQ(2u, a.threads_per_core);
+    EXPECT_EQ((std::vector<int>{0, 4, 1, 5, 2, 6, 3, 7}), a.pinning);
+    EXPECT_EQ(1u<<19, a.group_working_set);
+
+    // Restricted affinity: processors 0 and 4 are on the same core.
+    a = default_allocation(topo, {0, 4, 5});
+    EXPECT_EQ((std::vector<int>{0, 5}), a.pinning);
+    a = default_allocation(topo, {0, 4, 5}, 4);
+    EXPECT_EQ((std::vector<int>{0, 4, 5}), a.pinning);
+    EXPECT_EQ(2u, a.threads_per_core);
+
+    // Without topology, every available processor is used.
+    a = default_allocation(hardware_topology{}, {1, 2, 3});
+    EXPECT_EQ(3u, a.num_threads);
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), a.pinning);
+    EXPECT_EQ(0u, a.group_working_set);
+
+    // The allocation for this node is valid.
+    a = default_allocation();
+    EXPECT_LE(1u, a.num_threads);
+}